@@ -9,6 +9,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace IceInternal
@@ -19,9 +20,17 @@ namespace IceInternal
         Buffer() : i(b.begin()) {}
         Buffer(const std::byte* beg, const std::byte* end) : b(beg, end), i(b.begin()) {}
         Buffer(const std::vector<std::byte>& v) : b(v), i(b.begin()) {}
-        Buffer(Buffer& o, bool adopt) : b(o.b, adopt), i(b.begin()) {}
+        Buffer(Buffer& o, bool adopt)
+            : b(o.b, adopt),
+              i(b.begin()),
+              _owner(adopt ? std::move(o._owner) : o._owner)
+        {
+        }
 
-        Buffer(Buffer&& other) noexcept : b(std::move(other.b)), i(other.i) { other.i = other.b.begin(); }
+        Buffer(Buffer&& other) noexcept : b(std::move(other.b)), i(other.i), _owner(std::move(other._owner))
+        {
+            other.i = other.b.begin();
+        }
 
         Buffer& operator=(Buffer&& other) noexcept
         {
@@ -29,6 +38,7 @@ namespace IceInternal
             {
                 b = std::move(other.b);
                 i = other.i;
+                _owner = std::move(other._owner);
                 other.i = other.b.begin();
             }
             return *this;
@@ -41,6 +51,17 @@ namespace IceInternal
         {
             b.swap(other.b);
             std::swap(i, other.i);
+            _owner.swap(other._owner);
+        }
+
+        // Makes this buffer reference the given memory without copying it. The memory is kept alive by the given
+        // owner until this buffer is destroyed or references another memory.
+        void view(const std::byte* beg, const std::byte* end, std::shared_ptr<void> owner)
+        {
+            Container tmp(beg, end);
+            b.swap(tmp);
+            i = b.begin();
+            _owner = std::move(owner);
         }
 
         class ICE_API Container
@@ -154,6 +175,10 @@ namespace IceInternal
 
         Container b;
         Container::iterator i;
+
+    private:
+        // Keeps alive the memory referenced by a buffer created with view().
+        std::shared_ptr<void> _owner;
     };
 }
 
@@ -0,0 +1,183 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_CHUNKED_SEND_H
+#define ICE_CHUNKED_SEND_H
+
+#include "Config.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace Ice
+{
+    /**
+     * The function called by sendChunks to send a chunk. It receives the offset of the chunk in the payload, the chunk
+     * bytes and the callbacks to call when the invocation completes, and typically forwards them to the lambda-based
+     * async function of an operation such as `void write(long offset, ["cpp:array"] ByteSeq chunk)`. The chunk bytes
+     * remain valid only until this function returns.
+     */
+    using SendChunkFunction = std::function<void(
+        std::int64_t,
+        std::pair<const std::byte*, const std::byte*>,
+        std::function<void()>,
+        std::function<void(std::exception_ptr)>)>;
+
+    /**
+     * Sends a large payload as a sequence of chunk invocations, with at most maxInFlight invocations outstanding at
+     * any time. The payload is never marshaled in a single request, so its size is not limited by
+     * Ice.MessageSizeMax, and the memory used on both sides is bounded by chunkSize * maxInFlight. Since the servant
+     * receives each chunk as a separate request, it consumes the payload as it arrives. This function doesn't block:
+     * the first chunks are sent by the calling thread and the next ones by the threads that complete the chunk
+     * invocations, so it can be called from an Ice thread pool thread, for example from a dispatch or from the
+     * callback of an asynchronous invocation.
+     * @param data The payload, which must remain valid until response or exception is called.
+     * @param sendChunk The function called to send each chunk.
+     * @param response The function called once all the chunk invocations completed successfully.
+     * @param exception The function called with the exception of the first chunk invocation that failed, once the
+     * outstanding chunk invocations completed. No chunks are sent after a failure.
+     * @param chunkSize The maximum size of a chunk, in bytes.
+     * @param maxInFlight The maximum number of outstanding chunk invocations.
+     */
+    inline void sendChunksAsync(
+        std::pair<const std::byte*, const std::byte*> data,
+        SendChunkFunction sendChunk,
+        std::function<void()> response,
+        std::function<void(std::exception_ptr)> exception,
+        std::size_t chunkSize = 256 * 1024,
+        int maxInFlight = 8)
+    {
+        struct State : std::enable_shared_from_this<State>
+        {
+            std::mutex mutex;
+            std::pair<const std::byte*, const std::byte*> data;
+            const std::byte* next;
+            SendChunkFunction sendChunk;
+            std::function<void()> response;
+            std::function<void(std::exception_ptr)> exception;
+            std::size_t chunkSize;
+            int maxInFlight;
+            int inFlight = 0;
+            bool sending = false;
+            std::exception_ptr failure;
+
+            void completed(std::exception_ptr ex)
+            {
+                std::unique_lock lock(mutex);
+                --inFlight;
+                if (ex && !failure)
+                {
+                    failure = ex;
+                }
+                send(lock);
+            }
+
+            // Sends chunks until maxInFlight invocations are outstanding, and calls response or exception once the
+            // last invocation completed. A chunk invocation can complete from within sendChunk, in which case the
+            // thread already sending chunks sends the next ones, rather than recursing for each chunk.
+            void send(std::unique_lock<std::mutex>& lock)
+            {
+                if (sending)
+                {
+                    return;
+                }
+                sending = true;
+                while (!failure && next < data.second && inFlight < maxInFlight)
+                {
+                    const std::byte* begin = next;
+                    next += std::min(chunkSize, static_cast<std::size_t>(data.second - next));
+                    ++inFlight;
+
+                    lock.unlock();
+                    auto self = shared_from_this();
+                    try
+                    {
+                        sendChunk(
+                            static_cast<std::int64_t>(begin - data.first),
+                            {begin, next},
+                            [self] { self->completed(nullptr); },
+                            [self](std::exception_ptr ex) { self->completed(ex); });
+                    }
+                    catch (...)
+                    {
+                        lock.lock();
+                        --inFlight;
+                        if (!failure)
+                        {
+                            failure = std::current_exception();
+                        }
+                        continue;
+                    }
+                    lock.lock();
+                }
+                sending = false;
+
+                if (inFlight == 0 && (failure || next == data.second))
+                {
+                    // No invocation is outstanding, this is the last call of send.
+                    lock.unlock();
+                    if (failure)
+                    {
+                        exception(failure);
+                    }
+                    else
+                    {
+                        response();
+                    }
+                }
+            }
+        };
+
+        auto state = std::make_shared<State>();
+        state->data = data;
+        state->next = data.first;
+        state->sendChunk = std::move(sendChunk);
+        state->response = std::move(response);
+        state->exception = std::move(exception);
+        state->chunkSize = std::max<std::size_t>(chunkSize, 1);
+        state->maxInFlight = std::max(maxInFlight, 1);
+
+        std::unique_lock lock(state->mutex);
+        state->send(lock);
+    }
+
+    /**
+     * Sends a large payload as a sequence of chunk invocations and waits for the chunk invocations to complete. See
+     * sendChunksAsync. This function blocks the calling thread until the last chunk invocation completes, it must
+     * not be called from an Ice thread pool thread: the completion of the chunk invocations could require this
+     * thread, and the call would deadlock. Use sendChunksAsync instead from a dispatch or from the callback of an
+     * asynchronous invocation.
+     * @param data The payload, for example a memory-mapped file.
+     * @param sendChunk The function called to send each chunk.
+     * @param chunkSize The maximum size of a chunk, in bytes.
+     * @param maxInFlight The maximum number of outstanding chunk invocations.
+     * @throws std::exception The exception of the first chunk invocation that failed. No chunks are sent after a
+     * failure.
+     */
+    inline void sendChunks(
+        std::pair<const std::byte*, const std::byte*> data,
+        const SendChunkFunction& sendChunk,
+        std::size_t chunkSize = 256 * 1024,
+        int maxInFlight = 8)
+    {
+        auto promise = std::make_shared<std::promise<void>>();
+        sendChunksAsync(
+            data,
+            sendChunk,
+            [promise] { promise->set_value(); },
+            [promise](std::exception_ptr ex) { promise->set_exception(ex); },
+            chunkSize,
+            maxInFlight);
+        promise->get_future().get();
+    }
+}
+
+#endif
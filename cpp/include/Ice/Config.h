@@ -42,6 +42,13 @@
 #define ICE_INT_VERSION 30850              // AABBCC, with AA=major, BB=minor, CC=patch
 #define ICE_SO_VERSION "38a0"              // "ABC", with A=major, B=minor, C=patch
 
+// C++20 coroutines, used by Ice::Task and the "cpp:coroutine" Slice metadata.
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#    if __has_include(<coroutine>)
+#        define ICE_HAS_COROUTINES
+#    endif
+#endif
+
 #if !defined(ICE_BUILDING_ICE) && defined(ICE_API_EXPORTS)
 #    define ICE_BUILDING_ICE
 #endif
@@ -21,7 +21,14 @@ namespace Ice
         /**
          * <code>Ordered</code> forces the Ice run time to use the endpoints in the order they appeared in the proxy.
          */
-        Ordered
+        Ordered,
+        /**
+         * <code>LeastLoaded</code> selects the endpoint of each invocation by picking two endpoints at random and
+         * using the one whose connection is less loaded, based on its outstanding requests and its average round-trip
+         * time. The connection is not cached by the proxy, and the other endpoints are tried in random order if the
+         * selected endpoint fails.
+         */
+        LeastLoaded
     };
 }
 
@@ -0,0 +1,60 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_FILE_RANGE_H
+#define ICE_FILE_RANGE_H
+
+#include "StreamableTraits.h"
+
+#include <cstdint>
+
+namespace Ice
+{
+#ifdef _WIN32
+    /** A file HANDLE. */
+    using FileDescriptor = void*;
+#else
+    /** A file descriptor. */
+    using FileDescriptor = int;
+#endif
+
+    /**
+     * A range of bytes in an open file, marshaled as a sequence<byte>. The bytes are read from the file directly into
+     * the marshaling buffer, without an intermediate std::vector. Use FileRange as the view type of a byte sequence,
+     * for example `["cpp:view-type:Ice::FileRange"] ByteSeq`, to send file contents. FileRange is marshal-only: byte
+     * sequences are always unmarshaled as byte sequences.
+     *
+     * The range is read when the request or response is marshaled, it's not transferred with sendfile or splice: a
+     * marshaled message is a self-contained buffer, which can be resent on retry, compressed, dispatched collocated,
+     * or sent with other messages in a batch or a gather write. A range that extends beyond the end of the file makes
+     * the marshaling fail with MarshalException.
+     * \headerfile Ice/Ice.h
+     */
+    struct FileRange
+    {
+        /** The file, which must remain open until the range is marshaled. It's not closed by Ice. */
+        FileDescriptor file;
+
+        /** The offset of the range in the file. */
+        std::int64_t offset;
+
+        /** The size of the range, in bytes. */
+        std::int32_t size;
+    };
+
+    /// \cond STREAM
+    /**
+     * Specialization for FileRange, marshaled like a byte sequence (a size followed by the bytes).
+     * \headerfile Ice/Ice.h
+     */
+    template<> struct StreamableTraits<FileRange>
+    {
+        static const StreamHelperCategory helper = StreamHelperCategoryBuiltin;
+        static const int minWireSize = 1;
+        static const bool fixedLength = false;
+    };
+    /// \endcond
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include "Object.h"
 #include "OutputStream.h"
 #include "Proxy.h"
+#include "Task.h"
 #include "UserException.h"
 #include "Value.h"
 
@@ -20,6 +21,7 @@
 
 // We don't need to see the following headers when building the generated code.
 
+#    include "ChunkedSend.h"
 #    include "Communicator.h"
 #    include "Connection.h"
 #    include "ImplicitContext.h"
@@ -20,6 +20,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <string>
 #include <string_view>
@@ -558,18 +559,45 @@ namespace Ice
          */
         template<typename T> void read(std::pair<const T*, const T*>& v)
         {
-            auto holder = new std::vector<T>;
-            _deleters.push_back([holder] { delete holder; });
-            read(*holder);
-            if (holder->size() > 0)
+            if constexpr (IsBitwiseStreamable<T>::value)
             {
-                v.first = holder->data();
-                v.second = holder->data() + holder->size();
+                // The elements are read in place when they are suitably aligned in the marshaling buffer, otherwise
+                // they are copied with a single memcpy.
+                auto sz = static_cast<size_t>(readAndCheckSeqSize(static_cast<int>(sizeof(T))));
+                const std::byte* p;
+                readBlob(p, sizeof(T) * sz);
+                if (sz == 0)
+                {
+                    v.first = nullptr;
+                }
+                else if (reinterpret_cast<std::uintptr_t>(p) % alignof(T) == 0)
+                {
+                    v.first = reinterpret_cast<const T*>(p);
+                }
+                else
+                {
+                    auto holder = new std::vector<T>(sz);
+                    _deleters.push_back([holder] { delete holder; });
+                    memcpy(holder->data(), p, sizeof(T) * sz);
+                    v.first = holder->data();
+                }
+                v.second = v.first + sz;
             }
             else
             {
-                v.first = 0;
-                v.second = 0;
+                auto holder = new std::vector<T>;
+                _deleters.push_back([holder] { delete holder; });
+                read(*holder);
+                if (holder->size() > 0)
+                {
+                    v.first = holder->data();
+                    v.second = holder->data() + holder->size();
+                }
+                else
+                {
+                    v.first = 0;
+                    v.second = 0;
+                }
             }
         }
 
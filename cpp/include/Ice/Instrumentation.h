@@ -139,6 +139,14 @@ namespace Ice::Instrumentation
          * @param newState The new thread state.
          */
         virtual void stateChanged(ThreadState oldState, ThreadState newState) = 0;
+
+        /**
+         * Notification of the number of ready event handlers returned by the last select call of the thread's
+         * reactor. This is only called for threads of the client, server or object adapter thread pools, when this
+         * number changes. The default implementation does nothing.
+         * @param depth The number of event handlers ready to be processed.
+         */
+        virtual void queueDepth([[maybe_unused]] int depth) {}
     };
 
     /**
@@ -159,6 +167,13 @@ namespace Ice::Instrumentation
          * @param num The number of bytes received.
          */
         virtual void receivedBytes(int num) = 0;
+
+        /**
+         * Notification of queued messages sent over the connection with a single gather write. This is only called
+         * for transports which write several messages at once (tcp). The default implementation does nothing.
+         * @param num The number of messages sent with this write.
+         */
+        virtual void coalescedMessages([[maybe_unused]] int num) {}
     };
 
     /**
@@ -353,6 +353,28 @@ namespace Ice
         const char* ice_id() const noexcept final;
     };
 
+    /**
+     * This exception is raised by the dispatch of a request whose deadline, carried by the _deadline request context
+     * entry, expired before the object adapter could dispatch the request. The client receives an
+     * {@link UnknownLocalException}.
+     * \headerfile Ice/Ice.h
+     */
+    class ICE_API DeadlineExpiredException final : public TimeoutException
+    {
+    public:
+        /**
+         * Constructs a DeadlineExpiredException.
+         * @param file The file where this exception is constructed. This C string is not copied.
+         * @param line The line where this exception is constructed.
+         */
+        DeadlineExpiredException(const char* file, int line)
+            : TimeoutException(file, line, "the request deadline expired before the request was dispatched")
+        {
+        }
+
+        const char* ice_id() const noexcept final;
+    };
+
     //
     // Syscall exceptions
     //
@@ -617,6 +639,32 @@ namespace Ice
         const char* ice_id() const noexcept final;
     };
 
+    /**
+     * This exception is raised by the dispatch of a request rejected by the concurrency limiter of an object adapter,
+     * because the adapter was already dispatching as many requests as its current concurrency limit allows. The client
+     * receives an {@link UnknownLocalException} and the request is not retried automatically.
+     * \headerfile Ice/Ice.h
+     */
+    class ICE_API ConcurrencyLimitException final : public LocalException
+    {
+    public:
+        /**
+         * Constructs a ConcurrencyLimitException.
+         * @param file The file where this exception is constructed. This C string is not copied.
+         * @param line The line where this exception is constructed.
+         * @param limit The concurrency limit used to create the message returned by what().
+         */
+        ConcurrencyLimitException(const char* file, int line, int limit)
+            : LocalException(
+                  file,
+                  line,
+                  "dispatch rejected by the concurrency limiter, limit = " + std::to_string(limit))
+        {
+        }
+
+        const char* ice_id() const noexcept final;
+    };
+
     /**
      * This exception indicates that a connection was closed gracefully.
      * \headerfile Ice/Ice.h
@@ -10,10 +10,15 @@
 #include "Initialize.h"
 #include "Properties.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <regex>
+#include <unordered_map>
 
 namespace IceMX
 {
@@ -25,6 +30,67 @@ namespace IceMX
 
 namespace IceInternal
 {
+    //
+    // A histogram with logarithmic buckets, recorded without locking. Each thread records its values in one of several
+    // stripes of counters, to avoid contention between threads. The stripes are merged when the histogram is read.
+    //
+    class ICE_API MetricsHistogramI
+    {
+    public:
+        MetricsHistogramI(std::shared_ptr<const std::vector<std::int64_t>>);
+
+        void record(std::int64_t) noexcept;
+
+        IceMX::MetricsHistogram get() const;
+
+    private:
+        const std::shared_ptr<const std::vector<std::int64_t>> _bounds;
+        const std::size_t _stride;
+        std::unique_ptr<std::atomic<std::int64_t>[]> _counts;
+    };
+
+    //
+    // The histograms of the metrics objects of a given type. The lifetime histogram records the lifetime of the
+    // observers, the value histograms record the values passed to EntryT::record. Specialized below for the metrics
+    // types with histograms.
+    //
+    template<typename T> struct MetricsHistogramsT
+    {
+        using Member = std::optional<IceMX::MetricsHistogram> T::*;
+        static constexpr Member lifetime = nullptr;
+        static constexpr std::array<Member, 0> values{};
+    };
+
+    template<> struct MetricsHistogramsT<IceMX::DispatchMetrics>
+    {
+        using Member = std::optional<IceMX::MetricsHistogram> IceMX::DispatchMetrics::*;
+        static constexpr Member lifetime = &IceMX::DispatchMetrics::latency;
+        static constexpr std::array<Member, 1> values{&IceMX::DispatchMetrics::sizes};
+    };
+
+    template<> struct MetricsHistogramsT<IceMX::InvocationMetrics>
+    {
+        using Member = std::optional<IceMX::MetricsHistogram> IceMX::InvocationMetrics::*;
+        static constexpr Member lifetime = &IceMX::InvocationMetrics::latency;
+        static constexpr std::array<Member, 0> values{};
+    };
+
+    template<> struct MetricsHistogramsT<IceMX::RemoteMetrics>
+    {
+        using Member = std::optional<IceMX::MetricsHistogram> IceMX::RemoteMetrics::*;
+        static constexpr Member lifetime = &IceMX::RemoteMetrics::latency;
+        static constexpr std::array<Member, 1> values{&IceMX::RemoteMetrics::sizes};
+    };
+
+    template<> struct MetricsHistogramsT<IceMX::ConnectionMetrics>
+    {
+        using Member = std::optional<IceMX::MetricsHistogram> IceMX::ConnectionMetrics::*;
+        static constexpr Member lifetime = nullptr;
+        static constexpr std::array<Member, 2> values{
+            &IceMX::ConnectionMetrics::receivedSizes,
+            &IceMX::ConnectionMetrics::sentSizes};
+    };
+
     class ICE_API MetricsMapI;
     using MetricsMapIPtr = std::shared_ptr<MetricsMapI>;
 
@@ -51,6 +117,8 @@ namespace IceInternal
                 return match(value);
             }
 
+            const std::string& getAttribute() const { return _attribute; }
+
         private:
             bool match(const std::string&);
 
@@ -82,6 +150,9 @@ namespace IceInternal
         const int _retain;
         const std::vector<RegExpPtr> _accept;
         const std::vector<RegExpPtr> _reject;
+
+        // The bucket bounds of the histograms of the metrics objects, null if histograms are disabled.
+        const std::shared_ptr<const std::vector<std::int64_t>> _histogramBounds;
     };
 
     class ICE_API MetricsMapFactory
@@ -100,6 +171,11 @@ namespace IceInternal
     };
     using MetricsMapFactoryPtr = std::shared_ptr<MetricsMapFactory>;
 
+    //
+    // The metrics objects of a map are stored in shards, each shard has its own mutex and hash map to reduce the
+    // contention between the threads looking up metrics objects. Each metrics object has its own mutex to protect its
+    // attributes. The lock order is: the detached queue mutex, a shard mutex and a metrics object mutex.
+    //
     template<class MetricsType> class MetricsMapT : public MetricsMapI
     {
     public:
@@ -108,6 +184,7 @@ namespace IceInternal
         using MetricsMapTPtr = std::shared_ptr<MetricsMapT>;
 
         typedef IceMX::MetricsMap MetricsType::*SubMapMember;
+        using Histograms = MetricsHistogramsT<MetricsType>;
 
         class EntryT;
         using EntryTPtr = std::shared_ptr<EntryT>;
@@ -120,6 +197,18 @@ namespace IceInternal
                   _object(object),
                   _detachedPos(p)
             {
+                const auto& bounds = _map->_histogramBounds;
+                if (bounds)
+                {
+                    if constexpr (Histograms::lifetime != nullptr)
+                    {
+                        _lifetimeHistogram = std::make_unique<MetricsHistogramI>(bounds);
+                    }
+                    for (auto& histogram : _valueHistograms)
+                    {
+                        histogram = std::make_unique<MetricsHistogramI>(bounds);
+                    }
+                }
             }
 
             ~EntryT()
@@ -136,7 +225,7 @@ namespace IceInternal
 
             void failed(const std::string& exceptionName)
             {
-                std::lock_guard lock(_map->_mutex);
+                std::lock_guard lock(_mutex);
                 ++_object->failures;
                 ++_failures[exceptionName];
             }
@@ -147,7 +236,7 @@ namespace IceInternal
             {
                 MetricsMapIPtr m;
                 {
-                    std::lock_guard lock(_map->_mutex);
+                    std::lock_guard lock(_mutex);
                     typename std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember>>::iterator p =
                         _subMaps.find(mapName);
                     if (p == _subMaps.end())
@@ -170,19 +259,47 @@ namespace IceInternal
                 return map->getMatching(helper);
             }
 
+            // Records the given value with the value histogram set to the given member, this doesn't lock the map.
+            void record(typename Histograms::Member member, std::int64_t value)
+            {
+                for (std::size_t i = 0; i < Histograms::values.size(); ++i)
+                {
+                    if (Histograms::values[i] == member)
+                    {
+                        if (_valueHistograms[i])
+                        {
+                            _valueHistograms[i]->record(value);
+                        }
+                        return;
+                    }
+                }
+                assert(false); // The member is not a value histogram of this metrics type.
+            }
+
             void detach(std::int64_t lifetime)
             {
-                std::lock_guard lock(_map->_mutex);
-                _object->totalLifetime += lifetime;
-                if (--_object->current == 0)
+                if (_lifetimeHistogram)
+                {
+                    _lifetimeHistogram->record(lifetime);
+                }
+
+                bool detached;
+                {
+                    std::lock_guard lock(_mutex);
+                    _object->totalLifetime += lifetime;
+                    detached = --_object->current == 0;
+                }
+                if (detached)
                 {
+                    // The entry might be attached again before it's queued, the detached queue checks isDetached
+                    // before removing an entry from the map.
                     _map->detached(this->shared_from_this());
                 }
             }
 
             template<typename Function> void execute(Function func)
             {
-                std::lock_guard lock(_map->_mutex);
+                std::lock_guard lock(_mutex);
                 func(_object);
             }
 
@@ -191,6 +308,7 @@ namespace IceInternal
         private:
             IceMX::MetricsFailures getFailures() const
             {
+                std::lock_guard lock(_mutex);
                 IceMX::MetricsFailures f;
                 f.id = _object->id;
                 f.failures = _failures;
@@ -199,6 +317,7 @@ namespace IceInternal
 
             IceMX::MetricsPtr clone() const
             {
+                std::lock_guard lock(_mutex);
                 TPtr metrics = std::dynamic_pointer_cast<T>(_object->ice_clone());
                 for (typename std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember>>::const_iterator p =
                          _subMaps.begin();
@@ -207,16 +326,35 @@ namespace IceInternal
                 {
                     metrics.get()->*p->second.second = p->second.first->getMetrics();
                 }
+                if (_lifetimeHistogram)
+                {
+                    metrics.get()->*Histograms::lifetime = _lifetimeHistogram->get();
+                }
+                for (std::size_t i = 0; i < Histograms::values.size(); ++i)
+                {
+                    if (_valueHistograms[i])
+                    {
+                        metrics.get()->*Histograms::values[i] = _valueHistograms[i]->get();
+                    }
+                }
                 return metrics;
             }
 
-            bool isDetached() const { return _object->current == 0; }
+            bool isDetached() const
+            {
+                std::lock_guard lock(_mutex);
+                return _object->current == 0;
+            }
 
             void attach(const IceMX::MetricsHelperT<T>& helper)
             {
-                ++_object->total;
-                ++_object->current;
-                helper.initMetrics(_object);
+                {
+                    std::lock_guard lock(_mutex);
+                    ++_object->total;
+                    ++_object->current;
+                    helper.initMetrics(_object);
+                }
+                helper.initHistograms(*this);
             }
 
             friend class MetricsMapT;
@@ -224,7 +362,10 @@ namespace IceInternal
             TPtr _object;
             IceMX::StringIntDict _failures;
             std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember>> _subMaps;
-            typename std::list<EntryTPtr>::iterator _detachedPos;
+            typename std::list<EntryTPtr>::iterator _detachedPos; // Protected by the map _detachedMutex.
+            std::unique_ptr<MetricsHistogramI> _lifetimeHistogram;
+            std::array<std::unique_ptr<MetricsHistogramI>, Histograms::values.size()> _valueHistograms;
+            mutable std::mutex _mutex;
         };
 
         MetricsMapT(
@@ -232,7 +373,8 @@ namespace IceInternal
             const Ice::PropertiesPtr& properties,
             const std::map<std::string, std::pair<SubMapMember, MetricsMapFactoryPtr>>& subMaps)
             : MetricsMapI(mapPrefix, properties),
-              _destroyed(false)
+              _destroyed(false),
+              _cacheable(-1)
         {
             std::vector<std::string> subMapNames;
             typename std::map<std::string, std::pair<SubMapMember, MetricsMapFactoryPtr>>::const_iterator p;
@@ -258,7 +400,7 @@ namespace IceInternal
             }
         }
 
-        MetricsMapT(const MetricsMapT& other) : MetricsMapI(other), _destroyed(false) {}
+        MetricsMapT(const MetricsMapT& other) : MetricsMapI(other), _destroyed(false), _cacheable(-1) {}
 
         std::shared_ptr<MetricsMapT> shared_from_this()
         {
@@ -267,21 +409,34 @@ namespace IceInternal
 
         virtual void destroy()
         {
-            std::lock_guard lock(_mutex);
             _destroyed = true;
-            _objects.clear();       // Break cyclic reference counts
-            _detachedQueue.clear(); // Break cyclic reference counts
+
+            // Break cyclic reference counts. The entries are released once the locks are released since destroying
+            // an entry destroys its sub-maps.
+            std::vector<std::unordered_map<std::string, EntryTPtr>> objects(_shards.size());
+            std::list<EntryTPtr> detachedQueue;
+            {
+                std::lock_guard lock(_detachedMutex);
+                detachedQueue.swap(_detachedQueue);
+                for (auto& entry : detachedQueue)
+                {
+                    entry->_detachedPos = _detachedQueue.end();
+                }
+            }
+            for (std::size_t i = 0; i < _shards.size(); ++i)
+            {
+                std::lock_guard lock(_shards[i].mutex);
+                objects[i].swap(_shards[i].objects);
+                _shards[i].keys.clear();
+            }
         }
 
         virtual IceMX::MetricsMap getMetrics() const
         {
             IceMX::MetricsMap objects;
-
-            std::lock_guard lock(_mutex);
-            for (typename std::map<std::string, EntryTPtr>::const_iterator p = _objects.begin(); p != _objects.end();
-                 ++p)
+            for (const auto& entry : getEntries())
             {
-                objects.push_back(p->second->clone());
+                objects.push_back(entry->clone());
             }
             return objects;
         }
@@ -289,12 +444,9 @@ namespace IceInternal
         virtual IceMX::MetricsFailuresSeq getFailures()
         {
             IceMX::MetricsFailuresSeq failures;
-
-            std::lock_guard lock(_mutex);
-            for (typename std::map<std::string, EntryTPtr>::const_iterator p = _objects.begin(); p != _objects.end();
-                 ++p)
+            for (const auto& entry : getEntries())
             {
-                IceMX::MetricsFailures f = p->second->getFailures();
+                IceMX::MetricsFailures f = entry->getFailures();
                 if (!f.failures.empty())
                 {
                     failures.push_back(f);
@@ -305,13 +457,18 @@ namespace IceInternal
 
         virtual IceMX::MetricsFailures getFailures(const std::string& id)
         {
-            std::lock_guard lock(_mutex);
-            typename std::map<std::string, EntryTPtr>::const_iterator p = _objects.find(id);
-            if (p != _objects.end())
+            EntryTPtr entry;
             {
-                return p->second->getFailures();
+                const Shard& shard = getShard(id);
+                std::lock_guard lock(shard.mutex);
+                typename std::unordered_map<std::string, EntryTPtr>::const_iterator p = shard.objects.find(id);
+                if (p == shard.objects.end())
+                {
+                    return IceMX::MetricsFailures();
+                }
+                entry = p->second;
             }
-            return IceMX::MetricsFailures();
+            return entry->getFailures();
         }
 
         std::pair<MetricsMapIPtr, SubMapMember> createSubMap(const std::string& subMapName)
@@ -328,6 +485,142 @@ namespace IceInternal
         }
 
         EntryTPtr getMatching(const IceMX::MetricsHelperT<T>& helper, const EntryTPtr& previous = EntryTPtr())
+        {
+            std::optional<std::string> key = getKey(helper);
+            if (!key)
+            {
+                return nullptr;
+            }
+
+            //
+            // Lookup the metrics object.
+            //
+            Shard& shard = getShard(*key);
+            std::lock_guard lock(shard.mutex);
+            if (_destroyed)
+            {
+                return nullptr;
+            }
+
+            if (previous && previous->_object->id == *key)
+            {
+                assert(shard.objects[*key] == previous);
+                return previous;
+            }
+
+            typename std::unordered_map<std::string, EntryTPtr>::const_iterator p = shard.objects.find(*key);
+            if (p == shard.objects.end())
+            {
+                TPtr t = std::make_shared<T>();
+                t->id = *key;
+
+                p = shard.objects
+                        .insert(typename std::unordered_map<std::string, EntryTPtr>::value_type(
+                            *key,
+                            std::make_shared<EntryT>(shared_from_this(), t, _detachedQueue.end())))
+                        .first;
+            }
+            p->second->attach(helper);
+            return p->second;
+        }
+
+    private:
+        struct Shard
+        {
+            mutable std::mutex mutex;
+            std::unordered_map<std::string, EntryTPtr> objects;
+
+            // The cached keys of the metrics objects, indexed by the helper cache keys. The key is not set if the
+            // helper is rejected by the filters.
+            std::unordered_map<std::string, std::optional<std::string>> keys;
+        };
+
+        // The maximum number of cached keys of a shard, the cache is cleared when it's full.
+        static constexpr std::size_t maxCachedKeys = 1024;
+
+        virtual MetricsMapIPtr clone() const { return std::make_shared<MetricsMapT<MetricsType>>(*this); }
+
+        Shard& getShard(const std::string& key) { return _shards[std::hash<std::string>()(key) % _shards.size()]; }
+
+        const Shard& getShard(const std::string& key) const
+        {
+            return _shards[std::hash<std::string>()(key) % _shards.size()];
+        }
+
+        std::vector<EntryTPtr> getEntries() const
+        {
+            std::vector<EntryTPtr> entries;
+            for (const auto& shard : _shards)
+            {
+                std::lock_guard lock(shard.mutex);
+                for (const auto& p : shard.objects)
+                {
+                    entries.push_back(p.second);
+                }
+            }
+            std::sort(
+                entries.begin(),
+                entries.end(),
+                [](const EntryTPtr& lhs, const EntryTPtr& rhs) { return lhs->_object->id < rhs->_object->id; });
+            return entries;
+        }
+
+        // Returns true if the keys of this map can be cached with the helper cache key: the attributes used by the
+        // GroupBy, Accept and Reject properties must only depend on the cache key.
+        bool isCacheable(const IceMX::MetricsHelperT<T>& helper)
+        {
+            int cacheable = _cacheable;
+            if (cacheable < 0)
+            {
+                auto isCacheableAttribute = [&helper](const std::string& attribute)
+                { return attribute == "none" || helper.isCacheable(attribute); };
+
+                bool value = std::all_of(_groupByAttributes.begin(), _groupByAttributes.end(), isCacheableAttribute);
+                for (const auto& regExp : _accept)
+                {
+                    value = value && isCacheableAttribute(regExp->getAttribute());
+                }
+                for (const auto& regExp : _reject)
+                {
+                    value = value && isCacheableAttribute(regExp->getAttribute());
+                }
+                cacheable = value ? 1 : 0;
+                _cacheable = cacheable;
+            }
+            return cacheable > 0;
+        }
+
+        std::optional<std::string> getKey(const IceMX::MetricsHelperT<T>& helper)
+        {
+            if (!isCacheable(helper))
+            {
+                return computeKey(helper);
+            }
+
+            const std::string cacheKey = helper.getCacheKey();
+            Shard& shard = getShard(cacheKey);
+            {
+                std::lock_guard lock(shard.mutex);
+                typename std::unordered_map<std::string, std::optional<std::string>>::const_iterator p =
+                    shard.keys.find(cacheKey);
+                if (p != shard.keys.end())
+                {
+                    return p->second;
+                }
+            }
+
+            std::optional<std::string> key = computeKey(helper);
+
+            std::lock_guard lock(shard.mutex);
+            if (shard.keys.size() >= maxCachedKeys)
+            {
+                shard.keys.clear();
+            }
+            shard.keys.insert(make_pair(cacheKey, key));
+            return key;
+        }
+
+        std::optional<std::string> computeKey(const IceMX::MetricsHelperT<T>& helper) const
         {
             //
             // Check the accept and reject filters.
@@ -336,7 +629,7 @@ namespace IceInternal
             {
                 if (!(*p)->match(helper, false))
                 {
-                    return nullptr;
+                    return std::nullopt;
                 }
             }
 
@@ -344,19 +637,18 @@ namespace IceInternal
             {
                 if ((*p)->match(helper, true))
                 {
-                    return nullptr;
+                    return std::nullopt;
                 }
             }
 
             //
             // Compute the key from the GroupBy property.
             //
-            std::string key;
             try
             {
                 if (_groupByAttributes.size() == 1)
                 {
-                    key = helper(_groupByAttributes.front());
+                    return helper(_groupByAttributes.front());
                 }
                 else
                 {
@@ -372,51 +664,19 @@ namespace IceInternal
                             os << *q++;
                         }
                     }
-                    key = os.str();
+                    return os.str();
                 }
             }
             catch (const std::exception&)
             {
-                return nullptr;
+                return std::nullopt;
             }
-
-            //
-            // Lookup the metrics object.
-            //
-            std::lock_guard lock(_mutex);
-            if (_destroyed)
-            {
-                return nullptr;
-            }
-
-            if (previous && previous->_object->id == key)
-            {
-                assert(_objects[key] == previous);
-                return previous;
-            }
-
-            typename std::map<std::string, EntryTPtr>::const_iterator p = _objects.find(key);
-            if (p == _objects.end())
-            {
-                TPtr t = std::make_shared<T>();
-                t->id = key;
-
-                p = _objects
-                        .insert(typename std::map<std::string, EntryTPtr>::value_type(
-                            key,
-                            std::make_shared<EntryT>(shared_from_this(), t, _detachedQueue.end())))
-                        .first;
-            }
-            p->second->attach(helper);
-            return p->second;
         }
 
-    private:
-        virtual MetricsMapIPtr clone() const { return std::make_shared<MetricsMapT<MetricsType>>(*this); }
-
         void detached(EntryTPtr entry)
         {
-            // This is called with the map mutex locked.
+            EntryTPtr evicted; // Released once the locks are released.
+            std::lock_guard lock(_detachedMutex);
 
             if (_retain == 0 || _destroyed)
             {
@@ -455,26 +715,35 @@ namespace IceInternal
                 }
             }
 
-            // If there's still no room, remove the oldest entry (at the front).
+            // If there's still no room, remove the oldest entry (at the front). The entry is only removed from the
+            // map if it's still detached: it can't be attached again while the shard is locked.
             if (static_cast<int>(_detachedQueue.size()) == _retain)
             {
-                _objects.erase(_detachedQueue.front()->_object->id);
+                evicted = _detachedQueue.front();
+                evicted->_detachedPos = _detachedQueue.end();
                 _detachedQueue.pop_front();
+
+                Shard& shard = getShard(evicted->_object->id);
+                std::lock_guard shardLock(shard.mutex);
+                if (evicted->isDetached())
+                {
+                    shard.objects.erase(evicted->_object->id);
+                }
             }
 
             // Add the entry at the back of the queue.
             entry->_detachedPos = _detachedQueue.insert(_detachedQueue.end(), entry);
             assert(entry->_detachedPos != _detachedQueue.end());
-            return;
         }
 
         friend class EntryT;
 
-        bool _destroyed;
-        std::map<std::string, EntryTPtr> _objects;
+        std::atomic<bool> _destroyed;
+        std::atomic<int> _cacheable; // -1 if not computed yet, 0 or 1 otherwise.
+        std::array<Shard, 8> _shards;
         std::list<EntryTPtr> _detachedQueue;
+        std::mutex _detachedMutex;
         std::map<std::string, std::pair<SubMapMember, MetricsMapIPtr>> _subMaps;
-        mutable std::mutex _mutex;
     };
 
     template<class MetricsType> class MetricsMapFactoryT : public MetricsMapFactory
@@ -539,20 +808,11 @@ namespace IceInternal
 
         template<class MetricsType> void registerMap(const std::string& map, IceMX::Updater* updater)
         {
-            bool updated;
-            MetricsMapFactoryPtr factory;
-            {
-                std::lock_guard lock(_mutex);
-                factory = std::make_shared<MetricsMapFactoryT<MetricsType>>(updater);
-                _factories[map] = factory;
-                updated = addOrUpdateMap(map, factory);
-            }
-            if (updated)
-            {
-                factory->update();
-            }
+            registerMap(map, std::make_shared<MetricsMapFactoryT<MetricsType>>(updater));
         }
 
+        void registerMap(const std::string&, const MetricsMapFactoryPtr&);
+
         template<class MemberMetricsType, class MetricsType>
         void registerSubMap(const std::string& map, const std::string& subMap, IceMX::MetricsMap MetricsType::*member)
         {
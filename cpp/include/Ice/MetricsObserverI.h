@@ -61,6 +61,23 @@ namespace IceMX
             // To be overridden in specialization to initialize state attributes
         }
 
+        virtual void initHistograms(typename IceInternal::MetricsMapT<T>::EntryT&) const
+        {
+            // To be overridden in specialization to record the initial values of the value histograms
+        }
+
+        virtual bool isCacheable(const std::string&) const
+        {
+            // To be overridden in specialization to return true for the attributes which only depend on the cache key
+            return false;
+        }
+
+        virtual std::string getCacheKey() const
+        {
+            // To be overridden in specialization to return a key identifying the values of the cacheable attributes
+            return std::string();
+        }
+
     protected:
         template<typename Helper> class AttributeResolverT
         {
@@ -366,6 +383,14 @@ namespace IceMX
             }
         }
 
+        void record(typename IceInternal::MetricsHistogramsT<MetricsType>::Member member, std::int64_t value)
+        {
+            for (typename EntrySeqType::const_iterator p = _objects.begin(); p != _objects.end(); ++p)
+            {
+                (*p)->record(member, value);
+            }
+        }
+
         void init(const MetricsHelperT<MetricsType>& /*helper*/, EntrySeqType& objects, ObserverT* previous = 0)
         {
             _objects.swap(objects);
@@ -18,6 +18,7 @@
 #include "RequestHandlerF.h"
 
 #include <cassert>
+#include <chrono>
 #include <exception>
 #include <string_view>
 
@@ -166,10 +167,28 @@ namespace IceInternal
 
         virtual void runTimerTask();
 
+        enum class Completion : std::uint8_t
+        {
+            Pending,
+            Completed,
+            CompletedByHedge
+        };
+
+        // Claims the completion of an invocation that can be hedged, either for this invocation (byHedge = false) or
+        // for its hedged invocation. Returns false if the completion was already claimed by the other invocation.
+        bool claimCompletion(bool byHedge);
+
         const Ice::ObjectPrx _proxy;
         RequestHandlerPtr _handler;
         Ice::OperationMode _mode;
 
+        // The task sending the hedged invocation, set only for invocations that can be hedged.
+        Ice::TimerTaskPtr _hedgeTask;
+
+        // The hedged invocation and the claimed completion, protected by _m.
+        std::shared_ptr<ProxyOutgoingAsyncBase> _hedge;
+        Completion _completion;
+
     private:
         int handleRetryAfterException(std::exception_ptr);
         int checkRetryAfterException(std::exception_ptr);
@@ -196,7 +215,6 @@ namespace IceInternal
         virtual AsyncStatus invokeRemote(const Ice::ConnectionIPtr&, bool, bool);
         virtual AsyncStatus invokeCollocated(CollocatedRequestHandler*);
 
-        void abort(std::exception_ptr);
         void invoke(std::string_view);
         void invoke(
             std::string_view,
@@ -206,6 +224,12 @@ namespace IceInternal
             std::function<void(Ice::OutputStream*)>);
         void throwUserException();
 
+        // Sends a duplicate of this request, called when no reply was received within the hedging delay.
+        void hedge();
+
+        // Called with the connection locked when the duplicate sent by hedge() receives its reply.
+        void hedgeResponse(const std::shared_ptr<OutgoingAsync>&);
+
         Ice::OutputStream* startWriteParams(std::optional<Ice::FormatType> format)
         {
             _os.startEncapsulation(_encoding, format);
@@ -229,6 +253,17 @@ namespace IceInternal
         const Ice::EncodingVersion _encoding;
         std::function<void(const Ice::UserException&)> _userException;
         bool _synchronous;
+
+    private:
+        std::uint8_t readReplyStatus();
+        void completeWithHedge(const std::shared_ptr<OutgoingAsync>&);
+
+        // Set only for invocations that can be hedged: the key of the operation latencies and the invocation time.
+        std::optional<std::size_t> _hedgeKey;
+        std::chrono::steady_clock::time_point _invokeTime;
+
+        // The body of the request, after the header, copied when the hedge task is scheduled.
+        std::vector<std::byte> _hedgeRequestBody;
     };
 
     using OutgoingAsyncPtr = std::shared_ptr<OutgoingAsync>;
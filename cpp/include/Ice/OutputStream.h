@@ -7,6 +7,7 @@
 
 #include "Buffer.h"
 #include "CommunicatorF.h"
+#include "FileRange.h"
 #include "Ice/Format.h"
 #include "Ice/StringConverter.h"
 #include "Ice/Version.h"
@@ -399,9 +400,19 @@ namespace Ice
         template<typename T> void write(const T* begin, const T* end)
         {
             writeSize(static_cast<std::int32_t>(end - begin));
-            for (const T* p = begin; p != end; ++p)
+            if constexpr (IsBitwiseStreamable<T>::value)
             {
-                write(*p);
+                if (begin != end)
+                {
+                    writeBlob(reinterpret_cast<const std::byte*>(begin), sizeof(T) * static_cast<size_t>(end - begin));
+                }
+            }
+            else
+            {
+                for (const T* p = begin; p != end; ++p)
+                {
+                    write(*p);
+                }
             }
         }
 
@@ -504,6 +515,12 @@ namespace Ice
          */
         void write(const std::uint8_t* start, const std::uint8_t* end);
 
+        /**
+         * Writes a byte sequence read from a file to the stream. The bytes are read directly into the stream's buffer.
+         * @param v The file range to write.
+         */
+        void write(const FileRange& v);
+
         /**
          * Writes a boolean to the stream.
          * @param v The boolean to write.
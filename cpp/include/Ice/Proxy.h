@@ -100,6 +100,15 @@ namespace Ice
          */
         Prx ice_connectionCached(bool b) const { return fromReference(asPrx()._connectionCached(b)); }
 
+        /**
+         * Obtains a proxy that is identical to this proxy, except for the size of its connection pool. With a pool
+         * size greater than 1, the proxy establishes up to this number of connections to each endpoint and sends
+         * each invocation over the connection with the fewest outstanding requests.
+         * @param size The connection pool size, which must be greater than 0.
+         * @return A proxy with the specified connection pool size.
+         */
+        Prx ice_connectionPoolSize(int size) const { return fromReference(asPrx()._connectionPoolSize(size)); }
+
         /**
          * Obtains a proxy that is identical to this proxy, except for its connection ID.
          * @param id The connection ID for the new proxy. An empty string removes the
@@ -623,6 +632,12 @@ namespace Ice
          */
         bool ice_isConnectionCached() const noexcept;
 
+        /**
+         * Obtains the size of the connection pool of this proxy.
+         * @return The maximum number of connections to each endpoint used by this proxy.
+         */
+        std::int32_t ice_getConnectionPoolSize() const noexcept;
+
         /**
          * Obtains the endpoint selection policy for this proxy (randomly or ordered).
          * @return The endpoint selection policy.
@@ -778,6 +793,7 @@ namespace Ice
         IceInternal::ReferencePtr _compress(bool) const;
         IceInternal::ReferencePtr _connectionCached(bool) const;
         IceInternal::ReferencePtr _connectionId(std::string) const;
+        IceInternal::ReferencePtr _connectionPoolSize(int) const;
         IceInternal::ReferencePtr _context(Context) const;
         IceInternal::ReferencePtr _datagram() const;
         IceInternal::ReferencePtr _encodingVersion(EncodingVersion) const;
@@ -8,6 +8,7 @@
 #include "InputStream.h"
 #include "OutputStream.h"
 
+#include <cstring>
 #include <iterator>
 
 #if __has_include(<span>)
@@ -145,11 +146,24 @@ namespace Ice
 
         static void read(InputStream* stream, T& v)
         {
-            std::int32_t sz = stream->readAndCheckSeqSize(StreamableTraits<typename T::value_type>::minWireSize);
+            using E = typename T::value_type;
+            std::int32_t sz = stream->readAndCheckSeqSize(StreamableTraits<E>::minWireSize);
             T(static_cast<size_t>(sz)).swap(v);
-            for (typename T::iterator p = v.begin(); p != v.end(); ++p)
+            if constexpr (IsBitwiseStreamable<E>::value && std::is_same_v<T, std::vector<E>>)
             {
-                stream->read(*p);
+                if (sz > 0)
+                {
+                    const std::byte* p;
+                    stream->readBlob(p, sizeof(E) * v.size());
+                    memcpy(v.data(), p, sizeof(E) * v.size());
+                }
+            }
+            else
+            {
+                for (typename T::iterator p = v.begin(); p != v.end(); ++p)
+                {
+                    stream->read(*p);
+                }
             }
         }
     };
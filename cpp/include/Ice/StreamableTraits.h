@@ -9,6 +9,7 @@
 
 #include <optional>
 #include <string_view>
+#include <type_traits>
 
 namespace Ice
 {
@@ -102,6 +103,31 @@ namespace Ice
         static const bool value = IsContainer<T>::value && sizeof(test<T>(0)) == sizeof(char);
     };
 
+    /**
+     * Determines whether the in-memory representation of T is identical to its encoding, in which case sequences of T
+     * are marshaled with a single copy. slice2cpp generates specializations for the structs whose data members are
+     * all byte, short, int, long, float, double or such structs.
+     * \headerfile Ice/Ice.h
+     */
+    template<typename T> struct IsBitwiseStreamable
+    {
+        static const bool value = false;
+    };
+
+    /**
+     * Base for the IsBitwiseStreamable specializations generated by slice2cpp. The struct T is bitwise streamable if
+     * it's trivially copyable, has no padding (its size is the size of its encoding) and the host is little-endian.
+     * \headerfile Ice/Ice.h
+     */
+    template<typename T, int wireSize> struct IsBitwiseStreamableStruct
+    {
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        static const bool value = sizeof(T) == wireSize && std::is_trivially_copyable_v<T>;
+#else
+        static const bool value = false; // The encoding is little-endian.
+#endif
+    };
+
     /**
      * Base traits template. Types with no specialized trait use this trait.
      * \headerfile Ice/Ice.h
@@ -0,0 +1,305 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_TASK_H
+#define ICE_TASK_H
+
+#include "Config.h"
+
+#ifdef ICE_HAS_COROUTINES
+
+#    include "OutgoingAsync.h"
+
+#    include <coroutine>
+#    include <exception>
+#    include <functional>
+#    include <memory>
+#    include <mutex>
+#    include <optional>
+#    include <type_traits>
+
+namespace Ice
+{
+    template<typename T = void> class Task;
+}
+
+namespace IceInternal
+{
+    // The type of the response callback of a task.
+    template<typename T> struct TaskResponse
+    {
+        using type = std::function<void(T)>;
+    };
+
+    template<> struct TaskResponse<void>
+    {
+        using type = std::function<void()>;
+    };
+
+    // The state shared by a task, the coroutine or invocation that completes the task and the awaiting coroutine.
+    class TaskStateBase
+    {
+    public:
+        bool completed()
+        {
+            std::lock_guard lock(_mutex);
+            return _completed;
+        }
+
+        // Sets the function called when the task completes. Returns false if the task is already completed, in which
+        // case the continuation is not set.
+        bool setContinuation(std::function<void()> continuation)
+        {
+            std::lock_guard lock(_mutex);
+            if (_completed)
+            {
+                return false;
+            }
+            _continuation = std::move(continuation);
+            return true;
+        }
+
+        void setException(std::exception_ptr ex) noexcept { _exception = ex; }
+
+        std::exception_ptr exception() const noexcept { return _exception; }
+
+        // Completes the task once its result or exception is set and calls the continuation, if any.
+        void complete()
+        {
+            std::function<void()> continuation;
+            {
+                std::lock_guard lock(_mutex);
+                assert(!_completed);
+                _completed = true;
+                continuation = std::move(_continuation);
+            }
+            if (continuation)
+            {
+                continuation();
+            }
+        }
+
+    protected:
+        std::mutex _mutex;
+        bool _completed = false;
+        std::exception_ptr _exception;
+        std::function<void()> _continuation;
+    };
+
+    template<typename T> class TaskState final : public TaskStateBase
+    {
+    public:
+        void setValue(T value) { _value.emplace(std::move(value)); }
+
+        T get()
+        {
+            if (_exception)
+            {
+                std::rethrow_exception(_exception);
+            }
+            return std::move(*_value);
+        }
+
+    private:
+        std::optional<T> _value;
+    };
+
+    template<> class TaskState<void> final : public TaskStateBase
+    {
+    public:
+        void get()
+        {
+            if (_exception)
+            {
+                std::rethrow_exception(_exception);
+            }
+        }
+    };
+
+    template<typename T> class TaskPromiseBase
+    {
+    public:
+        Ice::Task<T> get_return_object() { return Ice::Task<T>{_state}; }
+
+        // The coroutine starts running immediately, like a function.
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+
+        // The coroutine frame is destroyed before the task completes: the continuation doesn't run with the locals
+        // of the coroutine still alive.
+        auto final_suspend() const noexcept
+        {
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                void await_suspend(std::coroutine_handle<> handle) noexcept
+                {
+                    std::shared_ptr<TaskState<T>> state = std::move(_state);
+                    handle.destroy();
+                    state->complete();
+                }
+
+                void await_resume() const noexcept {}
+
+                std::shared_ptr<TaskState<T>> _state;
+            };
+            return FinalAwaiter{_state};
+        }
+
+        void unhandled_exception() noexcept { _state->setException(std::current_exception()); }
+
+    protected:
+        const std::shared_ptr<TaskState<T>> _state = std::make_shared<TaskState<T>>();
+    };
+
+    template<typename T> class TaskPromise final : public TaskPromiseBase<T>
+    {
+    public:
+        void return_value(T value) { this->_state->setValue(std::move(value)); }
+    };
+
+    template<> class TaskPromise<void> final : public TaskPromiseBase<void>
+    {
+    public:
+        void return_void() const noexcept {}
+    };
+}
+
+namespace Ice
+{
+    /**
+     * The tag type of Ice::useTask.
+     * \headerfile Ice/Ice.h
+     */
+    struct UseTask
+    {
+    };
+
+    /**
+     * Selects the overload of a proxy asynchronous operation that returns a Task, for example:
+     * `auto result = co_await prx->opAsync(arg, Ice::useTask);`
+     */
+    inline constexpr UseTask useTask{};
+
+    /**
+     * The result of an asynchronous operation that can be awaited by a coroutine with co_await. Task is also the
+     * coroutine type of Slice operations with the "cpp:coroutine" metadata, a servant implements these operations
+     * with coroutines that return a Task.
+     *
+     * A coroutine returning a Task starts immediately and runs until it completes or suspends. The coroutine awaiting
+     * a Task resumes on the thread that completes the task: for a proxy invocation, this is the thread that calls the
+     * response callbacks, an Ice thread pool thread or the executor thread if the communicator is configured with an
+     * executor. A Task can only be awaited once, or consumed once with then.
+     * @tparam T The type of the result, void for operations without a result.
+     * \headerfile Ice/Ice.h
+     */
+    template<typename T> class [[nodiscard]] Task
+    {
+    public:
+        /// \cond INTERNAL
+        using promise_type = IceInternal::TaskPromise<T>;
+
+        explicit Task(std::shared_ptr<IceInternal::TaskState<T>> state) : _state(std::move(state)) {}
+        /// \endcond
+
+        /**
+         * Returns true if the task is completed.
+         * @return True if the task is completed, false otherwise.
+         */
+        bool await_ready() const { return _state->completed(); }
+
+        /// \cond INTERNAL
+        bool await_suspend(std::coroutine_handle<> continuation)
+        {
+            return _state->setContinuation([continuation] { continuation.resume(); });
+        }
+        /// \endcond
+
+        /**
+         * Returns the result of the completed task or throws the exception it completed with.
+         * @return The result of the task.
+         */
+        T await_resume() { return _state->get(); }
+
+        /**
+         * Calls the given callbacks when the task completes, the callbacks are called immediately if the task is
+         * already completed.
+         * @param response The callback called with the result of the task.
+         * @param exception The callback called with the exception the task completed with.
+         */
+        void then(
+            typename IceInternal::TaskResponse<T>::type response,
+            std::function<void(std::exception_ptr)> exception)
+        {
+            std::function<void()> continuation =
+                [state = _state, response = std::move(response), exception = std::move(exception)]
+            {
+                if (std::exception_ptr ex = state->exception())
+                {
+                    exception(ex);
+                }
+                else if constexpr (std::is_void_v<T>)
+                {
+                    response();
+                }
+                else
+                {
+                    response(state->get());
+                }
+            };
+
+            if (!_state->setContinuation(continuation))
+            {
+                continuation();
+            }
+        }
+
+    private:
+        std::shared_ptr<IceInternal::TaskState<T>> _state;
+    };
+}
+
+namespace IceInternal
+{
+    template<typename R, typename Obj, typename Fn, typename... Args>
+    inline Ice::Task<R> makeTaskOutgoing(Obj obj, Fn fn, Args&&... args)
+    {
+        auto state = std::make_shared<TaskState<R>>();
+        typename TaskResponse<R>::type response;
+        std::function<void(bool)> sent;
+        if constexpr (std::is_void_v<R>)
+        {
+            response = [state] { state->complete(); };
+            if (!obj->ice_isTwoway())
+            {
+                // There's no response for oneway and batch oneway invocations, the task completes once sent.
+                sent = [state](bool) { state->complete(); };
+            }
+        }
+        else
+        {
+            response = [state](R value)
+            {
+                state->setValue(std::move(value));
+                state->complete();
+            };
+        }
+
+        auto outAsync = std::make_shared<LambdaOutgoing<R>>(
+            *obj,
+            std::move(response),
+            [state](std::exception_ptr ex)
+            {
+                state->setException(ex);
+                state->complete();
+            },
+            std::move(sent));
+        (obj->*fn)(outAsync, std::forward<Args>(args)...);
+        return Ice::Task<R>{std::move(state)};
+    }
+}
+
+#endif
+
+#endif
@@ -5,6 +5,7 @@
 #include "BatchRequestQueue.h"
 #include "Ice/Properties.h"
 #include "Ice/Proxy.h"
+#include "Ice/Timer.h"
 #include "Instance.h"
 #include "Reference.h"
 
@@ -41,15 +42,38 @@ namespace
         const string_view _operation;
         const int _size;
     };
+
+    class FlushTimerTask final : public Ice::TimerTask
+    {
+    public:
+        FlushTimerTask(const BatchRequestQueuePtr& queue, const Ice::ObjectPrx& proxy) : _queue(queue), _proxy(proxy)
+        {
+        }
+
+        void runTimerTask() final
+        {
+            if (auto queue = _queue.lock())
+            {
+                queue->flushTimedOut(_proxy);
+            }
+        }
+
+    private:
+        const weak_ptr<BatchRequestQueue> _queue;
+        const Ice::ObjectPrx _proxy;
+    };
 }
 
 BatchRequestQueue::BatchRequestQueue(const InstancePtr& instance, bool datagram)
-    : _interceptor(instance->initializationData().batchRequestInterceptor),
+    : _instance(instance),
+      _interceptor(instance->initializationData().batchRequestInterceptor),
       _batchStream(instance.get(), Ice::currentProtocolEncoding),
       _batchStreamInUse(false),
       _batchStreamCanFlush(false),
       _batchCompress(false),
-      _batchRequestNum(0)
+      _batchRequestNum(0),
+      _flushDelay(instance->batchAutoFlushDelay()),
+      _flushScheduled(false)
 {
     _batchStream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
     _batchMarker = _batchStream.b.size();
@@ -68,28 +92,52 @@ BatchRequestQueue::BatchRequestQueue(const InstancePtr& instance, bool datagram)
 }
 
 void
-BatchRequestQueue::prepareBatchRequest(OutputStream* os)
+BatchRequestQueue::prepareBatchRequest(OutputStream*)
 {
-    unique_lock lock(_mutex);
+    //
+    // The request is marshaled into the stream of the invocation, without holding the lock, and it's only added to
+    // the batch stream by finishBatchRequest. Threads batching requests concurrently therefore don't wait for each
+    // other while marshaling.
+    //
+    lock_guard lock(_mutex);
     if (_exception)
     {
         rethrow_exception(_exception);
     }
-    _conditionVariable.wait(lock, [this] { return !_batchStreamInUse; });
-
-    _batchStreamInUse = true;
-    _batchStream.swap(*os);
 }
 
 void
 BatchRequestQueue::finishBatchRequest(OutputStream* os, const Ice::ObjectPrx& proxy, string_view operation)
 {
+    unique_lock lock(_mutex);
+    _conditionVariable.wait(lock, [this] { return !_batchStreamInUse; });
+    assert(_batchMarker == _batchStream.b.size());
+
+    if (!_interceptor && (_maxSize == 0 || _batchStream.b.size() + os->b.size() < _maxSize))
+    {
+        //
+        // Fast path: without interceptor and if the batch doesn't need to be flushed, the request is added to the
+        // batch with the lock held.
+        //
+        _batchStream.writeBlob(os->b.begin(), os->b.size());
+        optional<bool> compress = proxy->_getReference()->getCompressOverride();
+        if (compress.has_value())
+        {
+            _batchCompress |= *compress;
+        }
+        _batchMarker = _batchStream.b.size();
+        ++_batchRequestNum;
+        scheduleFlush(proxy);
+        return;
+    }
+
     //
-    // No need for synchronization, no other threads are supposed
-    // to modify the queue since we set _batchStreamInUse to true.
+    // Otherwise, the interceptor is called and the batch is flushed without the lock held. No other threads are
+    // supposed to modify the queue since we set _batchStreamInUse to true.
     //
-    assert(_batchStreamInUse);
-    _batchStream.swap(*os);
+    _batchStreamInUse = true;
+    _batchStream.writeBlob(os->b.begin(), os->b.size());
+    lock.unlock();
 
     try
     {
@@ -122,6 +170,7 @@ BatchRequestQueue::finishBatchRequest(OutputStream* os, const Ice::ObjectPrx& pr
         _batchStreamInUse = false;
         _batchStreamCanFlush = false;
         _conditionVariable.notify_all();
+        scheduleFlush(proxy);
     }
     catch (const std::exception&)
     {
@@ -134,19 +183,6 @@ BatchRequestQueue::finishBatchRequest(OutputStream* os, const Ice::ObjectPrx& pr
     }
 }
 
-void
-BatchRequestQueue::abortBatchRequest(OutputStream* os)
-{
-    lock_guard lock(_mutex);
-    if (_batchStreamInUse)
-    {
-        _batchStream.swap(*os);
-        _batchStream.resize(_batchMarker);
-        _batchStreamInUse = false;
-        _conditionVariable.notify_all();
-    }
-}
-
 int
 BatchRequestQueue::swap(OutputStream* os, bool& compress)
 {
@@ -174,6 +210,7 @@ BatchRequestQueue::swap(OutputStream* os, bool& compress)
     //
     _batchRequestNum = 0;
     _batchCompress = false;
+    _batchStart = chrono::steady_clock::time_point();
     _batchStream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
     _batchMarker = _batchStream.b.size();
     if (!lastRequest.empty())
@@ -209,3 +246,69 @@ BatchRequestQueue::enqueueBatchRequest(const Ice::ObjectPrx& proxy)
     _batchMarker = _batchStream.b.size();
     ++_batchRequestNum;
 }
+
+void
+BatchRequestQueue::flushTimedOut(const Ice::ObjectPrx& proxy)
+{
+    {
+        lock_guard lock(_mutex);
+        assert(_flushScheduled);
+        if (_exception || _batchRequestNum == 0)
+        {
+            _flushScheduled = false;
+            return;
+        }
+
+        //
+        // If the batch was flushed and new requests were queued since the timer was scheduled, wait for the
+        // oldest of these requests to reach the delay.
+        //
+        auto delay = _batchStart + _flushDelay - chrono::steady_clock::now();
+        if (delay > chrono::steady_clock::duration::zero())
+        {
+            try
+            {
+                _instance->timer()->schedule(make_shared<FlushTimerTask>(shared_from_this(), proxy), delay);
+                return;
+            }
+            catch (const std::exception&)
+            {
+                // Communicator destroyed.
+            }
+        }
+        _flushScheduled = false;
+    }
+
+    proxy->ice_flushBatchRequestsAsync();
+}
+
+void
+BatchRequestQueue::scheduleFlush(const Ice::ObjectPrx& proxy)
+{
+    //
+    // Must be called with _mutex locked. The timer is only scheduled when the batch goes from empty to non-empty,
+    // queuing additional requests doesn't require any timer operation.
+    //
+    if (_flushDelay == chrono::milliseconds::zero() || _batchRequestNum == 0)
+    {
+        return;
+    }
+
+    if (_batchStart == chrono::steady_clock::time_point())
+    {
+        _batchStart = chrono::steady_clock::now();
+    }
+
+    if (!_flushScheduled)
+    {
+        try
+        {
+            _instance->timer()->schedule(make_shared<FlushTimerTask>(shared_from_this(), proxy), _flushDelay);
+            _flushScheduled = true;
+        }
+        catch (const std::exception&)
+        {
+            // Communicator destroyed.
+        }
+    }
+}
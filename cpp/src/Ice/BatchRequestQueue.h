@@ -10,19 +10,19 @@
 #include "Ice/InstanceF.h"
 #include "Ice/OutputStream.h"
 
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 
 namespace IceInternal
 {
-    class BatchRequestQueue
+    class BatchRequestQueue : public std::enable_shared_from_this<BatchRequestQueue>
     {
     public:
         BatchRequestQueue(const InstancePtr&, bool);
 
         void prepareBatchRequest(Ice::OutputStream*);
         void finishBatchRequest(Ice::OutputStream*, const Ice::ObjectPrx&, std::string_view);
-        void abortBatchRequest(Ice::OutputStream*);
 
         int swap(Ice::OutputStream*, bool&);
 
@@ -31,7 +31,12 @@ namespace IceInternal
 
         void enqueueBatchRequest(const Ice::ObjectPrx&);
 
+        void flushTimedOut(const Ice::ObjectPrx&);
+
     private:
+        void scheduleFlush(const Ice::ObjectPrx&);
+
+        const InstancePtr _instance;
         std::function<void(const Ice::BatchRequest&, int, int)> _interceptor;
         Ice::OutputStream _batchStream;
         bool _batchStreamInUse;
@@ -41,6 +46,9 @@ namespace IceInternal
         size_t _batchMarker;
         std::exception_ptr _exception;
         size_t _maxSize;
+        const std::chrono::milliseconds _flushDelay;
+        std::chrono::steady_clock::time_point _batchStart;
+        bool _flushScheduled;
 
         std::mutex _mutex;
         std::condition_variable _conditionVariable;
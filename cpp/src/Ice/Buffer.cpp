@@ -3,6 +3,7 @@
 //
 
 #include "Ice/Buffer.h"
+#include "BufferPool.h"
 #include "Ice/LocalExceptions.h"
 
 #include <cstring>
@@ -113,7 +114,7 @@ IceInternal::Buffer::Container::~Container()
 {
     if (_buf && _owned)
     {
-        ::free(_buf);
+        deallocateBuffer(_buf, _capacity);
     }
 }
 
@@ -132,7 +133,7 @@ IceInternal::Buffer::Container::clear()
 {
     if (_buf && _owned)
     {
-        ::free(_buf);
+        deallocateBuffer(_buf, _capacity);
     }
 
     _buf = nullptr;
@@ -160,17 +161,34 @@ IceInternal::Buffer::Container::reserve(size_type n)
         return;
     }
 
+    //
+    // Round up the capacity to the size of its buffer pool size class. Buffers which are too large to be pooled are
+    // still grown with realloc.
+    //
+    _capacity = bufferPoolCapacity(_capacity);
+    if (_capacity == c)
+    {
+        return;
+    }
+
     pointer p;
-    if (_owned)
+    if (_owned && !isPooledBuffer(c) && !isPooledBuffer(_capacity))
     {
         p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
     }
     else
     {
-        p = reinterpret_cast<pointer>(::malloc(_capacity));
+        p = allocateBuffer(_capacity);
         if (p)
         {
-            ::memcpy(p, _buf, _size);
+            if (_size > 0)
+            {
+                ::memcpy(p, _buf, std::min(_size, _capacity));
+            }
+            if (_owned)
+            {
+                deallocateBuffer(_buf, c);
+            }
             _owned = true;
         }
     }
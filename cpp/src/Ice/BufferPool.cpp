@@ -0,0 +1,382 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "BufferPool.h"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <set>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+    // The size classes are the powers of two from 256 bytes to 64KB.
+    const size_t minSizeClassShift = 8;
+    const size_t maxSizeClassShift = 16;
+    const size_t sizeClassCount = maxSizeClassShift - minSizeClassShift + 1;
+    const size_t minSizeClass = size_t(1) << minSizeClassShift;
+    const size_t maxSizeClass = size_t(1) << maxSizeClassShift;
+
+    size_t sizeClassIndex(size_t capacity)
+    {
+        assert(isPooledBuffer(capacity));
+        size_t index = 0;
+        while ((minSizeClass << index) < capacity)
+        {
+            ++index;
+        }
+        return index;
+    }
+
+    // A thread caches up to 32KB of unused buffers for each size class, and at least 2 buffers.
+    size_t threadCacheLimit(size_t index) { return max<size_t>(2, (32 * 1024) >> (index + minSizeClassShift)); }
+
+    // The depot holds up to 8 times the thread cache limit for each size class.
+    size_t depotLimit(size_t index) { return 8 * threadCacheLimit(index); }
+
+    // The counters are only updated by the thread owning the cache and read by getBufferPoolStats.
+    void increment(atomic<int64_t>& counter)
+    {
+        counter.store(counter.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    }
+
+    struct SizeClassCounters
+    {
+        atomic<int64_t> hits{0};
+        atomic<int64_t> misses{0};
+        atomic<int64_t> allocated{0};
+        atomic<int64_t> released{0};
+        atomic<int64_t> held{0};
+    };
+
+    struct ThreadCache
+    {
+        ThreadCache()
+        {
+            // Reserve the memory of the free lists upfront, releasing a buffer must not allocate.
+            for (size_t i = 0; i < sizeClassCount; ++i)
+            {
+                buffers[i].reserve(threadCacheLimit(i) + 1);
+            }
+        }
+
+        array<vector<byte*>, sizeClassCount> buffers;
+        array<SizeClassCounters, sizeClassCount> counters;
+    };
+
+    class Depot
+    {
+    public:
+        Depot()
+        {
+            for (size_t i = 0; i < sizeClassCount; ++i)
+            {
+                _buffers[i].reserve(depotLimit(i));
+            }
+        }
+
+        void registerCache(ThreadCache* cache)
+        {
+            lock_guard lock(_mutex);
+            _caches.insert(cache);
+        }
+
+        void unregisterCache(ThreadCache* cache)
+        {
+            lock_guard lock(_mutex);
+            _caches.erase(cache);
+            for (size_t i = 0; i < sizeClassCount; ++i)
+            {
+                release(i, cache->buffers[i], 0);
+                const SizeClassCounters& counters = cache->counters[i];
+                _totals[i].hits += counters.hits.load(memory_order_relaxed);
+                _totals[i].misses += counters.misses.load(memory_order_relaxed);
+                _totals[i].allocated += counters.allocated.load(memory_order_relaxed);
+                _totals[i].released += counters.released.load(memory_order_relaxed);
+            }
+        }
+
+        // Moves up to count buffers from the depot to the given thread cache.
+        void refill(size_t index, vector<byte*>& buffers, size_t count)
+        {
+            lock_guard lock(_mutex);
+            vector<byte*>& depot = _buffers[index];
+            while (count-- > 0 && !depot.empty())
+            {
+                buffers.push_back(depot.back());
+                depot.pop_back();
+            }
+        }
+
+        // Moves the buffers of the given thread cache to the depot until the cache holds the given number of buffers.
+        void drain(size_t index, vector<byte*>& buffers, size_t keep)
+        {
+            lock_guard lock(_mutex);
+            release(index, buffers, keep);
+        }
+
+        // Allocates a buffer for a thread without cache (the thread is terminating).
+        byte* allocate(size_t index, size_t capacity)
+        {
+            lock_guard lock(_mutex);
+            byte* p;
+            if (_buffers[index].empty())
+            {
+                p = static_cast<byte*>(::malloc(capacity));
+                if (!p)
+                {
+                    return nullptr;
+                }
+                ++_totals[index].misses;
+            }
+            else
+            {
+                p = _buffers[index].back();
+                _buffers[index].pop_back();
+                ++_totals[index].hits;
+            }
+            ++_totals[index].allocated;
+            return p;
+        }
+
+        // Releases a buffer for a thread without cache (the thread is terminating).
+        void deallocate(size_t index, byte* p)
+        {
+            lock_guard lock(_mutex);
+            if (_buffers[index].size() < depotLimit(index))
+            {
+                _buffers[index].push_back(p);
+            }
+            else
+            {
+                ::free(p);
+            }
+            ++_totals[index].released;
+        }
+
+        vector<BufferPoolStats> getStats()
+        {
+            lock_guard lock(_mutex);
+            vector<BufferPoolStats> stats;
+            for (size_t i = 0; i < sizeClassCount; ++i)
+            {
+                BufferPoolStats s;
+                s.size = minSizeClass << i;
+                s.hits = _totals[i].hits;
+                s.misses = _totals[i].misses;
+                int64_t allocated = _totals[i].allocated;
+                int64_t released = _totals[i].released;
+                int64_t held = static_cast<int64_t>(_buffers[i].size());
+                for (const auto& cache : _caches)
+                {
+                    const SizeClassCounters& counters = cache->counters[i];
+                    s.hits += counters.hits.load(memory_order_relaxed);
+                    s.misses += counters.misses.load(memory_order_relaxed);
+                    allocated += counters.allocated.load(memory_order_relaxed);
+                    released += counters.released.load(memory_order_relaxed);
+                    held += counters.held.load(memory_order_relaxed);
+                }
+                s.inUse = allocated - released;
+                s.bytesHeld = held * static_cast<int64_t>(s.size);
+                stats.push_back(s);
+            }
+            return stats;
+        }
+
+    private:
+        // Must be called with the mutex locked.
+        void release(size_t index, vector<byte*>& buffers, size_t keep)
+        {
+            vector<byte*>& depot = _buffers[index];
+            while (buffers.size() > keep)
+            {
+                if (depot.size() < depotLimit(index))
+                {
+                    depot.push_back(buffers.back());
+                }
+                else
+                {
+                    ::free(buffers.back());
+                }
+                buffers.pop_back();
+            }
+        }
+
+        struct Totals
+        {
+            int64_t hits = 0;
+            int64_t misses = 0;
+            int64_t allocated = 0;
+            int64_t released = 0;
+        };
+
+        mutex _mutex;
+        array<vector<byte*>, sizeClassCount> _buffers;
+        array<Totals, sizeClassCount> _totals;
+        set<ThreadCache*> _caches;
+    };
+
+    // The depot is never destroyed, buffers can be released by static destructors.
+    Depot& depot()
+    {
+        static Depot* depot = new Depot;
+        return *depot;
+    }
+
+    struct ThreadCacheHolder
+    {
+        ~ThreadCacheHolder();
+
+        ThreadCache* cache = nullptr;
+    };
+
+    // Set once the cache of the thread is destroyed, buffers allocated or released afterwards by the destructors of
+    // other thread local objects use the depot directly.
+    thread_local bool threadCacheDestroyed = false;
+    thread_local ThreadCacheHolder threadCacheHolder;
+
+    ThreadCacheHolder::~ThreadCacheHolder()
+    {
+        if (cache)
+        {
+            depot().unregisterCache(cache);
+            delete cache;
+            cache = nullptr;
+        }
+        threadCacheDestroyed = true;
+    }
+
+    ThreadCache* getThreadCache()
+    {
+        if (threadCacheDestroyed)
+        {
+            return nullptr;
+        }
+
+        if (!threadCacheHolder.cache)
+        {
+            try
+            {
+                auto cache = make_unique<ThreadCache>();
+                depot().registerCache(cache.get());
+                threadCacheHolder.cache = cache.release();
+            }
+            catch (const std::bad_alloc&)
+            {
+                return nullptr; // Use the depot directly.
+            }
+        }
+        return threadCacheHolder.cache;
+    }
+}
+
+size_t
+IceInternal::bufferPoolCapacity(size_t size)
+{
+    if (size > maxSizeClass)
+    {
+        return size;
+    }
+
+    size_t capacity = minSizeClass;
+    while (capacity < size)
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+bool
+IceInternal::isPooledBuffer(size_t capacity)
+{
+    return capacity >= minSizeClass && capacity <= maxSizeClass && (capacity & (capacity - 1)) == 0;
+}
+
+byte*
+IceInternal::allocateBuffer(size_t capacity)
+{
+    if (!isPooledBuffer(capacity))
+    {
+        return static_cast<byte*>(::malloc(capacity));
+    }
+
+    size_t index = sizeClassIndex(capacity);
+    ThreadCache* cache = getThreadCache();
+    if (!cache)
+    {
+        return depot().allocate(index, capacity);
+    }
+
+    vector<byte*>& buffers = cache->buffers[index];
+    SizeClassCounters& counters = cache->counters[index];
+    if (buffers.empty())
+    {
+        depot().refill(index, buffers, threadCacheLimit(index) / 2);
+    }
+
+    byte* p;
+    if (buffers.empty())
+    {
+        p = static_cast<byte*>(::malloc(capacity));
+        if (!p)
+        {
+            return nullptr;
+        }
+        increment(counters.misses);
+    }
+    else
+    {
+        p = buffers.back();
+        buffers.pop_back();
+        increment(counters.hits);
+    }
+    increment(counters.allocated);
+    counters.held.store(static_cast<int64_t>(buffers.size()), memory_order_relaxed);
+    return p;
+}
+
+void
+IceInternal::deallocateBuffer(byte* p, size_t capacity)
+{
+    if (!p)
+    {
+        return;
+    }
+
+    if (!isPooledBuffer(capacity))
+    {
+        ::free(p);
+        return;
+    }
+
+    size_t index = sizeClassIndex(capacity);
+    ThreadCache* cache = getThreadCache();
+    if (!cache)
+    {
+        depot().deallocate(index, p);
+        return;
+    }
+
+    vector<byte*>& buffers = cache->buffers[index];
+    SizeClassCounters& counters = cache->counters[index];
+    buffers.push_back(p);
+    if (buffers.size() > threadCacheLimit(index))
+    {
+        depot().drain(index, buffers, threadCacheLimit(index) / 2);
+    }
+    increment(counters.released);
+    counters.held.store(static_cast<int64_t>(buffers.size()), memory_order_relaxed);
+}
+
+vector<BufferPoolStats>
+IceInternal::getBufferPoolStats()
+{
+    return depot().getStats();
+}
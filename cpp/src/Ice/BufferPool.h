@@ -0,0 +1,56 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include "Ice/Config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace IceInternal
+{
+    //
+    // The buffer pool provides the memory of the Buffer containers. Buffers up to 64KB are rounded up to a power of
+    // two size class and recycled through a per-thread cache backed by a process-wide depot, larger buffers are
+    // allocated with malloc.
+    //
+
+    // Returns the capacity to allocate for a buffer of the given size: the size of its size class or the given size
+    // if the buffer is too large to be pooled.
+    std::size_t bufferPoolCapacity(std::size_t);
+
+    // Allocates a buffer with the given capacity, which must have been returned by bufferPoolCapacity. Returns
+    // nullptr if the allocation fails.
+    std::byte* allocateBuffer(std::size_t);
+
+    // Releases a buffer allocated with allocateBuffer.
+    void deallocateBuffer(std::byte*, std::size_t);
+
+    // Returns true if a buffer of the given capacity is allocated from a size class.
+    bool isPooledBuffer(std::size_t);
+
+    struct BufferPoolStats
+    {
+        // The size of the buffers of the size class.
+        std::size_t size;
+
+        // The number of allocations served from the pool and the number of allocations that required a malloc.
+        std::int64_t hits;
+        std::int64_t misses;
+
+        // The number of buffers allocated and not yet released.
+        std::int64_t inUse;
+
+        // The number of bytes held by the pool in unused buffers.
+        std::int64_t bytesHeld;
+    };
+
+    // Returns the statistics of each size class.
+    std::vector<BufferPoolStats> getBufferPoolStats();
+}
+
+#endif
@@ -0,0 +1,244 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "CompressionCodec.h"
+#include "Ice/LocalExceptions.h"
+
+#include <climits>
+#include <string>
+
+#ifdef ICE_HAS_BZIP2
+#    include <bzlib.h>
+#endif
+
+#ifdef ICE_HAS_ZSTD
+#    include <zstd.h>
+#endif
+
+#ifdef ICE_HAS_LZ4
+#    include <lz4.h>
+#endif
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+#ifdef ICE_HAS_BZIP2
+    string getBZ2Error(int bzError)
+    {
+        if (bzError == BZ_RUN_OK)
+        {
+            return ": BZ_RUN_OK";
+        }
+        else if (bzError == BZ_FLUSH_OK)
+        {
+            return ": BZ_FLUSH_OK";
+        }
+        else if (bzError == BZ_FINISH_OK)
+        {
+            return ": BZ_FINISH_OK";
+        }
+        else if (bzError == BZ_STREAM_END)
+        {
+            return ": BZ_STREAM_END";
+        }
+        else if (bzError == BZ_CONFIG_ERROR)
+        {
+            return ": BZ_CONFIG_ERROR";
+        }
+        else if (bzError == BZ_SEQUENCE_ERROR)
+        {
+            return ": BZ_SEQUENCE_ERROR";
+        }
+        else if (bzError == BZ_PARAM_ERROR)
+        {
+            return ": BZ_PARAM_ERROR";
+        }
+        else if (bzError == BZ_MEM_ERROR)
+        {
+            return ": BZ_MEM_ERROR";
+        }
+        else if (bzError == BZ_DATA_ERROR)
+        {
+            return ": BZ_DATA_ERROR";
+        }
+        else if (bzError == BZ_DATA_ERROR_MAGIC)
+        {
+            return ": BZ_DATA_ERROR_MAGIC";
+        }
+        else if (bzError == BZ_IO_ERROR)
+        {
+            return ": BZ_IO_ERROR";
+        }
+        else if (bzError == BZ_UNEXPECTED_EOF)
+        {
+            return ": BZ_UNEXPECTED_EOF";
+        }
+        else if (bzError == BZ_OUTBUFF_FULL)
+        {
+            return ": BZ_OUTBUFF_FULL";
+        }
+        else
+        {
+            return "";
+        }
+    }
+
+    class Bzip2CompressionCodec final : public CompressionCodec
+    {
+    public:
+        uint8_t id() const noexcept final { return bzip2CompressionCodecId; }
+
+        string_view name() const noexcept final { return "bzip2"; }
+
+        size_t compressBound(size_t size) const noexcept final { return static_cast<size_t>(size * 1.01 + 600); }
+
+        size_t compress(const byte* src, size_t srcSize, byte* dst, size_t dstCapacity, int level) const final
+        {
+            auto compressedLen = static_cast<unsigned int>(dstCapacity);
+            int bzError = BZ2_bzBuffToBuffCompress(
+                reinterpret_cast<char*>(dst),
+                &compressedLen,
+                const_cast<char*>(reinterpret_cast<const char*>(src)),
+                static_cast<unsigned int>(srcSize),
+                level,
+                0,
+                0);
+            if (bzError != BZ_OK)
+            {
+                throw Ice::ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot compress message - BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError)};
+            }
+            return compressedLen;
+        }
+
+        void decompress(const byte* src, size_t srcSize, byte* dst, size_t dstSize) const final
+        {
+            auto uncompressedLen = static_cast<unsigned int>(dstSize);
+            int bzError = BZ2_bzBuffToBuffDecompress(
+                reinterpret_cast<char*>(dst),
+                &uncompressedLen,
+                const_cast<char*>(reinterpret_cast<const char*>(src)),
+                static_cast<unsigned int>(srcSize),
+                0,
+                0);
+            if (bzError != BZ_OK)
+            {
+                throw Ice::ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot decompress message - BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError)};
+            }
+        }
+    };
+#endif
+
+#ifdef ICE_HAS_ZSTD
+    class ZstdCompressionCodec final : public CompressionCodec
+    {
+    public:
+        uint8_t id() const noexcept final { return 3; }
+
+        string_view name() const noexcept final { return "zstd"; }
+
+        size_t compressBound(size_t size) const noexcept final { return ZSTD_compressBound(size); }
+
+        size_t compress(const byte* src, size_t srcSize, byte* dst, size_t dstCapacity, int level) const final
+        {
+            size_t result = ZSTD_compress(dst, dstCapacity, src, srcSize, level);
+            if (ZSTD_isError(result))
+            {
+                throw Ice::ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    string{"cannot compress message - ZSTD_compress failed: "} + ZSTD_getErrorName(result)};
+            }
+            return result;
+        }
+
+        void decompress(const byte* src, size_t srcSize, byte* dst, size_t dstSize) const final
+        {
+            size_t result = ZSTD_decompress(dst, dstSize, src, srcSize);
+            if (ZSTD_isError(result) || result != dstSize)
+            {
+                throw Ice::ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    string{"cannot decompress message - ZSTD_decompress failed: "} +
+                        (ZSTD_isError(result) ? ZSTD_getErrorName(result) : "unexpected uncompressed size")};
+            }
+        }
+    };
+#endif
+
+#ifdef ICE_HAS_LZ4
+    class Lz4CompressionCodec final : public CompressionCodec
+    {
+    public:
+        uint8_t id() const noexcept final { return 4; }
+
+        string_view name() const noexcept final { return "lz4"; }
+
+        size_t compressBound(size_t size) const noexcept final
+        {
+            return static_cast<size_t>(LZ4_compressBound(static_cast<int>(min<size_t>(size, INT_MAX))));
+        }
+
+        size_t compress(const byte* src, size_t srcSize, byte* dst, size_t dstCapacity, int) const final
+        {
+            // The compression level is ignored, lz4 is always used with its default (fastest) settings.
+            int result = LZ4_compress_default(
+                reinterpret_cast<const char*>(src),
+                reinterpret_cast<char*>(dst),
+                static_cast<int>(srcSize),
+                static_cast<int>(min<size_t>(dstCapacity, INT_MAX)));
+            if (result <= 0)
+            {
+                throw Ice::ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot compress message - LZ4_compress_default failed"};
+            }
+            return static_cast<size_t>(result);
+        }
+
+        void decompress(const byte* src, size_t srcSize, byte* dst, size_t dstSize) const final
+        {
+            int result = LZ4_decompress_safe(
+                reinterpret_cast<const char*>(src),
+                reinterpret_cast<char*>(dst),
+                static_cast<int>(srcSize),
+                static_cast<int>(dstSize));
+            if (result < 0 || static_cast<size_t>(result) != dstSize)
+            {
+                throw Ice::ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot decompress message - LZ4_decompress_safe failed"};
+            }
+        }
+    };
+#endif
+}
+
+IceInternal::CompressionCodec::~CompressionCodec() = default;
+
+vector<CompressionCodecPtr>
+IceInternal::createBuiltinCompressionCodecs()
+{
+    vector<CompressionCodecPtr> codecs;
+#ifdef ICE_HAS_BZIP2
+    codecs.push_back(make_shared<Bzip2CompressionCodec>());
+#endif
+#ifdef ICE_HAS_ZSTD
+    codecs.push_back(make_shared<ZstdCompressionCodec>());
+#endif
+#ifdef ICE_HAS_LZ4
+    codecs.push_back(make_shared<Lz4CompressionCodec>());
+#endif
+    return codecs;
+}
@@ -0,0 +1,62 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_COMPRESSION_CODEC_H
+#define ICE_COMPRESSION_CODEC_H
+
+#include "Ice/Config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#ifndef ICE_HAS_BZIP2
+#    define ICE_HAS_BZIP2
+#endif
+
+namespace IceInternal
+{
+    //
+    // A compression codec compresses the body of protocol messages. A compressed message is identified by the
+    // compression status of its header, which is the id of the codec used to compress it. The bzip2 codec (id 2) is
+    // supported by all Ice versions, the other codecs are only used with peers which advertise them: the compression
+    // status of the ValidateConnection messages sent by a connection carries the mask of the codecs it supports.
+    //
+    class CompressionCodec
+    {
+    public:
+        virtual ~CompressionCodec();
+
+        // The compression status of the messages compressed with this codec, between 2 and 7.
+        virtual std::uint8_t id() const noexcept = 0;
+
+        // The name of the codec, as specified with the Ice.Compression.Codecs property.
+        virtual std::string_view name() const noexcept = 0;
+
+        // Returns the maximum size of the compressed data for data of the given size.
+        virtual std::size_t compressBound(std::size_t) const noexcept = 0;
+
+        // Compresses the given data into the given buffer of the given capacity with the given compression level
+        // (Ice.Compression.Level). Returns the size of the compressed data. Throws Ice::ProtocolException on failure.
+        virtual std::size_t compress(const std::byte*, std::size_t, std::byte*, std::size_t, int) const = 0;
+
+        // Decompresses the given data into the given buffer, the buffer size is the size of the uncompressed data.
+        // Throws Ice::ProtocolException on failure.
+        virtual void decompress(const std::byte*, std::size_t, std::byte*, std::size_t) const = 0;
+    };
+    using CompressionCodecPtr = std::shared_ptr<CompressionCodec>;
+
+    const std::uint8_t bzip2CompressionCodecId = 2;
+    const std::uint8_t maxCompressionCodecId = 7;
+
+    // Returns the bit of the given codec in a mask of supported codecs.
+    inline std::uint8_t compressionCodecMask(std::uint8_t id) { return static_cast<std::uint8_t>(1 << id); }
+
+    // Returns the codecs built in the Ice library: bzip2 and, depending on the build, zstd (id 3) and lz4 (id 4).
+    std::vector<CompressionCodecPtr> createBuiltinCompressionCodecs();
+}
+
+#endif
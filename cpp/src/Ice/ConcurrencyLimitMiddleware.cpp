@@ -0,0 +1,150 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "ConcurrencyLimitMiddleware.h"
+#include "Ice/InputStream.h"
+#include "Ice/LocalExceptions.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    // The factor applied to the limit by AIMD when a dispatch is slower than the latency threshold.
+    const double backoffRatio = 0.9;
+
+    // The weights of a new latency sample in the long-term and short-term latency averages of Gradient.
+    const double longWeight = 2.0 / 601.0;
+    const double shortWeight = 2.0 / 11.0;
+
+    // The weight of the new limit computed by Gradient, to smooth out limit changes.
+    const double smoothing = 0.2;
+}
+
+ConcurrencyLimitMiddleware::ConcurrencyLimitMiddleware(
+    ObjectPtr next,
+    string adapterName,
+    Algorithm algorithm,
+    int initialLimit,
+    int minLimit,
+    int maxLimit,
+    chrono::microseconds latencyThreshold)
+    : _next(std::move(next)),
+      _adapterName(std::move(adapterName)),
+      _algorithm(algorithm),
+      _minLimit(minLimit),
+      _maxLimit(maxLimit),
+      _latencyThreshold(static_cast<double>(latencyThreshold.count())),
+      _limit(clamp(static_cast<double>(initialLimit), _minLimit, _maxLimit)),
+      _inFlight(0),
+      _admitted(0),
+      _rejected(0),
+      _longLatency(0),
+      _shortLatency(0)
+{
+    assert(_next);
+    assert(_minLimit >= 1 && _minLimit <= _maxLimit);
+}
+
+void
+ConcurrencyLimitMiddleware::dispatch(IncomingRequest& request, function<void(OutgoingResponse)> sendResponse)
+{
+    {
+        unique_lock lock(_mutex);
+        if (_inFlight >= static_cast<int>(_limit))
+        {
+            ++_rejected;
+            int limit = static_cast<int>(_limit);
+            lock.unlock();
+
+            // Skip the encapsulation. This allows the next batch requests in the same InputStream to proceed.
+            request.inputStream().skipEncapsulation();
+            throw ConcurrencyLimitException{__FILE__, __LINE__, limit};
+        }
+        ++_inFlight;
+        ++_admitted;
+    }
+
+    auto start = chrono::steady_clock::now();
+    try
+    {
+        _next->dispatch(
+            request,
+            [sendResponse = std::move(sendResponse), self = shared_from_this(), start](OutgoingResponse response)
+            {
+                self->completed(start);
+                sendResponse(std::move(response));
+            });
+    }
+    catch (...)
+    {
+        // When we catch an exception, the dispatch logic guarantees sendResponse was not called.
+        completed(start);
+        throw;
+    }
+}
+
+ConcurrencyLimitMiddleware::Stats
+ConcurrencyLimitMiddleware::stats() const
+{
+    lock_guard lock(_mutex);
+    return {_adapterName, static_cast<int>(_limit), _inFlight, _admitted, _rejected};
+}
+
+void
+ConcurrencyLimitMiddleware::completed(chrono::steady_clock::time_point start) noexcept
+{
+    auto latency = static_cast<double>(
+        chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count());
+
+    lock_guard lock(_mutex);
+    assert(_inFlight > 0);
+    int inFlight = _inFlight--; // The number of dispatches in progress when this dispatch completed, included.
+
+    if (_algorithm == Algorithm::AIMD)
+    {
+        if (latency > _latencyThreshold)
+        {
+            _limit = max(_limit * backoffRatio, _minLimit);
+        }
+        else if (inFlight * 2 >= static_cast<int>(_limit))
+        {
+            _limit = min(_limit + 1, _maxLimit);
+        }
+    }
+    else
+    {
+        latency = max(latency, 1.0);
+        if (_longLatency == 0)
+        {
+            _longLatency = latency;
+            _shortLatency = latency;
+            return;
+        }
+        _longLatency += (latency - _longLatency) * longWeight;
+        _shortLatency += (latency - _shortLatency) * shortWeight;
+
+        // When the short-term latency stays far above the baseline, move the baseline toward it faster, so the
+        // limit doesn't stay at its minimum after a lasting latency shift.
+        if (_longLatency * 2 < _shortLatency)
+        {
+            _longLatency *= 1.05;
+        }
+
+        // Don't grow the limit when it isn't used.
+        if (inFlight * 2 < static_cast<int>(_limit) && _shortLatency <= _longLatency)
+        {
+            return;
+        }
+
+        double gradient = clamp(_longLatency / _shortLatency, 0.5, 1.0);
+        double newLimit = _limit * gradient + sqrt(_limit);
+        _limit = clamp(_limit * (1 - smoothing) + newLimit * smoothing, _minLimit, _maxLimit);
+    }
+}
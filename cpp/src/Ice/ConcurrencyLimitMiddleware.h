@@ -0,0 +1,81 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_CONCURRENCY_LIMIT_MIDDLEWARE_H
+#define ICE_CONCURRENCY_LIMIT_MIDDLEWARE_H
+
+#include "Ice/Object.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace IceInternal
+{
+    class ConcurrencyLimitMiddleware;
+    using ConcurrencyLimitMiddlewarePtr = std::shared_ptr<ConcurrencyLimitMiddleware>;
+
+    // A middleware that limits the number of concurrent dispatches of an object adapter, and adapts this limit to the
+    // observed dispatch latency. Requests received while the limit is reached are rejected with a
+    // ConcurrencyLimitException, without unmarshaling their parameters.
+    class ConcurrencyLimitMiddleware final : public Ice::Object,
+                                             public std::enable_shared_from_this<ConcurrencyLimitMiddleware>
+    {
+    public:
+        enum class Algorithm
+        {
+            // Additive increase, multiplicative decrease: the limit grows by one with each dispatch completed under
+            // the latency threshold while the limit is at least half used, and shrinks by 10% with each dispatch
+            // completed over the threshold.
+            AIMD,
+
+            // The limit follows the ratio between the long-term and the short-term average latency, plus a queue
+            // allowance of sqrt(limit): it shrinks when the latency grows above its baseline.
+            Gradient
+        };
+
+        struct Stats
+        {
+            std::string adapterName;
+            int limit;
+            int inFlight;
+            std::int64_t admitted;
+            std::int64_t rejected;
+        };
+
+        ConcurrencyLimitMiddleware(
+            Ice::ObjectPtr next,
+            std::string adapterName,
+            Algorithm algorithm,
+            int initialLimit,
+            int minLimit,
+            int maxLimit,
+            std::chrono::microseconds latencyThreshold);
+
+        void dispatch(Ice::IncomingRequest&, std::function<void(Ice::OutgoingResponse)>) final;
+
+        Stats stats() const;
+
+    private:
+        void completed(std::chrono::steady_clock::time_point) noexcept;
+
+        const Ice::ObjectPtr _next;
+        const std::string _adapterName;
+        const Algorithm _algorithm;
+        const double _minLimit;
+        const double _maxLimit;
+        const double _latencyThreshold; // In microseconds, used by AIMD.
+
+        mutable std::mutex _mutex;
+        double _limit;
+        int _inFlight;
+        std::int64_t _admitted;
+        std::int64_t _rejected;
+        double _longLatency;  // Exponential moving average of the latency over ~600 dispatches, used by Gradient.
+        double _shortLatency; // Exponential moving average of the latency over ~10 dispatches, used by Gradient.
+    };
+}
+
+#endif
@@ -69,6 +69,36 @@ namespace
         return nullptr;
     }
 
+    // Returns the active connection with the fewest outstanding requests, or null if the map holds fewer than poolSize
+    // active connections for the given key, in which case a new connection should be established.
+    template<typename Map>
+    typename Map::mapped_type findInPool(const Map& m, const typename Map::key_type& k, int poolSize)
+    {
+        if (poolSize <= 1)
+        {
+            return find(m, k, [](const ConnectionIPtr& conn) { return conn->isActiveOrHolding(); });
+        }
+
+        typename Map::mapped_type connection;
+        size_t outstanding = 0;
+        int count = 0;
+        auto pr = m.equal_range(k);
+        for (auto q = pr.first; q != pr.second; ++q)
+        {
+            if (q->second->isActiveOrHolding())
+            {
+                ++count;
+                size_t n = q->second->outstandingRequestCount();
+                if (!connection || n < outstanding)
+                {
+                    connection = q->second;
+                    outstanding = n;
+                }
+            }
+        }
+        return count < poolSize ? nullptr : connection;
+    }
+
     class StartAcceptor : public Ice::TimerTask, public std::enable_shared_from_this<StartAcceptor>
     {
     public:
@@ -173,6 +203,7 @@ IceInternal::OutgoingConnectionFactory::createAsync(
     vector<EndpointIPtr> endpoints,
     bool hasMore,
     Ice::EndpointSelectionType selType,
+    int poolSize,
     function<void(Ice::ConnectionIPtr, bool)> response,
     function<void(std::exception_ptr)> exception)
 {
@@ -184,7 +215,7 @@ IceInternal::OutgoingConnectionFactory::createAsync(
     try
     {
         bool compress;
-        Ice::ConnectionIPtr connection = findConnection(endpoints, compress);
+        Ice::ConnectionIPtr connection = findConnection(endpoints, poolSize, compress);
         if (connection)
         {
             response(std::move(connection), compress);
@@ -204,10 +235,22 @@ IceInternal::OutgoingConnectionFactory::createAsync(
         hasMore,
         std::move(response),
         std::move(exception),
-        selType);
+        selType,
+        poolSize);
     cb->getConnectors();
 }
 
+double
+IceInternal::OutgoingConnectionFactory::getLoad(const EndpointIPtr& endpoint)
+{
+    lock_guard lock(_mutex);
+    auto connection = find(
+        _connectionsByEndpoint,
+        endpoint->timeout(-1), // clear the timeout
+        [](const ConnectionIPtr& conn) { return conn->isActiveOrHolding(); });
+    return connection ? connection->load() : 0.0;
+}
+
 void
 IceInternal::OutgoingConnectionFactory::setRouterInfo(const RouterInfoPtr& routerInfo)
 {
@@ -338,7 +381,10 @@ IceInternal::OutgoingConnectionFactory::~OutgoingConnectionFactory()
 }
 
 ConnectionIPtr
-IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr>& endpoints, bool& compress)
+IceInternal::OutgoingConnectionFactory::findConnection(
+    const vector<EndpointIPtr>& endpoints,
+    int poolSize,
+    bool& compress)
 {
     lock_guard lock(_mutex);
     if (_destroyed)
@@ -351,11 +397,7 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
 
     for (const auto& p : endpoints)
     {
-        auto connection = find(
-            _connectionsByEndpoint,
-            p->timeout(-1), // clear the timeout
-            [](const ConnectionIPtr& conn) { return conn->isActiveOrHolding(); });
-
+        auto connection = findInPool(_connectionsByEndpoint, p->timeout(-1), poolSize); // clear the timeout
         if (connection)
         {
             if (defaultsAndOverrides->overrideCompress.has_value())
@@ -373,7 +415,10 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
 }
 
 ConnectionIPtr
-IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInfo>& connectors, bool& compress)
+IceInternal::OutgoingConnectionFactory::findConnection(
+    const vector<ConnectorInfo>& connectors,
+    int poolSize,
+    bool& compress)
 {
     // This must be called with the mutex locked.
 
@@ -385,8 +430,7 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInf
             continue;
         }
 
-        auto connection =
-            find(_connections, p.connector, [](const ConnectionIPtr& conn) { return conn->isActiveOrHolding(); });
+        auto connection = findInPool(_connections, p.connector, poolSize);
         if (connection)
         {
             if (defaultsAndOverrides->overrideCompress.has_value())
@@ -439,6 +483,7 @@ ConnectionIPtr
 IceInternal::OutgoingConnectionFactory::getConnection(
     const vector<ConnectorInfo>& connectors,
     const ConnectCallbackPtr& cb,
+    int poolSize,
     bool& compress)
 {
     {
@@ -463,7 +508,7 @@ IceInternal::OutgoingConnectionFactory::getConnection(
             //
             // Search for a matching connection. If we find one, we're done.
             //
-            Ice::ConnectionIPtr connection = findConnection(connectors, compress);
+            Ice::ConnectionIPtr connection = findConnection(connectors, poolSize, compress);
             if (connection)
             {
                 return connection;
@@ -825,14 +870,16 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(
     bool hasMore,
     std::function<void(Ice::ConnectionIPtr, bool)> createConnectionResponse,
     std::function<void(std::exception_ptr)> createConnectionException,
-    Ice::EndpointSelectionType selType)
+    Ice::EndpointSelectionType selType,
+    int poolSize)
     : _instance(instance),
       _factory(factory),
       _endpoints(endpoints),
       _hasMore(hasMore),
       _createConnectionResponse(std::move(createConnectionResponse)),
       _createConnectionException(std::move(createConnectionException)),
-      _selType(selType)
+      _selType(selType),
+      _poolSize(poolSize)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -966,7 +1013,7 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::getConnection()
         // connection.
         //
         bool compress;
-        Ice::ConnectionIPtr connection = _factory->getConnection(_connectors, shared_from_this(), compress);
+        Ice::ConnectionIPtr connection = _factory->getConnection(_connectors, shared_from_this(), _poolSize, compress);
         if (!connection)
         {
             //
@@ -49,13 +49,19 @@ namespace IceInternal
 
         void waitUntilFinished();
 
+        // The pool size is the number of connections to establish to an endpoint before sharing them: once the pool is
+        // full, the connection with the fewest outstanding requests is returned.
         void createAsync(
             std::vector<EndpointIPtr>,
             bool,
             Ice::EndpointSelectionType,
+            int,
             std::function<void(Ice::ConnectionIPtr, bool)>,
             std::function<void(std::exception_ptr)>);
 
+        // Returns the load of the active connection to the given endpoint, or 0 if there's no such connection.
+        double getLoad(const EndpointIPtr&);
+
         void setRouterInfo(const RouterInfoPtr&);
         void removeAdapter(const Ice::ObjectAdapterPtr&);
         void flushAsyncBatchRequests(const CommunicatorFlushBatchAsyncPtr&, Ice::CompressBatch);
@@ -87,7 +93,8 @@ namespace IceInternal
                 bool,
                 std::function<void(Ice::ConnectionIPtr, bool)>,
                 std::function<void(std::exception_ptr)>,
-                Ice::EndpointSelectionType);
+                Ice::EndpointSelectionType,
+                int);
 
             virtual void connectionStartCompleted(const Ice::ConnectionIPtr&);
             virtual void connectionStartFailed(const Ice::ConnectionIPtr&, std::exception_ptr);
@@ -118,6 +125,7 @@ namespace IceInternal
             const std::function<void(Ice::ConnectionIPtr, bool)> _createConnectionResponse;
             const std::function<void(std::exception_ptr)> _createConnectionException;
             const Ice::EndpointSelectionType _selType;
+            const int _poolSize;
             Ice::Instrumentation::ObserverPtr _observer;
             std::vector<EndpointIPtr>::const_iterator _endpointsIter;
             std::vector<ConnectorInfo> _connectors;
@@ -126,10 +134,10 @@ namespace IceInternal
         using ConnectCallbackPtr = std::shared_ptr<ConnectCallback>;
         friend class ConnectCallback;
 
-        Ice::ConnectionIPtr findConnection(const std::vector<EndpointIPtr>&, bool&);
+        Ice::ConnectionIPtr findConnection(const std::vector<EndpointIPtr>&, int, bool&);
         void incPendingConnectCount();
         void decPendingConnectCount();
-        Ice::ConnectionIPtr getConnection(const std::vector<ConnectorInfo>&, const ConnectCallbackPtr&, bool&);
+        Ice::ConnectionIPtr getConnection(const std::vector<ConnectorInfo>&, const ConnectCallbackPtr&, int, bool&);
         void finishGetConnection(
             const std::vector<ConnectorInfo>&,
             const ConnectorInfo&,
@@ -140,7 +148,7 @@ namespace IceInternal
         bool addToPending(const ConnectCallbackPtr&, const std::vector<ConnectorInfo>&);
         void removeFromPending(const ConnectCallbackPtr&, const std::vector<ConnectorInfo>&);
 
-        Ice::ConnectionIPtr findConnection(const std::vector<ConnectorInfo>&, bool&);
+        Ice::ConnectionIPtr findConnection(const std::vector<ConnectorInfo>&, int, bool&);
         Ice::ConnectionIPtr createConnection(const TransceiverPtr&, const ConnectorInfo&);
 
         void handleException(std::exception_ptr, bool);
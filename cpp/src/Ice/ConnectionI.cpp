@@ -27,10 +27,6 @@
 #include <iomanip>
 #include <stdexcept>
 
-#ifdef ICE_HAS_BZIP2
-#    include <bzlib.h>
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -38,6 +34,11 @@ using namespace IceInternal;
 
 namespace
 {
+#if !defined(ICE_USE_IOCP)
+    // The maximum number of queued messages sent with a single gather write.
+    const size_t maxGatherMessages = 64;
+#endif
+
     class ConnectTimerTask final : public Ice::TimerTask
     {
     public:
@@ -126,6 +127,62 @@ namespace
         }
         return os.str();
     }
+
+    // Returns the mask of the ids of the given compression codecs.
+    uint8_t getCompressionCodecMask(const vector<CompressionCodecPtr>& codecs)
+    {
+        uint8_t mask = 0;
+        for (const auto& codec : codecs)
+        {
+            mask |= compressionCodecMask(codec->id());
+        }
+        return mask;
+    }
+
+    // Decodes and checks the header of a protocol message, the stream must be positioned at the start of the message.
+    // Returns the message size.
+    int32_t readMessageHeader(InputStream& stream, size_t messageSizeMax)
+    {
+        const byte* m;
+        stream.readBlob(m, static_cast<int32_t>(sizeof(magic)));
+        if (m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
+        {
+            throw ProtocolException{__FILE__, __LINE__, createBadMagicMessage(m)};
+        }
+        ProtocolVersion pv;
+        stream.read(pv);
+        if (pv != currentProtocol)
+        {
+            throw ProtocolException{
+                __FILE__,
+                __LINE__,
+                "invalid protocol version in message header: " + Ice::protocolVersionToString(pv)};
+        }
+        EncodingVersion ev;
+        stream.read(ev);
+        if (ev != currentProtocolEncoding)
+        {
+            throw ProtocolException{
+                __FILE__,
+                __LINE__,
+                "invalid protocol encoding version in message header: " + Ice::encodingVersionToString(ev)};
+        }
+        uint8_t messageType;
+        stream.read(messageType);
+        uint8_t compressByte;
+        stream.read(compressByte);
+        int32_t size;
+        stream.read(size);
+        if (size < headerSize)
+        {
+            throw MarshalException{__FILE__, __LINE__, "received Ice message with unexpected size " + to_string(size)};
+        }
+        if (size > static_cast<int32_t>(messageSizeMax))
+        {
+            Ex::throwMemoryLimitException(__FILE__, __LINE__, static_cast<size_t>(size), messageSizeMax);
+        }
+        return size;
+    }
 }
 
 ConnectionFlushBatchAsync::ConnectionFlushBatchAsync(const ConnectionIPtr& connection, const InstancePtr& instance)
@@ -281,7 +338,7 @@ Ice::ConnectionI::OutgoingMessage::adopt(OutputStream* str)
     }
     else if (!str)
     {
-        if (outAsync)
+        if (outAsync && stream == outAsync->getOs())
         {
             return; // Adopting request stream is not necessary.
         }
@@ -307,9 +364,12 @@ Ice::ConnectionI::OutgoingMessage::canceled(bool adoptStream)
     {
         adopt(nullptr); // Adopt the request stream
     }
-    else
+    else if (adopted)
     {
-        assert(!adopted);
+        // The message is removed from the send queue, release its compressed stream.
+        delete stream;
+        stream = nullptr;
+        adopted = false;
     }
 }
 
@@ -520,6 +580,20 @@ Ice::ConnectionI::isActiveOrHolding() const
     return _state > StateNotValidated && _state < StateClosing;
 }
 
+double
+Ice::ConnectionI::load() const
+{
+    std::lock_guard lock(_mutex);
+    return static_cast<double>(_asyncRequests.size() + 1) * max(_roundTripTime, 1.0);
+}
+
+size_t
+Ice::ConnectionI::outstandingRequestCount() const
+{
+    std::lock_guard lock(_mutex);
+    return _asyncRequests.size();
+}
+
 bool
 Ice::ConnectionI::isFinished() const
 {
@@ -608,41 +682,18 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
 {
     OutputStream* os = out->getOs();
 
-    std::lock_guard lock(_mutex);
-    //
-    // If the exception is closed before we even have a chance
-    // to send our request, we always try to send the request
-    // again.
-    //
-    if (_exception)
-    {
-        throw RetryException(_exception);
-    }
-    assert(_state > StateNotValidated);
-    assert(_state < StateClosing);
-
-    //
-    // Ensure the message isn't bigger than what we can send with the
-    // transport.
-    //
-    _transceiver->checkSendSize(*os);
-
-    //
-    // Notify the request that it's cancelable with this connection.
-    // This will throw if the request is canceled.
-    //
-    out->cancelable(shared_from_this());
     int32_t requestId = 0;
     if (response)
     {
         //
         // Create a new unique request ID.
         //
-        requestId = _nextRequestId++;
-        if (requestId <= 0)
+        requestId = _nextRequestId.load(memory_order_relaxed);
+        while (!_nextRequestId.compare_exchange_weak(
+            requestId,
+            requestId == numeric_limits<int32_t>::max() ? 1 : requestId + 1,
+            memory_order_relaxed))
         {
-            _nextRequestId = 1;
-            requestId = _nextRequestId++;
         }
 
         //
@@ -671,6 +722,46 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
         }
     }
 
+    //
+    // Compress the message on the invoking thread, before locking the connection.
+    //
+    OutgoingMessage message(out, os, compress, requestId);
+    OutputStream compressed{currentProtocolEncoding};
+    exception_ptr prepareException;
+    try
+    {
+        prepareMessage(message, compressed);
+    }
+    catch (const LocalException&)
+    {
+        prepareException = current_exception(); // Raised once the connection is locked to close it.
+    }
+
+    std::lock_guard lock(_mutex);
+    //
+    // If the exception is closed before we even have a chance
+    // to send our request, we always try to send the request
+    // again.
+    //
+    if (_exception)
+    {
+        throw RetryException(_exception);
+    }
+    assert(_state > StateNotValidated);
+    assert(_state < StateClosing);
+
+    //
+    // Ensure the message isn't bigger than what we can send with the
+    // transport.
+    //
+    _transceiver->checkSendSize(*os);
+
+    //
+    // Notify the request that it's cancelable with this connection.
+    // This will throw if the request is canceled.
+    //
+    out->cancelable(shared_from_this());
+
     out->attachRemoteObserver(initConnectionInfo(), _endpoint, requestId);
 
     // We're just about to send a request, so we are not inactive anymore.
@@ -679,7 +770,10 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     AsyncStatus status = AsyncStatusQueued;
     try
     {
-        OutgoingMessage message(out, os, compress, requestId);
+        if (prepareException)
+        {
+            rethrow_exception(prepareException);
+        }
         status = sendMessage(message);
     }
     catch (const LocalException&)
@@ -691,8 +785,9 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
 
     if (response)
     {
-        _asyncRequestsHint =
-            _asyncRequests.insert(_asyncRequests.end(), pair<const int32_t, OutgoingAsyncBasePtr>(requestId, out));
+        _asyncRequestsHint = _asyncRequests.insert(
+            _asyncRequests.end(),
+            pair<const int32_t, AsyncRequest>(requestId, {out, chrono::steady_clock::now()}));
     }
     return status;
 }
@@ -737,7 +832,10 @@ Ice::ConnectionI::setCloseCallback(CloseCallback callback)
         if (callback)
         {
             auto self = shared_from_this();
-            _threadPool->execute([self, callback = std::move(callback)]() { self->closeCallback(callback); }, self);
+            _threadPool->execute(
+                [self, callback = std::move(callback)]() { self->closeCallback(callback); },
+                self,
+                this);
         }
     }
     else
@@ -785,7 +883,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, exc
             if (o->requestId)
             {
                 if (_asyncRequestsHint != _asyncRequests.end() &&
-                    _asyncRequestsHint->second == dynamic_pointer_cast<OutgoingAsync>(outAsync))
+                    _asyncRequestsHint->second.outAsync == dynamic_pointer_cast<OutgoingAsync>(outAsync))
                 {
                     _asyncRequests.erase(_asyncRequestsHint);
                     _asyncRequestsHint = _asyncRequests.end();
@@ -832,7 +930,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, exc
     {
         if (_asyncRequestsHint != _asyncRequests.end())
         {
-            if (_asyncRequestsHint->second == outAsync)
+            if (_asyncRequestsHint->second.outAsync == outAsync)
             {
                 try
                 {
@@ -856,9 +954,9 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, exc
             }
         }
 
-        for (map<int32_t, OutgoingAsyncBasePtr>::iterator p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
+        for (auto p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
         {
-            if (p->second.get() == outAsync.get())
+            if (p->second.outAsync.get() == outAsync.get())
             {
                 try
                 {
@@ -1120,8 +1218,9 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
             SocketOperation writeOp = SocketOperationNone;
             SocketOperation readOp = SocketOperationNone;
 
-            // If writes are ready, write the data from the connection's write buffer (_writeStream)
-            if (current.operation & SocketOperationWrite)
+            // If writes are ready, write the data from the connection's write buffer (_writeStream). Messages held by
+            // the cork mode are not written yet, they are all sent by sendNextMessages.
+            if ((current.operation & SocketOperationWrite) && !_corked)
             {
                 if (_observer)
                 {
@@ -1141,7 +1240,15 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
             // - the read operation on the transport can't continue without blocking
             if (current.operation & SocketOperationRead)
             {
-                while (true)
+#if !defined(ICE_USE_IOCP)
+                // With a shared read buffer, the next message is read in the read buffer unless it's too large and
+                // readBuffered() clears _readHeader to read the remainder of the message in _readStream.
+                if (_readBufferSize > 0 && _readHeader && _state > StateNotValidated)
+                {
+                    readOp = readBuffered(messageStream);
+                }
+#endif
+                while (!_readHeader || _readBufferSize == 0 || _state <= StateNotValidated)
                 {
                     if (_observer && !_readHeader)
                     {
@@ -1198,54 +1305,9 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
 
                         // Decode the header.
                         _readStream.i = _readStream.b.begin();
-                        const byte* m;
-                        _readStream.readBlob(m, static_cast<int32_t>(sizeof(magic)));
-                        if (m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
-                        {
-                            throw ProtocolException{__FILE__, __LINE__, createBadMagicMessage(m)};
-                        }
-                        ProtocolVersion pv;
-                        _readStream.read(pv);
-                        if (pv != currentProtocol)
-                        {
-                            throw ProtocolException{
-                                __FILE__,
-                                __LINE__,
-                                "invalid protocol version in message header: " + Ice::protocolVersionToString(pv)};
-                        }
-                        EncodingVersion ev;
-                        _readStream.read(ev);
-                        if (ev != currentProtocolEncoding)
-                        {
-                            throw ProtocolException{
-                                __FILE__,
-                                __LINE__,
-                                "invalid protocol encoding version in message header: " +
-                                    Ice::encodingVersionToString(ev)};
-                        }
-                        uint8_t messageType;
-                        _readStream.read(messageType);
-                        uint8_t compressByte;
-                        _readStream.read(compressByte);
-                        int32_t size;
-                        _readStream.read(size);
-                        if (size < headerSize)
-                        {
-                            throw MarshalException{
-                                __FILE__,
-                                __LINE__,
-                                "received Ice message with unexpected size " + to_string(size)};
-                        }
+                        int32_t size = readMessageHeader(_readStream, _messageSizeMax);
 
                         // Resize the read buffer to the message size.
-                        if (size > static_cast<int32_t>(_messageSizeMax))
-                        {
-                            Ex::throwMemoryLimitException(
-                                __FILE__,
-                                __LINE__,
-                                static_cast<size_t>(size),
-                                _messageSizeMax);
-                        }
                         if (static_cast<size_t>(size) > _readStream.b.size())
                         {
                             _readStream.b.resize(static_cast<size_t>(size));
@@ -1670,11 +1732,11 @@ Ice::ConnectionI::finish(bool close)
         _sendStreams.clear();
     }
 
-    for (map<int32_t, OutgoingAsyncBasePtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
+    for (const auto& q : _asyncRequests)
     {
-        if (q->second->exception(_exception))
+        if (q.second.outAsync->exception(_exception))
         {
-            q->second->invokeException();
+            q.second.outAsync->invokeException();
         }
     }
 
@@ -1687,6 +1749,8 @@ Ice::ConnectionI::finish(bool close)
     _writeStream.b.clear();
     _readStream.clear();
     _readStream.b.clear();
+    _readBuffer = nullptr;
+    _readBufferStart = _readBufferEnd = 0;
 
     if (_closeCallback)
     {
@@ -1781,7 +1845,7 @@ Ice::ConnectionI::ConnectionI(
       _connector(connector),
       _endpoint(endpoint),
       _adapter(adapter),
-      _hasExecutor(_instance->initializationData().executor != nullptr), // Cached for better performance.
+      _hasExecutor(false),                                               // Set by create().
       _logger(_instance->initializationData().logger),                   // Cached for better performance.
       _traceLevels(_instance->traceLevels()),                            // Cached for better performance.
       _timer(_instance->timer()),                                        // Cached for better performance.
@@ -1794,12 +1858,19 @@ Ice::ConnectionI::ConnectionI(
       _warn(_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Connections") > 0),
       _warnUdp(_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Datagrams") > 0),
       _compressionLevel(1),
+      _compressionCodecs(_instance->compressionCodecs()),
+      _compressionCodecMask(getCompressionCodecMask(_compressionCodecs)),
+      _peerCompressionCodecMask(compressionCodecMask(bzip2CompressionCodecId)),
       _nextRequestId(1),
       _asyncRequestsHint(_asyncRequests.end()),
+      _roundTripTime(0),
       _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
       _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
       _readStream(_instance.get(), Ice::currentProtocolEncoding),
       _readHeader(false),
+      _readBufferSize(0),
+      _corkSize(0),
+      _corkDelay(options.corkDelay),
       _upcallCount(0),
       _state(StateNotInitialized),
       _shutdownInitiated(false),
@@ -1818,6 +1889,21 @@ Ice::ConnectionI::ConnectionI(
     {
         compressionLevel = 9;
     }
+
+#if !defined(ICE_USE_IOCP)
+    // The shared read buffer is only used by stream connections.
+    if (!_endpoint->datagram() && options.readBufferSize > 0)
+    {
+        const_cast<size_t&>(_readBufferSize) = max(options.readBufferSize, static_cast<size_t>(headerSize));
+    }
+
+    // The cork mode relies on gather writes to send the held messages with a single write, it's only used by transports
+    // which support them.
+    if (_transceiver->hasGatherWrites())
+    {
+        const_cast<size_t&>(_corkSize) = options.corkSize;
+    }
+#endif
 }
 
 Ice::ConnectionIPtr
@@ -1869,6 +1955,8 @@ Ice::ConnectionI::create(
     {
         const_cast<ThreadPoolPtr&>(connection->_threadPool) = connection->_instance->clientThreadPool();
     }
+    // The thread pool of an object adapter can have its own dispatch executor.
+    const_cast<bool&>(connection->_hasExecutor) = connection->_threadPool->hasExecutor();
     connection->_threadPool->initialize(connection);
     return connection;
 }
@@ -2183,6 +2271,7 @@ Ice::ConnectionI::initiateShutdown()
         }
 
         OutgoingMessage message(&os, false);
+        prepareMessage(message, os); // Not compressed.
         if (sendMessage(message) & AsyncStatusSent)
         {
             setState(StateClosingPending);
@@ -2299,13 +2388,14 @@ Ice::ConnectionI::sendHeartbeat() noexcept
     if (_state == StateActive || _state == StateHolding)
     {
         // We check if the connection has become inactive.
-        if (_inactivityTimerTask &&           // null when the inactivity timeout is infinite
-            !_inactivityTimerTaskScheduled && // we never reschedule this task
-            _state == StateActive &&          // only schedule the task if the connection is active
-            _dispatchCount == 0 &&            // no pending dispatch
-            _asyncRequests.empty() &&         // no pending invocation
-            _readHeader &&                    // we're not waiting for the remainder of an incoming message
-            _sendStreams.size() <= 1)         // there is at most one pending outgoing message
+        if (_inactivityTimerTask &&               // null when the inactivity timeout is infinite
+            !_inactivityTimerTaskScheduled &&     // we never reschedule this task
+            _state == StateActive &&              // only schedule the task if the connection is active
+            _dispatchCount == 0 &&                // no pending dispatch
+            _asyncRequests.empty() &&             // no pending invocation
+            _readHeader &&                        // we're not waiting for the remainder of an incoming message
+            _readBufferStart == _readBufferEnd && // including a message partially received in the read buffer
+            _sendStreams.size() <= 1)             // there is at most one pending outgoing message
         {
             // We may become inactive while the peer is back-pressuring us. In this case, we only schedule the
             // inactivity timer if there is no pending outgoing message or the pending outgoing message is a
@@ -2335,12 +2425,12 @@ Ice::ConnectionI::sendHeartbeat() noexcept
             os.write(currentProtocol);
             os.write(currentProtocolEncoding);
             os.write(validateConnectionMsg);
-            os.write(static_cast<uint8_t>(0)); // Compression status (always zero for validate connection).
-            os.write(headerSize);              // Message size.
-            os.i = os.b.begin();
+            os.write(_compressionCodecMask); // Compression status: the compression codecs supported by this side.
+            os.write(headerSize);            // Message size.
             try
             {
                 OutgoingMessage message(&os, false);
+                prepareMessage(message, os); // Not compressed.
                 sendMessage(message);
             }
             catch (...)
@@ -2357,6 +2447,24 @@ Ice::ConnectionI::sendResponse(OutgoingResponse response, uint8_t compress)
 {
     bool isTwoWay = !_endpoint->datagram() && response.current().requestId != 0;
 
+    //
+    // Compress the response on the dispatch thread, before locking the connection.
+    //
+    OutgoingMessage message(&response.outputStream(), compress > 0);
+    OutputStream compressed{currentProtocolEncoding};
+    exception_ptr prepareException;
+    if (isTwoWay)
+    {
+        try
+        {
+            prepareMessage(message, compressed);
+        }
+        catch (const LocalException&)
+        {
+            prepareException = current_exception(); // Raised once the connection is locked to close it.
+        }
+    }
+
     bool finished = false;
     try
     {
@@ -2395,7 +2503,10 @@ Ice::ConnectionI::sendResponse(OutgoingResponse response, uint8_t compress)
 
             if (isTwoWay)
             {
-                OutgoingMessage message(&response.outputStream(), compress > 0);
+                if (prepareException)
+                {
+                    rethrow_exception(prepareException);
+                }
                 sendMessage(message);
             }
 
@@ -2452,9 +2563,8 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(
-                    static_cast<uint8_t>(0));   // Compression status (always zero for validate connection).
-                _writeStream.write(headerSize); // Message size.
+                _writeStream.write(_compressionCodecMask); // Compression status: the supported compression codecs.
+                _writeStream.write(headerSize);            // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _instance, _logger, _traceLevels);
             }
@@ -2549,7 +2659,8 @@ Ice::ConnectionI::validate(SocketOperation operation)
                         " over a connection that is not yet validated"};
             }
             uint8_t compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
+            _readStream.read(compress); // The compression codecs supported by the peer, 0 for older Ice versions.
+            _peerCompressionCodecMask.fetch_or(compress, memory_order_relaxed);
             int32_t size;
             _readStream.read(size);
             if (size != headerSize)
@@ -2602,15 +2713,33 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
         // Message wasn't sent, empty the _writeStream, we're not going to send more data.
         OutgoingMessage* message = &_sendStreams.front();
         _writeStream.swap(*message->stream);
+        _corked = false;
         return SocketOperationNone;
     }
 
-    // Assert that the message was fully written.
-    assert(!_writeStream.b.empty() && _writeStream.i == _writeStream.b.end());
-
     try
     {
-        while (true)
+#if !defined(ICE_USE_IOCP)
+        if (_corked)
+        {
+            //
+            // None of the messages held by the cork mode was written yet, send them with a single gather write.
+            //
+            _corked = false;
+            _lastWriteTime = chrono::steady_clock::now();
+            _writeStream.swap(*_sendStreams.front().stream);
+            SocketOperation op = sendQueuedMessages(callbacks);
+            if (op)
+            {
+                return op;
+            }
+        }
+#endif
+
+        // Assert that the message was fully written.
+        assert(_sendStreams.empty() || (!_writeStream.b.empty() && _writeStream.i == _writeStream.b.end()));
+
+        while (!_sendStreams.empty())
         {
             //
             // The message that was being sent is sent. We can swap back the write stream buffer to the outgoing message
@@ -2645,64 +2774,11 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
                 return SocketOperationNone;
             }
 
+#if defined(ICE_USE_IOCP)
             //
-            // Otherwise, prepare the next message.
+            // Otherwise, send the next message, it was prepared before it was queued.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
-#ifdef ICE_HAS_BZIP2
-            if (message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
-            {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = byte{2};
-
-                //
-                // Do compression.
-                //
-                OutputStream stream{currentProtocolEncoding};
-                doCompress(*message->stream, stream);
-
-                traceSend(*message->stream, _instance, _logger, _traceLevels);
-
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
-            }
-            else
-            {
-#endif
-                if (message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = byte{1};
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                int32_t sz = static_cast<int32_t>(message->stream->b.size());
-                const byte* p = reinterpret_cast<const byte*>(&sz);
-                if constexpr (endian::native == endian::big)
-                {
-                    reverse_copy(p, p + sizeof(int32_t), message->stream->b.begin() + 10);
-                }
-                else
-                {
-                    copy(p, p + sizeof(int32_t), message->stream->b.begin() + 10);
-                }
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _instance, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
-            }
-#endif
-
-            //
-            // Send the message.
-            //
             _writeStream.swap(*message->stream);
             if (_observer)
             {
@@ -2723,6 +2799,19 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
             }
 
             // If the message was sent right away, loop to send the next queued message.
+#else
+            //
+            // Otherwise, send the queued messages with gather writes. If the transport can't accept more data, the
+            // message being sent is swapped with _writeStream and message() will take care of sending its remainder.
+            //
+            SocketOperation op = sendQueuedMessages(callbacks);
+            if (op)
+            {
+                return op;
+            }
+            assert(_sendStreams.empty());
+            break;
+#endif
         }
 
         //
@@ -2746,118 +2835,228 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
     return SocketOperationNone;
 }
 
-AsyncStatus
-Ice::ConnectionI::sendMessage(OutgoingMessage& message)
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message, OutputStream& compressed) const
 {
-    assert(_state >= StateActive);
-    assert(_state < StateClosed);
+    if (message.compress && message.stream->b.size() >= 100) // Only compress messages > 100 bytes.
+    {
+        //
+        // Use the preferred codec supported by the peer, the peer always supports bzip2.
+        //
+        const uint8_t peerMask = _peerCompressionCodecMask.load(memory_order_relaxed);
+        const CompressionCodec* codec = nullptr;
+        for (const auto& c : _compressionCodecs)
+        {
+            if (peerMask & compressionCodecMask(c->id()))
+            {
+                codec = c.get();
+                break;
+            }
+        }
 
-    message.stream->i = 0; // Reset the message stream iterator before starting sending the message.
+        if (codec)
+        {
+            //
+            // Message compressed. Request compressed response, if any.
+            //
+            message.stream->b[9] = static_cast<byte>(codec->id());
 
-    // Some messages are queued for sending. Just adds the message to the send queue and tell the caller that the
-    // message was queued.
-    if (!_sendStreams.empty())
+            //
+            // Do compression.
+            //
+            doCompress(*codec, *message.stream, compressed);
+
+            traceSend(*message.stream, _instance, _logger, _traceLevels);
+
+            message.stream = &compressed; // The compressed stream is adopted if the message is queued.
+            message.stream->i = message.stream->b.begin();
+            return;
+        }
+    }
+
+    if (message.compress)
     {
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(0);
-        return AsyncStatusQueued;
+        //
+        // Message not compressed. Request compressed response, if any.
+        //
+        message.stream->b[9] = byte{1};
     }
 
-    // Prepare and send the message.
+    //
+    // No compression, just fill in the message size.
+    //
+    int32_t sz = static_cast<int32_t>(message.stream->b.size());
+    const byte* p = reinterpret_cast<const byte*>(&sz);
+    if constexpr (endian::native == endian::big)
+    {
+        reverse_copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+    }
+    else
+    {
+        copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+    }
     message.stream->i = message.stream->b.begin();
-    SocketOperation op;
-#ifdef ICE_HAS_BZIP2
-    if (message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    traceSend(*message.stream, _instance, _logger, _traceLevels);
+}
+
+#if !defined(ICE_USE_IOCP)
+SocketOperation
+Ice::ConnectionI::sendQueuedMessages(vector<OutgoingMessage>& callbacks)
+{
+    assert(!_sendStreams.empty());
+
+    vector<Buffer*> buffers;
+    while (!_sendStreams.empty())
     {
         //
-        // Message compressed. Request compressed response, if any.
+        // Gather the streams of the queued messages, they are prepared before being queued.
         //
-        message.stream->b[9] = byte{2};
+        buffers.clear();
+        for (deque<OutgoingMessage>::iterator p = _sendStreams.begin(); p != _sendStreams.end(); ++p)
+        {
+            buffers.push_back(p->stream);
+            if (buffers.size() == maxGatherMessages)
+            {
+                break;
+            }
+        }
+
+        SocketOperation op = writeGather(buffers);
 
         //
-        // Do compression.
+        // Remove the messages which are fully sent from the queue and queue their sent callback (if any).
         //
-        OutputStream stream{currentProtocolEncoding};
-        doCompress(*message.stream, stream);
-        stream.i = stream.b.begin();
-
-        traceSend(*message.stream, _instance, _logger, _traceLevels);
+        int sentMessages = 0;
+        while (!_sendStreams.empty() && _sendStreams.front().stream->i == _sendStreams.front().stream->b.end())
+        {
+            OutgoingMessage* message = &_sendStreams.front();
+            if (message->sent())
+            {
+                callbacks.push_back(*message);
+            }
+            _sendStreams.pop_front();
+            ++sentMessages;
+        }
 
-        if (_observer)
+        // Transports without gather writes (ssl, ws) only write the first buffer, there's nothing to report.
+        if (_observer && sentMessages > 0 && _transceiver->hasGatherWrites())
         {
-            _observer.startWrite(stream);
+            _observer->coalescedMessages(sentMessages);
         }
-        op = write(stream);
-        if (!op)
+
+        if (op)
         {
+            //
+            // The transport can't accept more data. The message at the front of the queue becomes the message being
+            // sent, message() will send its remainder once the transport is ready.
+            //
+            assert(!_sendStreams.empty());
+            _writeStream.swap(*_sendStreams.front().stream);
             if (_observer)
             {
-                _observer.finishWrite(stream);
-            }
-
-            AsyncStatus status = AsyncStatusSent;
-            if (message.sent())
-            {
-                status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
+                _observer.startWrite(_writeStream);
             }
-            return status;
+            return op;
         }
+    }
+    return SocketOperationNone;
+}
 
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(&stream);
+void
+Ice::ConnectionI::uncork()
+{
+    assert(_corked);
+    _corked = false;
+    _lastWriteTime = chrono::steady_clock::now();
+    _writeStream.swap(*_sendStreams.front().stream);
+
+    vector<OutgoingMessage> callbacks;
+    if (!sendQueuedMessages(callbacks))
+    {
+        // All the messages are sent, the connection no longer needs to wait for the socket to be writable.
+        _threadPool->unregister(shared_from_this(), SocketOperationWrite);
     }
-    else
+
+    for (const auto& message : callbacks)
     {
+        message.outAsync->invokeSentAsync();
+    }
+}
 #endif
-        if (message.compress)
-        {
-            //
-            // Message not compressed. Request compressed response, if any.
-            //
-            message.stream->b[9] = byte{1};
-        }
 
-        //
-        // No compression, just fill in the message size.
-        //
-        int32_t sz = static_cast<int32_t>(message.stream->b.size());
-        const byte* p = reinterpret_cast<const byte*>(&sz);
-        if constexpr (endian::native == endian::big)
+AsyncStatus
+Ice::ConnectionI::sendMessage(OutgoingMessage& message)
+{
+    assert(_state >= StateActive);
+    assert(_state < StateClosed);
+    assert(message.stream->i == message.stream->b.begin()); // The message is prepared by prepareMessage.
+
+    // Some messages are queued for sending. Just adds the message to the send queue and tell the caller that the
+    // message was queued.
+    if (!_sendStreams.empty())
+    {
+        _sendStreams.push_back(message);
+        _sendStreams.back().adopt(0);
+#if !defined(ICE_USE_IOCP)
+        if (_corked)
         {
-            reverse_copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+            // Send the held messages right away if they reached the cork size or if they were held long enough. Once
+            // the connection is closing, they are sent by sendNextMessages which also completes the closure.
+            _corkedSize += _sendStreams.back().stream->b.size();
+            if (_state < StateClosing &&
+                (_corkedSize >= _corkSize || chrono::steady_clock::now() - _corkTime >= _corkDelay))
+            {
+                uncork();
+            }
         }
-        else
+#endif
+        return AsyncStatusQueued;
+    }
+
+#if !defined(ICE_USE_IOCP)
+    if (_corkSize > 0)
+    {
+        auto now = chrono::steady_clock::now();
+        if (_state == StateActive && message.stream->b.size() < _corkSize && now - _lastWriteTime < _corkDelay)
         {
-            copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+            // The previous write is recent: hold the message to send it with the messages sent in the meantime. The
+            // held message is swapped with _writeStream, as if it was being sent, and the connection waits for the
+            // socket to be writable to send the held messages.
+            _sendStreams.push_back(message);
+            _sendStreams.back().adopt(0);
+            _writeStream.swap(*_sendStreams.back().stream);
+            _corked = true;
+            _corkedSize = _writeStream.b.size();
+            _corkTime = now;
+            _threadPool->_register(shared_from_this(), SocketOperationWrite);
+            return AsyncStatusQueued;
         }
-        message.stream->i = message.stream->b.begin();
-
-        traceSend(*message.stream, _instance, _logger, _traceLevels);
+        _lastWriteTime = now;
+    }
+#endif
 
+    // Send the message.
+    if (_observer)
+    {
+        _observer.startWrite(*message.stream);
+    }
+    SocketOperation op = write(*message.stream);
+    if (!op)
+    {
         if (_observer)
         {
-            _observer.startWrite(*message.stream);
+            _observer.finishWrite(*message.stream);
         }
-        op = write(*message.stream);
-        if (!op)
+        AsyncStatus status = AsyncStatusSent;
+        if (message.sent())
         {
-            if (_observer)
-            {
-                _observer.finishWrite(*message.stream);
-            }
-            AsyncStatus status = AsyncStatusSent;
-            if (message.sent())
-            {
-                status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
-            }
-            return status;
+            status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
         }
-
-        _sendStreams.push_back(message);
-        _sendStreams.back().adopt(0); // Adopt the stream.
-#ifdef ICE_HAS_BZIP2
+        return status;
     }
-#endif
+
+    _sendStreams.push_back(message);
+    _sendStreams.back().adopt(0); // Adopt the stream.
 
     // The message couldn't be sent right away so we add it to the send stream queue (which is empty) and swap its
     // stream with `_writeStream`. The socket operation returned by the transceiver write is registered with the thread
@@ -2869,94 +3068,22 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     return AsyncStatusQueued;
 }
 
-#ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
-{
-    if (bzError == BZ_RUN_OK)
-    {
-        return ": BZ_RUN_OK";
-    }
-    else if (bzError == BZ_FLUSH_OK)
-    {
-        return ": BZ_FLUSH_OK";
-    }
-    else if (bzError == BZ_FINISH_OK)
-    {
-        return ": BZ_FINISH_OK";
-    }
-    else if (bzError == BZ_STREAM_END)
-    {
-        return ": BZ_STREAM_END";
-    }
-    else if (bzError == BZ_CONFIG_ERROR)
-    {
-        return ": BZ_CONFIG_ERROR";
-    }
-    else if (bzError == BZ_SEQUENCE_ERROR)
-    {
-        return ": BZ_SEQUENCE_ERROR";
-    }
-    else if (bzError == BZ_PARAM_ERROR)
-    {
-        return ": BZ_PARAM_ERROR";
-    }
-    else if (bzError == BZ_MEM_ERROR)
-    {
-        return ": BZ_MEM_ERROR";
-    }
-    else if (bzError == BZ_DATA_ERROR)
-    {
-        return ": BZ_DATA_ERROR";
-    }
-    else if (bzError == BZ_DATA_ERROR_MAGIC)
-    {
-        return ": BZ_DATA_ERROR_MAGIC";
-    }
-    else if (bzError == BZ_IO_ERROR)
-    {
-        return ": BZ_IO_ERROR";
-    }
-    else if (bzError == BZ_UNEXPECTED_EOF)
-    {
-        return ": BZ_UNEXPECTED_EOF";
-    }
-    else if (bzError == BZ_OUTBUFF_FULL)
-    {
-        return ": BZ_OUTBUFF_FULL";
-    }
-    else
-    {
-        return "";
-    }
-}
-
 void
-Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compressed)
+Ice::ConnectionI::doCompress(const CompressionCodec& codec, OutputStream& uncompressed, OutputStream& compressed) const
 {
     const byte* p;
 
     //
     // Compress the message body, but not the header.
     //
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
-    compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(
-        reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-        &compressedLen,
-        reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    compressed.b.resize(headerSize + sizeof(int32_t) + codec.compressBound(uncompressedLen));
+    size_t compressedLen = codec.compress(
+        uncompressed.b.begin() + headerSize,
         uncompressedLen,
-        _compressionLevel,
-        0,
-        0);
-    if (bzError != BZ_OK)
-    {
-        throw ProtocolException{
-            __FILE__,
-            __LINE__,
-            "cannot compress message - BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError)};
-    }
+        compressed.b.begin() + headerSize + sizeof(int32_t),
+        compressed.b.size() - headerSize - sizeof(int32_t),
+        _compressionLevel);
     compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
 
     //
@@ -2997,7 +3124,7 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
 }
 
 void
-Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed)
+Ice::ConnectionI::doUncompress(const CompressionCodec& codec, InputStream& compressed, InputStream& uncompressed) const
 {
     int32_t uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
@@ -3016,35 +3143,27 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     }
     uncompressed.resize(static_cast<size_t>(uncompressedSize));
 
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressedSize - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(int32_t));
-    int bzError = BZ2_bzBuffToBuffDecompress(
-        reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-        &uncompressedLen,
-        reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-        compressedLen,
-        0,
-        0);
-    if (bzError != BZ_OK)
-    {
-        throw ProtocolException{
-            __FILE__,
-            __LINE__,
-            "cannot decompress message - BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError)};
-    }
+    codec.decompress(
+        compressed.b.begin() + headerSize + sizeof(int32_t),
+        compressed.b.size() - headerSize - sizeof(int32_t),
+        uncompressed.b.begin() + headerSize,
+        static_cast<size_t>(uncompressedSize) - headerSize);
 
     copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
 }
-#endif
 
 SocketOperation
 Ice::ConnectionI::parseMessage(int32_t& upcallCount, function<bool(InputStream&)>& upcall, InputStream& stream)
 {
     assert(_state > StateNotValidated && _state < StateClosed);
 
-    _readStream.swap(stream);
-    _readStream.resize(headerSize);
-    _readStream.i = _readStream.b.begin();
+    // The message stream already references the message if it was received in the shared read buffer.
+    if (stream.b.empty())
+    {
+        _readStream.swap(stream);
+        _readStream.resize(headerSize);
+        _readStream.i = _readStream.b.begin();
+    }
     _readHeader = true;
 
     assert(stream.i == stream.b.end());
@@ -3063,15 +3182,26 @@ Ice::ConnectionI::parseMessage(int32_t& upcallCount, function<bool(InputStream&)
         uint8_t compress;
         stream.read(compress);
 
-        if (compress == 2)
+        if (compress >= bzip2CompressionCodecId && messageType != validateConnectionMsg)
         {
-#ifdef ICE_HAS_BZIP2
+            auto p = find_if(
+                _compressionCodecs.begin(),
+                _compressionCodecs.end(),
+                [compress](const CompressionCodecPtr& codec) { return codec->id() == compress; });
+            if (p == _compressionCodecs.end())
+            {
+                throw FeatureNotSupportedException(
+                    __FILE__,
+                    __LINE__,
+                    "Cannot uncompress message compressed with codec " + to_string(compress));
+            }
+
             InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
-            doUncompress(stream, ustream);
+            doUncompress(**p, stream, ustream);
             stream.b.swap(ustream.b);
-#else
-            throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
-#endif
+
+            // The peer supports this codec, use it for the compressed messages sent to the peer if it's preferred.
+            _peerCompressionCodecMask.fetch_or(compressionCodecMask(compress), memory_order_relaxed);
         }
         stream.i = stream.b.begin() + headerSize;
 
@@ -3190,7 +3320,7 @@ Ice::ConnectionI::parseMessage(int32_t& upcallCount, function<bool(InputStream&)
                 int32_t requestId;
                 stream.read(requestId);
 
-                map<int32_t, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.end();
+                auto q = _asyncRequests.end();
 
                 if (_asyncRequestsHint != _asyncRequests.end())
                 {
@@ -3207,7 +3337,12 @@ Ice::ConnectionI::parseMessage(int32_t& upcallCount, function<bool(InputStream&)
 
                 if (q != _asyncRequests.end())
                 {
-                    auto outAsync = q->second;
+                    auto outAsync = q->second.outAsync;
+
+                    auto roundTripTime = static_cast<double>(
+                        chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - q->second.sendTime)
+                            .count());
+                    _roundTripTime = _roundTripTime == 0 ? roundTripTime : 0.8 * _roundTripTime + 0.2 * roundTripTime;
 
                     if (q == _asyncRequestsHint)
                     {
@@ -3254,6 +3389,8 @@ Ice::ConnectionI::parseMessage(int32_t& upcallCount, function<bool(InputStream&)
             case validateConnectionMsg:
             {
                 traceRecv(stream, _logger, _traceLevels);
+                // The compression status of a heartbeat is the mask of the compression codecs supported by the peer.
+                _peerCompressionCodecMask.fetch_or(compress, memory_order_relaxed);
                 // a heartbeat has no effect on the dispatch count or the inactivity timer task.
                 break;
             }
@@ -3417,6 +3554,137 @@ ConnectionI::write(Buffer& buf)
     return op;
 }
 
+#if !defined(ICE_USE_IOCP)
+SocketOperation
+ConnectionI::writeGather(const vector<Buffer*>& bufs)
+{
+    size_t length = 0;
+    for (Buffer* buf : bufs)
+    {
+        length += static_cast<size_t>(buf->b.end() - buf->i);
+    }
+
+    SocketOperation op = _transceiver->writeGather(bufs);
+
+    // The buffers are fully written from the beginning, except for the last one which might be partially written.
+    size_t sent = 0;
+    for (Buffer* buf : bufs)
+    {
+        sent += static_cast<size_t>(buf->i - buf->b.begin());
+    }
+
+    if (_observer && sent > 0)
+    {
+        _observer->sentBytes(static_cast<int>(sent));
+    }
+
+    if (_instance->traceLevels()->network >= 3 && sent > 0)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "sent " << sent << " of " << length << " bytes from " << bufs.size() << " messages via "
+            << _endpoint->protocol() << "\n"
+            << toString();
+    }
+    return op;
+}
+
+SocketOperation
+ConnectionI::readBuffered(InputStream& stream)
+{
+    assert(_readHeader && _readStream.i == _readStream.b.begin());
+
+    if (!_readBuffer)
+    {
+        _readBuffer = make_shared<Buffer::Container>();
+        _readBuffer->resize(_readBufferSize);
+    }
+
+    SocketOperation op = SocketOperationNone;
+    while (true)
+    {
+        size_t available = _readBufferEnd - _readBufferStart;
+        size_t required = headerSize;
+        if (available >= headerSize)
+        {
+            // Connection is validated on first message (see message()).
+            _validated = true;
+
+            const byte* p = _readBuffer->begin() + _readBufferStart;
+            InputStream buffered(currentProtocolEncoding, make_pair(p, p + available));
+            required = static_cast<size_t>(readMessageHeader(buffered, _messageSizeMax));
+            if (available >= required)
+            {
+                // The message is fully received. The message stream references the message in the read buffer and
+                // keeps the read buffer alive until it's destroyed.
+                stream.view(p, p + required, _readBuffer);
+                stream.i = stream.b.end();
+                _readBufferStart += required;
+
+                // If the next message is also fully received, tell the thread pool that the connection is ready for
+                // reading since the transport might not have any more data to read.
+                size_t remaining = available - required;
+                if (!_readBufferReady && remaining >= headerSize)
+                {
+                    int32_t size;
+                    buffered.i = buffered.b.begin() + required + headerSize - sizeof(int32_t);
+                    buffered.read(size);
+                    if (size >= headerSize && static_cast<size_t>(size) <= remaining)
+                    {
+                        _readBufferReady = true;
+                        _threadPool->ready(shared_from_this(), SocketOperationRead, true);
+                    }
+                }
+                return SocketOperationNone;
+            }
+            else if (required > _readBuffer->size())
+            {
+                // The message doesn't fit in the read buffer, the remainder of the message is read in _readStream.
+                _readStream.b.resize(required);
+                memcpy(_readStream.b.begin(), p, available);
+                _readStream.i = _readStream.b.begin() + available;
+                _readBufferStart = _readBufferEnd = 0;
+                _readHeader = false;
+                return SocketOperationNone;
+            }
+        }
+
+        if (op & SocketOperationRead)
+        {
+            return op; // Can't continue without blocking.
+        }
+
+        if (_readBufferStart + required > _readBuffer->size())
+        {
+            // The partially received message doesn't fit at the end of the read buffer. Continue with a new read
+            // buffer: the messages received in the current read buffer might still be dispatched by other threads, so
+            // it's never written again once a message references it. It's released with its last message.
+            auto readBuffer = make_shared<Buffer::Container>();
+            readBuffer->resize(_readBufferSize);
+            memcpy(readBuffer->begin(), _readBuffer->begin() + _readBufferStart, available);
+            _readBuffer = std::move(readBuffer);
+            _readBufferStart = 0;
+            _readBufferEnd = available;
+        }
+
+        if (_readBufferReady)
+        {
+            _readBufferReady = false;
+            _threadPool->ready(shared_from_this(), SocketOperationRead, false);
+        }
+
+        Buffer buf(_readBuffer->begin(), _readBuffer->end());
+        buf.i = buf.b.begin() + _readBufferEnd;
+        op = read(buf);
+        size_t received = static_cast<size_t>(buf.i - buf.b.begin()) - _readBufferEnd;
+        if (_observer && received > 0)
+        {
+            _observer->receivedBytes(static_cast<int>(received));
+        }
+        _readBufferEnd += received;
+    }
+}
+#endif
+
 void
 ConnectionI::scheduleInactivityTimerTask()
 {
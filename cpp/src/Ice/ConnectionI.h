@@ -6,6 +6,7 @@
 #define ICE_CONNECTION_I_H
 
 #include "ConnectionFactoryF.h"
+#include "CompressionCodec.h"
 #include "ConnectionOptions.h"
 #include "ConnectorF.h"
 #include "EndpointIF.h"
@@ -27,15 +28,12 @@
 #include "TraceLevelsF.h"
 #include "TransceiverF.h"
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
 
-#ifndef ICE_HAS_BZIP2
-#    define ICE_HAS_BZIP2
-#endif
-
 namespace IceInternal
 {
     template<typename T> class ThreadPoolMessage;
@@ -145,6 +143,13 @@ namespace Ice
         bool isActiveOrHolding() const;
         bool isFinished() const;
 
+        // Returns the load of the connection used by the LeastLoaded endpoint selection: the number of outstanding
+        // twoway requests plus one, times the average round-trip time.
+        double load() const;
+
+        // Returns the number of outstanding twoway requests, used to balance the connections of a connection pool.
+        size_t outstandingRequestCount() const;
+
         void throwException() const final; // From Connection. Throws the connection exception if destroyed.
 
         void waitUntilHolding() const;
@@ -295,16 +300,39 @@ namespace Ice
         /// pending message being sent (_sendStreams.First).
         IceInternal::SocketOperation sendNextMessages(std::vector<OutgoingMessage>& callbacks);
 
+        /// Prepares the given message for sending: compresses it with the compression codec negotiated with the peer if
+        /// requested or fills in its size, resets its stream iterator to the beginning of the message and traces it.
+        /// This is called before the message is sent or queued, without the connection mutex locked for requests and
+        /// responses.
+        ///
+        /// @param message The message to prepare.
+        /// @param compressed The stream which receives the compressed message. If the message is compressed, it
+        /// becomes the message stream.
+        void prepareMessage(OutgoingMessage& message, Ice::OutputStream& compressed) const;
+
+#if !defined(ICE_USE_IOCP)
+        /// Sends the queued messages with gather writes. Fully sent messages are removed from _sendStreams and their
+        /// sent callback (if any) is queued in the given callback queue.
+        ///
+        /// @param callbacks The sent callbacks to call for the messages that were sent.
+        /// @return The socket operation to register with the thread pool's selector if the transport can't accept
+        /// more data. In this case, the message at the front of _sendStreams is swapped with _writeStream.
+        IceInternal::SocketOperation sendQueuedMessages(std::vector<OutgoingMessage>& callbacks);
+
+        /// Sends the messages held by the cork mode with a single gather write, from the thread sending a message when
+        /// the held messages reach the cork size or delay. The sent callbacks of the held messages are called
+        /// asynchronously.
+        void uncork();
+#endif
+
         /// Sends or queues the given message.
         ///
         /// @param message The message to send.
         /// @return The send status.
         IceInternal::AsyncStatus sendMessage(OutgoingMessage& message);
 
-#ifdef ICE_HAS_BZIP2
-        void doCompress(Ice::OutputStream&, Ice::OutputStream&);
-        void doUncompress(Ice::InputStream&, Ice::InputStream&);
-#endif
+        void doCompress(const IceInternal::CompressionCodec&, Ice::OutputStream&, Ice::OutputStream&) const;
+        void doUncompress(const IceInternal::CompressionCodec&, Ice::InputStream&, Ice::InputStream&) const;
 
         IceInternal::SocketOperation parseMessage(
             std::int32_t& upcallCount,
@@ -318,6 +346,19 @@ namespace Ice
 
         IceInternal::SocketOperation read(IceInternal::Buffer&);
         IceInternal::SocketOperation write(IceInternal::Buffer&);
+#if !defined(ICE_USE_IOCP)
+        IceInternal::SocketOperation writeGather(const std::vector<IceInternal::Buffer*>&);
+
+        /// Reads data in the shared read buffer until the next message is fully received. The message stream then
+        /// references the message in the read buffer. If the message is larger than the read buffer, its received
+        /// data is copied to _readStream and _readHeader is cleared to read the remainder of the message in
+        /// _readStream.
+        ///
+        /// @param messageStream The stream set to reference the received message.
+        /// @return SocketOperationRead if the message isn't fully received and the transport has no more data to
+        /// read, SocketOperationNone otherwise.
+        IceInternal::SocketOperation readBuffered(Ice::InputStream& messageStream);
+#endif
 
         void scheduleInactivityTimerTask();
         void cancelInactivityTimerTask();
@@ -360,10 +401,28 @@ namespace Ice
 
         const int _compressionLevel;
 
-        std::int32_t _nextRequestId;
+        // The compression codecs, in order of preference, and the mask of their ids advertised to the peer.
+        const std::vector<IceInternal::CompressionCodecPtr> _compressionCodecs;
+        const std::uint8_t _compressionCodecMask;
+
+        // The mask of the ids of the compression codecs supported by the peer. It's updated when the peer advertises
+        // its codecs with a ValidateConnection message or sends a message compressed with a codec.
+        std::atomic<std::uint8_t> _peerCompressionCodecMask;
+
+        // Request IDs are allocated without the connection mutex locked since requests are prepared before locking.
+        std::atomic<std::int32_t> _nextRequestId;
 
-        std::map<std::int32_t, IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
-        std::map<std::int32_t, IceInternal::OutgoingAsyncBasePtr>::iterator _asyncRequestsHint;
+        // A twoway request waiting for its reply, with the time it was sent.
+        struct AsyncRequest
+        {
+            IceInternal::OutgoingAsyncBasePtr outAsync;
+            std::chrono::steady_clock::time_point sendTime;
+        };
+        std::map<std::int32_t, AsyncRequest> _asyncRequests;
+        std::map<std::int32_t, AsyncRequest>::iterator _asyncRequestsHint;
+
+        // The exponentially weighted moving average of the round-trip time of twoway requests, in microseconds.
+        double _roundTripTime;
 
         std::exception_ptr _exception;
 
@@ -381,6 +440,33 @@ namespace Ice
         // reading next the remainder of a message that was already partially received.
         bool _readHeader;
 
+        // The size of the shared read buffer, or 0 if messages are only received in _readStream. With a shared read
+        // buffer, the transport reads several messages at once in the read buffer and the messages are dispatched
+        // from the read buffer without copying them. The read buffer is kept alive by the streams of the messages
+        // being dispatched, and it's only written at its end: a new read buffer is allocated when it's full.
+        const size_t _readBufferSize;
+        std::shared_ptr<IceInternal::Buffer::Container> _readBuffer;
+
+        // The received data not yet parsed is between _readBufferStart and _readBufferEnd.
+        size_t _readBufferStart = 0;
+        size_t _readBufferEnd = 0;
+
+        // True if the connection was marked as ready for reading because the read buffer contains a fully received
+        // message.
+        bool _readBufferReady = false;
+
+        // With the cork mode, a message sent less than _corkDelay after the previous write is held in _sendStreams
+        // instead of being written right away. The messages sent while it's held are queued behind it and they are
+        // all sent with a single gather write once the socket is writable, or by the sending thread once the held
+        // messages reach _corkSize bytes or the first held message was held for _corkDelay. The cork mode is
+        // disabled if _corkSize is 0.
+        const size_t _corkSize;
+        const std::chrono::microseconds _corkDelay;
+        bool _corked = false;
+        size_t _corkedSize = 0;
+        std::chrono::steady_clock::time_point _corkTime;
+        std::chrono::steady_clock::time_point _lastWriteTime;
+
         // Contains the message which is being sent. The write stream buffer is empty if no message is being sent.
         Ice::OutputStream _writeStream;
 
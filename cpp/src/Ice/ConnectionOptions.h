@@ -6,6 +6,7 @@
 #define ICE_CONNECTION_OPTIONS_H
 
 #include <chrono>
+#include <cstddef>
 
 namespace Ice
 {
@@ -17,6 +18,9 @@ namespace Ice
         std::chrono::seconds idleTimeout = std::chrono::seconds(60);
         bool enableIdleCheck = true;
         std::chrono::seconds inactivityTimeout = std::chrono::seconds(300);
+        std::size_t readBufferSize = 0;
+        std::size_t corkSize = 0;
+        std::chrono::microseconds corkDelay = std::chrono::microseconds(100);
     };
 }
 
@@ -58,9 +58,25 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
     {
         defaultEndpointSelection = EndpointSelectionType::Ordered;
     }
+    else if (value == "LeastLoaded")
+    {
+        defaultEndpointSelection = EndpointSelectionType::LeastLoaded;
+    }
     else
     {
-        throw ParseException(__FILE__, __LINE__, "illegal value '" + value + "'; expected 'Random' or 'Ordered'");
+        throw ParseException(
+            __FILE__,
+            __LINE__,
+            "illegal value '" + value + "'; expected 'Random', 'Ordered' or 'LeastLoaded'");
+    }
+
+    const_cast<int&>(defaultConnectionPoolSize) = properties->getIcePropertyAsInt("Ice.Default.ConnectionPoolSize");
+    if (defaultConnectionPoolSize < 1)
+    {
+        const_cast<int32_t&>(defaultConnectionPoolSize) = 1;
+        Warning out(logger);
+        out << "invalid value for Ice.Default.ConnectionPoolSize `"
+            << properties->getIceProperty("Ice.Default.ConnectionPoolSize") << "': defaulting to 1";
     }
 
     const_cast<int&>(defaultInvocationTimeout) = properties->getIcePropertyAsInt("Ice.Default.InvocationTimeout");
@@ -25,6 +25,7 @@ namespace IceInternal
         std::string defaultProtocol;
         bool defaultCollocationOptimization;
         Ice::EndpointSelectionType defaultEndpointSelection;
+        int defaultConnectionPoolSize;
         int defaultInvocationTimeout;
         int defaultLocatorCacheTimeout;
         bool defaultPreferSecure;
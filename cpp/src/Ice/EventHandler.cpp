@@ -20,7 +20,8 @@ IceInternal::EventHandler::EventHandler()
       _disabled(SocketOperationNone),
 #endif
       _ready(SocketOperationNone),
-      _registered(SocketOperationNone)
+      _registered(SocketOperationNone),
+      _reactor(nullptr)
 {
 }
 
@@ -62,6 +62,9 @@ namespace IceInternal
         SocketOperation _ready;
         SocketOperation _registered;
 
+        // The reactor of a multi-reactor thread pool that this handler is pinned to, set by ThreadPool::initialize.
+        ThreadPool* _reactor;
+
         friend class ThreadPool;
         friend class ThreadPoolCurrent;
         friend class Selector;
@@ -0,0 +1,102 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "HedgingPolicy.h"
+#include "HashUtil.h"
+#include "Reference.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+    // The number of latencies to record before hedging an operation.
+    const size_t minSamples = 32;
+
+    // The maximum budget, in hundredths of a hedged invocation: up to 10 invocations can be hedged in a row when the
+    // latencies of an operation suddenly increase. The budget starts empty and grows with each invocation.
+    const int32_t maxBudget = 10 * 100;
+
+    // The maximum number of latencies kept by each of the 16 shards, about 2KB each.
+    const size_t maxShardSize = 64;
+}
+
+HedgingPolicy::HedgingPolicy(int percentile, chrono::milliseconds minDelay, int budget)
+    : _percentile(percentile),
+      _minDelay(chrono::duration_cast<chrono::microseconds>(minDelay)),
+      _budget(budget)
+{
+}
+
+size_t
+HedgingPolicy::key(const ReferencePtr& reference, string_view operation) noexcept
+{
+    size_t h = reference->targetHash();
+    hashAdd(h, operation);
+    return h;
+}
+
+chrono::microseconds
+HedgingPolicy::delay(size_t key)
+{
+    LatenciesShard& shard = getShard(key);
+    lock_guard lock(shard.mutex);
+    auto p = shard.latencies.find(key);
+    if (p == shard.latencies.end())
+    {
+        return chrono::microseconds::zero();
+    }
+    p->second.budget = min(p->second.budget + _budget, maxBudget);
+    p->second.lastUse = ++shard.useCount;
+    return p->second.delay;
+}
+
+void
+HedgingPolicy::record(size_t key, chrono::microseconds latency)
+{
+    LatenciesShard& shard = getShard(key);
+    lock_guard lock(shard.mutex);
+    auto p = shard.latencies.find(key);
+    if (p == shard.latencies.end())
+    {
+        if (shard.latencies.size() >= maxShardSize)
+        {
+            shard.latencies.erase(min_element(
+                shard.latencies.begin(),
+                shard.latencies.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.second.lastUse < rhs.second.lastUse; }));
+        }
+        p = shard.latencies.emplace(key, Latencies{}).first;
+    }
+
+    Latencies& latencies = p->second;
+    latencies.lastUse = ++shard.useCount;
+    latencies.samples[latencies.count++ % latencies.samples.size()] = latency.count();
+    if (latencies.count >= minSamples && latencies.count % 16 == 0)
+    {
+        vector<int64_t> samples(
+            latencies.samples.begin(),
+            latencies.samples.begin() + static_cast<ptrdiff_t>(min(latencies.count, latencies.samples.size())));
+        auto nth = samples.begin() + static_cast<ptrdiff_t>(samples.size() * static_cast<size_t>(_percentile) / 100);
+        nth_element(samples.begin(), nth, samples.end());
+        latencies.delay = max(chrono::microseconds(*nth), _minDelay);
+    }
+}
+
+bool
+HedgingPolicy::takeBudget(size_t key)
+{
+    LatenciesShard& shard = getShard(key);
+    lock_guard lock(shard.mutex);
+    auto p = shard.latencies.find(key);
+    if (p == shard.latencies.end() || p->second.budget < 100)
+    {
+        return false;
+    }
+    p->second.budget -= 100;
+    return true;
+}
@@ -0,0 +1,70 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_HEDGING_POLICY_H
+#define ICE_HEDGING_POLICY_H
+
+#include "HedgingPolicyF.h"
+#include "Ice/ReferenceF.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace IceInternal
+{
+    // Computes the delay after which an invocation of an idempotent operation is hedged, that is, duplicated. The
+    // delay is a percentile of the latencies recently recorded for the operation on the same target, configured with
+    // Ice.Hedging.Percentile and bounded by Ice.Hedging.MinDelay. The number of hedged invocations of an operation on
+    // a target is limited by Ice.Hedging.Budget, a percentage of its invocations.
+    class HedgingPolicy final
+    {
+    public:
+        HedgingPolicy(int percentile, std::chrono::milliseconds minDelay, int budget);
+
+        // Returns the key of the latencies of the given operation invoked on the target of the given reference.
+        static std::size_t key(const ReferencePtr&, std::string_view operation) noexcept;
+
+        // Returns the hedging delay of an invocation, or zero if not enough latencies were recorded yet. Each
+        // invocation adds to the hedging budget.
+        std::chrono::microseconds delay(std::size_t key);
+
+        void record(std::size_t key, std::chrono::microseconds latency);
+
+        // Takes a hedged invocation from the budget, returns false if the budget is exhausted.
+        bool takeBudget(std::size_t key);
+
+    private:
+        struct Latencies
+        {
+            std::array<std::int64_t, 256> samples; // The most recent latencies, in microseconds.
+            std::size_t count = 0;
+            std::chrono::microseconds delay{0}; // Recomputed every 16 samples.
+            std::int32_t budget = 0;            // In hundredths of a hedged invocation.
+            std::uint64_t lastUse = 0;          // The shard use count when these latencies were last used.
+        };
+
+        // The latencies are sharded by key, each shard with its own mutex: concurrent invocations only share a lock
+        // when they invoke operations of the same shard. A shard holds a bounded number of latencies, the least
+        // recently used latencies are evicted to make room for new ones.
+        struct LatenciesShard
+        {
+            std::mutex mutex;
+            std::unordered_map<std::size_t, Latencies> latencies;
+            std::uint64_t useCount = 0;
+        };
+
+        LatenciesShard& getShard(std::size_t key) { return _shards[key % _shards.size()]; }
+
+        const int _percentile;
+        const std::chrono::microseconds _minDelay;
+        const std::int32_t _budget;
+        std::array<LatenciesShard, 16> _shards;
+    };
+}
+
+#endif
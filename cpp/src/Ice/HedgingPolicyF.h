@@ -0,0 +1,16 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_HEDGING_POLICY_F_H
+#define ICE_HEDGING_POLICY_F_H
+
+#include <memory>
+
+namespace IceInternal
+{
+    class HedgingPolicy;
+    using HedgingPolicyPtr = std::shared_ptr<HedgingPolicy>;
+}
+
+#endif
@@ -120,6 +120,19 @@ IdleTimeoutTransceiverDecorator::write(Buffer& buf)
     return op;
 }
 
+SocketOperation
+IdleTimeoutTransceiverDecorator::writeGather(const vector<Buffer*>& bufs)
+{
+    _timer->cancel(_heartbeatTimerTask);
+
+    SocketOperation op = _decoratee->writeGather(bufs);
+    if (op == SocketOperationNone) // write completed
+    {
+        _timer->schedule(_heartbeatTimerTask, chrono::milliseconds(_idleTimeout) / 2);
+    }
+    return op;
+}
+
 #if defined(ICE_USE_IOCP)
 bool
 IdleTimeoutTransceiverDecorator::startWrite(Buffer& buf)
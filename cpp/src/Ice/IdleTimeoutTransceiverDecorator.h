@@ -51,6 +51,8 @@ namespace IceInternal
 
         SocketOperation write(Buffer&) final;
         SocketOperation read(Buffer&) final;
+        SocketOperation writeGather(const std::vector<Buffer*>&) final;
+        bool hasGatherWrites() const noexcept final { return _decoratee->hasGatherWrites(); }
 
 #if defined(ICE_USE_IOCP)
         bool startWrite(Buffer&) final;
@@ -10,6 +10,7 @@
 #include "DisableWarnings.h"
 #include "EndpointFactoryManager.h"
 #include "FileUtil.h"
+#include "HedgingPolicy.h"
 #include "IPEndpointI.h" // For EndpointHostResolver
 #include "Ice/Communicator.h"
 #include "Ice/Initialize.h"
@@ -42,6 +43,7 @@
 #include "ValueFactoryManagerI.h"
 #include "WSEndpoint.h"
 
+#include <algorithm>
 #include <list>
 #include <mutex>
 #include <stdio.h>
@@ -484,6 +486,59 @@ IceInternal::Instance::pluginManager() const
     return _pluginManager;
 }
 
+void
+IceInternal::Instance::addCompressionCodec(const CompressionCodecPtr& codec)
+{
+    if (codec->id() < bzip2CompressionCodecId || codec->id() > maxCompressionCodecId)
+    {
+        throw InitializationException(
+            __FILE__,
+            __LINE__,
+            "invalid id " + to_string(codec->id()) + " for compression codec `" + string{codec->name()} + "'");
+    }
+
+    lock_guard lock(_mutex);
+    auto p = find_if(
+        _compressionCodecs.begin(),
+        _compressionCodecs.end(),
+        [&codec](const CompressionCodecPtr& c) { return c->id() == codec->id(); });
+    if (p != _compressionCodecs.end())
+    {
+        *p = codec;
+    }
+    else
+    {
+        _compressionCodecs.push_back(codec);
+    }
+}
+
+vector<CompressionCodecPtr>
+IceInternal::Instance::compressionCodecs() const
+{
+    vector<CompressionCodecPtr> codecs;
+    {
+        lock_guard lock(_mutex);
+        codecs = _compressionCodecs;
+    }
+
+    // Keep the listed codecs in order of preference. bzip2 is kept even if it's not listed: it's supported by all Ice
+    // versions, and peers which don't advertise their codecs only use bzip2.
+    auto q = codecs.begin();
+    for (const auto& name : _initData.properties->getIcePropertyAsList("Ice.Compression.Codecs"))
+    {
+        auto p = find_if(q, codecs.end(), [&name](const CompressionCodecPtr& c) { return c->name() == name; });
+        if (p != codecs.end())
+        {
+            rotate(q, p, p + 1);
+            ++q;
+        }
+    }
+    codecs.erase(
+        remove_if(q, codecs.end(), [](const CompressionCodecPtr& c) { return c->id() != bzip2CompressionCodecId; }),
+        codecs.end());
+    return codecs;
+}
+
 ConnectionOptions
 IceInternal::Instance::serverConnectionOptions(const string& adapterName) const
 {
@@ -509,6 +564,21 @@ IceInternal::Instance::serverConnectionOptions(const string& adapterName) const
         connectionOptions.inactivityTimeout = chrono::seconds(properties->getPropertyAsIntWithDefault(
             adapterName + ".Connection.InactivityTimeout",
             static_cast<int>(connectionOptions.inactivityTimeout.count())));
+        connectionOptions.readBufferSize = static_cast<size_t>(max(
+            properties->getPropertyAsIntWithDefault(
+                adapterName + ".Connection.ReadBufferSize",
+                static_cast<int>(connectionOptions.readBufferSize)),
+            0));
+        connectionOptions.corkSize = static_cast<size_t>(max(
+            properties->getPropertyAsIntWithDefault(
+                adapterName + ".Connection.CorkSize",
+                static_cast<int>(connectionOptions.corkSize)),
+            0));
+        connectionOptions.corkDelay = chrono::microseconds(max(
+            properties->getPropertyAsIntWithDefault(
+                adapterName + ".Connection.CorkDelay",
+                static_cast<int>(connectionOptions.corkDelay.count())),
+            0));
     }
     return connectionOptions;
 }
@@ -888,6 +958,8 @@ IceInternal::Instance::Instance(const InitializationData& initData)
       _initData(initData),
       _messageSizeMax(0),
       _batchAutoFlushSize(0),
+      _batchAutoFlushDelay(0),
+      _propagateDeadline(false),
       _classGraphDepthMax(0),
       _toStringMode(ToStringMode::Unicode),
       _acceptClassCycles(false),
@@ -1118,6 +1190,21 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
             connectionOptions.inactivityTimeout = chrono::seconds(properties->getPropertyAsIntWithDefault(
                 "Ice.Connection.InactivityTimeout",
                 static_cast<int>(connectionOptions.inactivityTimeout.count())));
+            connectionOptions.readBufferSize = static_cast<size_t>(max(
+                properties->getPropertyAsIntWithDefault(
+                    "Ice.Connection.ReadBufferSize",
+                    static_cast<int>(connectionOptions.readBufferSize)),
+                0));
+            connectionOptions.corkSize = static_cast<size_t>(max(
+                properties->getPropertyAsIntWithDefault(
+                    "Ice.Connection.CorkSize",
+                    static_cast<int>(connectionOptions.corkSize)),
+                0));
+            connectionOptions.corkDelay = chrono::microseconds(max(
+                properties->getPropertyAsIntWithDefault(
+                    "Ice.Connection.CorkDelay",
+                    static_cast<int>(connectionOptions.corkDelay.count())),
+                0));
         }
 
         {
@@ -1159,6 +1246,45 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
             }
         }
 
+        {
+            // Property is in milliseconds, 0 or a negative value disables the time-based auto-flush.
+            int32_t num = _initData.properties->getIcePropertyAsInt("Ice.BatchAutoFlushDelay");
+            if (num > 0)
+            {
+                const_cast<chrono::milliseconds&>(_batchAutoFlushDelay) = chrono::milliseconds(num);
+            }
+        }
+
+        {
+            // The hedging percentile must be between 1 and 99, 0 (the default) disables hedging.
+            int32_t percentile = _initData.properties->getIcePropertyAsInt("Ice.Hedging.Percentile");
+            if (percentile > 0)
+            {
+                if (percentile > 99)
+                {
+                    throw InitializationException(
+                        __FILE__,
+                        __LINE__,
+                        "invalid value for Ice.Hedging.Percentile: " + to_string(percentile));
+                }
+                int32_t minDelay = _initData.properties->getIcePropertyAsInt("Ice.Hedging.MinDelay");
+
+                // The budget is the percentage of the invocations of an operation that can be hedged.
+                int32_t budget = _initData.properties->getIcePropertyAsInt("Ice.Hedging.Budget");
+                if (budget < 0 || budget > 100)
+                {
+                    throw InitializationException(
+                        __FILE__,
+                        __LINE__,
+                        "invalid value for Ice.Hedging.Budget: " + to_string(budget));
+                }
+                _hedgingPolicy =
+                    make_shared<HedgingPolicy>(percentile, chrono::milliseconds(max(minDelay, 0)), budget);
+            }
+        }
+
+        const_cast<bool&>(_propagateDeadline) = _initData.properties->getIcePropertyAsInt("Ice.PropagateDeadline") > 0;
+
         {
             int32_t num = _initData.properties->getIcePropertyAsInt("Ice.ClassGraphDepthMax");
             if (num < 1 || static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff))
@@ -1245,6 +1371,8 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
 
         _pluginManager = make_shared<PluginManagerI>(communicator);
 
+        _compressionCodecs = createBuiltinCompressionCodecs();
+
         if (!_initData.valueFactoryManager)
         {
             _initData.valueFactoryManager = make_shared<ValueFactoryManagerI>();
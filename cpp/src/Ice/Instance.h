@@ -5,10 +5,12 @@
 #ifndef ICE_INSTANCE_H
 #define ICE_INSTANCE_H
 
+#include "CompressionCodec.h"
 #include "ConnectionFactoryF.h"
 #include "ConnectionOptions.h"
 #include "DefaultsAndOverridesF.h"
 #include "EndpointFactoryManagerF.h"
+#include "HedgingPolicyF.h"
 #include "IPEndpointIF.h"
 #include "Ice/CommunicatorF.h"
 #include "Ice/Config.h"
@@ -86,8 +88,20 @@ namespace IceInternal
         Ice::TimerPtr timer();
         EndpointFactoryManagerPtr endpointFactoryManager() const;
         Ice::PluginManagerPtr pluginManager() const;
+
+        // Adds a compression codec, replacing the codec with the same id if any. Typically called by a plug-in.
+        void addCompressionCodec(const CompressionCodecPtr&);
+
+        // Returns the compression codecs listed by Ice.Compression.Codecs in order of preference, followed by bzip2 if
+        // it's not listed.
+        std::vector<CompressionCodecPtr> compressionCodecs() const;
         size_t messageSizeMax() const { return _messageSizeMax; }
         size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
+        std::chrono::milliseconds batchAutoFlushDelay() const { return _batchAutoFlushDelay; }
+        // Returns the hedging policy of idempotent invocations, or null if hedging is disabled.
+        const HedgingPolicyPtr& hedgingPolicy() const { return _hedgingPolicy; }
+        // Returns true if invocations with an invocation timeout send their deadline in the request context.
+        bool propagateDeadline() const { return _propagateDeadline; }
         size_t classGraphDepthMax() const { return _classGraphDepthMax; }
         Ice::ToStringMode toStringMode() const { return _toStringMode; }
         bool acceptClassCycles() const { return _acceptClassCycles; }
@@ -143,13 +157,16 @@ namespace IceInternal
         };
         State _state;
         Ice::InitializationData _initData;
-        const TraceLevelsPtr _traceLevels;                   // Immutable, not reset by destroy().
-        const DefaultsAndOverridesPtr _defaultsAndOverrides; // Immutable, not reset by destroy().
-        const size_t _messageSizeMax;                        // Immutable, not reset by destroy().
-        const size_t _batchAutoFlushSize;                    // Immutable, not reset by destroy().
-        const size_t _classGraphDepthMax;                    // Immutable, not reset by destroy().
-        const Ice::ToStringMode _toStringMode;               // Immutable, not reset by destroy()
-        const bool _acceptClassCycles;                       // Immutable, not reset by destroy()
+        const TraceLevelsPtr _traceLevels;                    // Immutable, not reset by destroy().
+        const DefaultsAndOverridesPtr _defaultsAndOverrides;  // Immutable, not reset by destroy().
+        const size_t _messageSizeMax;                         // Immutable, not reset by destroy().
+        const size_t _batchAutoFlushSize;                     // Immutable, not reset by destroy().
+        const std::chrono::milliseconds _batchAutoFlushDelay; // Immutable, not reset by destroy().
+        HedgingPolicyPtr _hedgingPolicy;                      // Immutable, not reset by destroy().
+        const bool _propagateDeadline;                        // Immutable, not reset by destroy().
+        const size_t _classGraphDepthMax;                     // Immutable, not reset by destroy().
+        const Ice::ToStringMode _toStringMode;                // Immutable, not reset by destroy()
+        const bool _acceptClassCycles;                        // Immutable, not reset by destroy()
         Ice::ConnectionOptions _clientConnectionOptions;
         RouterManagerPtr _routerManager;
         LocatorManagerPtr _locatorManager;
@@ -168,6 +185,7 @@ namespace IceInternal
         ThreadObserverTimerPtr _timer;
         EndpointFactoryManagerPtr _endpointFactoryManager;
         Ice::PluginManagerPtr _pluginManager;
+        std::vector<CompressionCodecPtr> _compressionCodecs;
         const Ice::ImplicitContextPtr _implicitContext;
         Ice::StringConverterPtr _stringConverter;
         Ice::WstringConverterPtr _wstringConverter;
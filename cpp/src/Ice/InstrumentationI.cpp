@@ -3,6 +3,8 @@
 //
 
 #include "InstrumentationI.h"
+#include "BufferPool.h"
+#include "ConcurrencyLimitMiddleware.h"
 
 #include "Ice/Communicator.h"
 #include "Ice/Connection.h"
@@ -12,12 +14,62 @@
 #include "Ice/ObjectAdapter.h"
 #include "Ice/VersionFunctions.h"
 
+#include <algorithm>
+#include <mutex>
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 using namespace Ice::Instrumentation;
 using namespace IceMX;
 
+namespace IceInternal
+{
+    // The concurrency limiters of the communicator's object adapters, shared by the observer and the
+    // ConcurrencyLimit metrics map.
+    class ConcurrencyLimiters
+    {
+    public:
+        void add(const ConcurrencyLimitMiddlewarePtr& limiter)
+        {
+            lock_guard lock(_mutex);
+
+            // Forget the limiters of the destroyed object adapters.
+            _limiters.erase(
+                remove_if(_limiters.begin(), _limiters.end(), [](const auto& p) { return p.expired(); }),
+                _limiters.end());
+            _limiters.push_back(limiter);
+        }
+
+        vector<ConcurrencyLimitMiddleware::Stats> getStats() const
+        {
+            vector<ConcurrencyLimitMiddlewarePtr> limiters;
+            {
+                lock_guard lock(_mutex);
+                for (const auto& p : _limiters)
+                {
+                    if (auto limiter = p.lock())
+                    {
+                        limiters.push_back(std::move(limiter));
+                    }
+                }
+            }
+
+            vector<ConcurrencyLimitMiddleware::Stats> stats;
+            stats.reserve(limiters.size());
+            for (const auto& limiter : limiters)
+            {
+                stats.push_back(limiter->stats());
+            }
+            return stats;
+        }
+
+    private:
+        mutable mutex _mutex;
+        vector<weak_ptr<ConcurrencyLimitMiddleware>> _limiters;
+    };
+}
+
 namespace
 {
     int ThreadMetrics::*getThreadStateMetric(ThreadState s)
@@ -58,6 +110,144 @@ namespace
         ThreadState newState;
     };
 
+    struct CoalescedWrite
+    {
+        CoalescedWrite(int32_t messagesP) : messages(messagesP) {}
+
+        void operator()(const ConnectionMetricsPtr& v)
+        {
+            v->coalescedWrites = v->coalescedWrites.value_or(0) + 1;
+            v->coalescedMessages = v->coalescedMessages.value_or(0) + messages;
+        }
+
+        int32_t messages;
+    };
+
+    struct QueueDepth
+    {
+        QueueDepth(int32_t depthP) : depth(depthP) {}
+
+        void operator()(const ThreadMetricsPtr& v) { v->queueDepth = depth; }
+
+        int32_t depth;
+    };
+
+    //
+    // The buffer pool map doesn't use observers, its metrics are computed from the buffer pool statistics when the
+    // map is retrieved.
+    //
+    class BufferPoolMetricsMapI final : public MetricsMapI
+    {
+    public:
+        BufferPoolMetricsMapI(const string& mapPrefix, const PropertiesPtr& properties)
+            : MetricsMapI(mapPrefix, properties)
+        {
+        }
+
+        void destroy() final {}
+
+        MetricsFailuresSeq getFailures() final { return MetricsFailuresSeq(); }
+
+        MetricsFailures getFailures(const string&) final { return MetricsFailures(); }
+
+        MetricsMap getMetrics() const final
+        {
+            MetricsMap objects;
+            for (const auto& stats : getBufferPoolStats())
+            {
+                if (stats.hits == 0 && stats.misses == 0)
+                {
+                    continue; // Skip unused size classes.
+                }
+
+                auto metrics = make_shared<BufferPoolMetrics>();
+                metrics->id = to_string(stats.size);
+                metrics->total = stats.hits + stats.misses;
+                metrics->current = static_cast<int32_t>(stats.inUse);
+                metrics->hits = stats.hits;
+                metrics->misses = stats.misses;
+                metrics->bytesHeld = stats.bytesHeld;
+                objects.push_back(metrics);
+            }
+            return objects;
+        }
+
+        MetricsMapIPtr clone() const final { return make_shared<BufferPoolMetricsMapI>(*this); }
+    };
+
+    class BufferPoolMetricsMapFactory final : public MetricsMapFactory
+    {
+    public:
+        BufferPoolMetricsMapFactory() : MetricsMapFactory(nullptr) {}
+
+        MetricsMapIPtr create(const string& mapPrefix, const PropertiesPtr& properties) final
+        {
+            return make_shared<BufferPoolMetricsMapI>(mapPrefix, properties);
+        }
+    };
+
+    //
+    // The concurrency limit map doesn't use observers either, its metrics are computed from the statistics of the
+    // object adapter concurrency limiters when the map is retrieved.
+    //
+    class ConcurrencyLimitMetricsMapI final : public MetricsMapI
+    {
+    public:
+        ConcurrencyLimitMetricsMapI(
+            const string& mapPrefix,
+            const PropertiesPtr& properties,
+            shared_ptr<ConcurrencyLimiters> limiters)
+            : MetricsMapI(mapPrefix, properties),
+              _limiters(std::move(limiters))
+        {
+        }
+
+        void destroy() final {}
+
+        MetricsFailuresSeq getFailures() final { return MetricsFailuresSeq(); }
+
+        MetricsFailures getFailures(const string&) final { return MetricsFailures(); }
+
+        MetricsMap getMetrics() const final
+        {
+            MetricsMap objects;
+            for (const auto& stats : _limiters->getStats())
+            {
+                auto metrics = make_shared<ConcurrencyLimitMetrics>();
+                metrics->id = stats.adapterName;
+                metrics->total = stats.admitted;
+                metrics->current = stats.inFlight;
+                metrics->limit = stats.limit;
+                metrics->rejected = stats.rejected;
+                objects.push_back(metrics);
+            }
+            return objects;
+        }
+
+        MetricsMapIPtr clone() const final { return make_shared<ConcurrencyLimitMetricsMapI>(*this); }
+
+    private:
+        const shared_ptr<ConcurrencyLimiters> _limiters;
+    };
+
+    class ConcurrencyLimitMetricsMapFactory final : public MetricsMapFactory
+    {
+    public:
+        ConcurrencyLimitMetricsMapFactory(shared_ptr<ConcurrencyLimiters> limiters)
+            : MetricsMapFactory(nullptr),
+              _limiters(std::move(limiters))
+        {
+        }
+
+        MetricsMapIPtr create(const string& mapPrefix, const PropertiesPtr& properties) final
+        {
+            return make_shared<ConcurrencyLimitMetricsMapI>(mapPrefix, properties, _limiters);
+        }
+
+    private:
+        const shared_ptr<ConcurrencyLimiters> _limiters;
+    };
+
     IPConnectionInfo* getIPConnectionInfo(const ConnectionInfoPtr& info)
     {
         for (ConnectionInfoPtr p = info; p; p = p->underlying)
@@ -207,6 +397,34 @@ namespace
 
         virtual void initMetrics(const DispatchMetricsPtr& v) const { v->size += _size; }
 
+        virtual void initHistograms(MetricsMapT<DispatchMetrics>::EntryT& entry) const
+        {
+            entry.record(&DispatchMetrics::sizes, _size);
+        }
+
+        virtual bool isCacheable(const string& attribute) const
+        {
+            return attribute == "parent" || attribute == "id" || attribute == "operation" || attribute == "identity" ||
+                   attribute == "facet" || attribute == "mode";
+        }
+
+        virtual string getCacheKey() const
+        {
+            // The adapter, identity, facet, operation and mode of the dispatch.
+            string key = _current.adapter->getName();
+            key += '\0';
+            key += _current.id.category;
+            key += '\0';
+            key += _current.id.name;
+            key += '\0';
+            key += _current.facet;
+            key += '\0';
+            key += _current.operation;
+            key += '\0';
+            key += _current.requestId == 0 ? 'o' : 't';
+            return key;
+        }
+
         string resolve(const string& attribute) const
         {
             if (attribute.compare(0, 8, "context.") == 0)
@@ -439,6 +657,11 @@ namespace
 
         virtual void initMetrics(const RemoteMetricsPtr& v) const { v->size += _size; }
 
+        virtual void initHistograms(MetricsMapT<RemoteMetrics>::EntryT& entry) const
+        {
+            entry.record(&RemoteMetrics::sizes, _size);
+        }
+
         const string& getId() const
         {
             if (_id.empty())
@@ -635,6 +858,7 @@ void
 ConnectionObserverI::sentBytes(int32_t num)
 {
     forEach(add(&ConnectionMetrics::sentBytes, num));
+    record(&ConnectionMetrics::sentSizes, num);
     if (_delegate)
     {
         _delegate->sentBytes(num);
@@ -645,12 +869,23 @@ void
 ConnectionObserverI::receivedBytes(int32_t num)
 {
     forEach(add(&ConnectionMetrics::receivedBytes, num));
+    record(&ConnectionMetrics::receivedSizes, num);
     if (_delegate)
     {
         _delegate->receivedBytes(num);
     }
 }
 
+void
+ConnectionObserverI::coalescedMessages(int32_t num)
+{
+    forEach(CoalescedWrite(num));
+    if (_delegate)
+    {
+        _delegate->coalescedMessages(num);
+    }
+}
+
 void
 ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 {
@@ -661,6 +896,16 @@ ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
     }
 }
 
+void
+ThreadObserverI::queueDepth(int32_t depth)
+{
+    forEach(QueueDepth(depth));
+    if (_delegate)
+    {
+        _delegate->queueDepth(depth);
+    }
+}
+
 void
 DispatchObserverI::userException()
 {
@@ -770,6 +1015,7 @@ InvocationObserverI::getCollocatedObserver(const Ice::ObjectAdapterPtr& adapter,
 CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData)
     : _metrics(new MetricsAdminI(initData.properties, initData.logger)),
       _delegate(initData.observer),
+      _concurrencyLimiters(make_shared<ConcurrencyLimiters>()),
       _connections(_metrics, "Connection"),
       _dispatch(_metrics, "Dispatch"),
       _invocations(_metrics, "Invocation"),
@@ -779,6 +1025,8 @@ CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData)
 {
     _invocations.registerSubMap<RemoteMetrics>("Remote", &InvocationMetrics::remotes);
     _invocations.registerSubMap<CollocatedMetrics>("Collocated", &InvocationMetrics::collocated);
+    _metrics->registerMap("BufferPool", make_shared<BufferPoolMetricsMapFactory>());
+    _metrics->registerMap("ConcurrencyLimit", make_shared<ConcurrencyLimitMetricsMapFactory>(_concurrencyLimiters));
 }
 
 void
@@ -947,6 +1195,12 @@ CommunicatorObserverI::getFacet() const
     return _metrics;
 }
 
+void
+CommunicatorObserverI::addConcurrencyLimiter(const ConcurrencyLimitMiddlewarePtr& limiter)
+{
+    _concurrencyLimiters->add(limiter);
+}
+
 void
 CommunicatorObserverI::destroy()
 {
@@ -8,10 +8,14 @@
 #include "Ice/Connection.h"
 #include "Ice/MetricsObserverI.h"
 
+#include <memory>
 #include <sstream>
 
 namespace IceInternal
 {
+    class ConcurrencyLimitMiddleware;
+    class ConcurrencyLimiters;
+
     template<typename T, typename O> class ObserverWithDelegateT : public IceMX::ObserverT<T>, public virtual O
     {
     public:
@@ -142,12 +146,14 @@ namespace IceInternal
     public:
         virtual void sentBytes(std::int32_t);
         virtual void receivedBytes(std::int32_t);
+        virtual void coalescedMessages(std::int32_t);
     };
 
     class ThreadObserverI : public ObserverWithDelegateT<IceMX::ThreadMetrics, Ice::Instrumentation::ThreadObserver>
     {
     public:
         virtual void stateChanged(Ice::Instrumentation::ThreadState, Ice::Instrumentation::ThreadState);
+        virtual void queueDepth(std::int32_t);
     };
 
     class DispatchObserverI
@@ -220,11 +226,16 @@ namespace IceInternal
 
         const IceInternal::MetricsAdminIPtr& getFacet() const;
 
+        // Adds an object adapter concurrency limiter to the ConcurrencyLimit metrics map. The map only keeps a weak
+        // reference to the limiter.
+        void addConcurrencyLimiter(const std::shared_ptr<ConcurrencyLimitMiddleware>&);
+
         void destroy();
 
     private:
         IceInternal::MetricsAdminIPtr _metrics;
         const Ice::Instrumentation::CommunicatorObserverPtr _delegate;
+        const std::shared_ptr<ConcurrencyLimiters> _concurrencyLimiters;
 
         ObserverFactoryWithDelegateT<ConnectionObserverI> _connections;
         ObserverFactoryWithDelegateT<DispatchObserverI> _dispatch;
@@ -0,0 +1,259 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "IoUring.h"
+
+#if defined(ICE_USE_IO_URING)
+
+#    include "Ice/LocalExceptions.h"
+
+#    include <algorithm>
+#    include <cerrno>
+#    include <cstring>
+#    include <endian.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <time.h>
+
+using namespace std;
+using namespace IceInternal;
+
+IceInternal::IoUring::IoUring(unsigned int entries)
+    : _fd(-1),
+      _features(0),
+      _sqRing(nullptr),
+      _sqRingSize(0),
+      _cqRing(nullptr),
+      _cqRingSize(0),
+      _sqes(nullptr),
+      _sqesSize(0),
+      _sqHead(nullptr),
+      _sqTail(nullptr),
+      _sqMask(0),
+      _sqEntries(0),
+      _sqArray(nullptr),
+      _sqeTail(0),
+      _pending(0),
+      _cqHead(nullptr),
+      _cqTail(nullptr),
+      _cqMask(0),
+      _cqes(nullptr)
+{
+    io_uring_params params;
+    memset(&params, 0, sizeof(io_uring_params));
+    _fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (_fd < 0)
+    {
+        throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+    _features = params.features;
+
+    //
+    // We require completions to never be dropped when the completion ring is full, since the selector doesn't bound
+    // the number of armed poll requests, and support for waiting with a timeout.
+    //
+    const unsigned int required = IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    if ((_features & required) != required)
+    {
+        ::close(_fd);
+        throw Ice::FeatureNotSupportedException(__FILE__, __LINE__, "io_uring kernel support is too old");
+    }
+
+    _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (_features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _sqRingSize = _cqRingSize = max(_sqRingSize, _cqRingSize);
+    }
+
+    void* sqRing =
+        mmap(nullptr, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQ_RING);
+    if (sqRing == MAP_FAILED)
+    {
+        int error = errno;
+        ::close(_fd);
+        throw Ice::SocketException(__FILE__, __LINE__, error);
+    }
+    _sqRing = sqRing;
+
+    if (_features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _cqRing = _sqRing;
+    }
+    else
+    {
+        void* cqRing =
+            mmap(nullptr, _cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED)
+        {
+            int error = errno;
+            munmap(_sqRing, _sqRingSize);
+            ::close(_fd);
+            throw Ice::SocketException(__FILE__, __LINE__, error);
+        }
+        _cqRing = cqRing;
+    }
+
+    _sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mmap(nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        int error = errno;
+        if (_cqRing != _sqRing)
+        {
+            munmap(_cqRing, _cqRingSize);
+        }
+        munmap(_sqRing, _sqRingSize);
+        ::close(_fd);
+        throw Ice::SocketException(__FILE__, __LINE__, error);
+    }
+    _sqes = static_cast<io_uring_sqe*>(sqes);
+
+    char* sq = static_cast<char*>(_sqRing);
+    _sqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+    _sqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+    _sqMask = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+    _sqEntries = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_entries);
+    _sqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+    _sqeTail = *_sqTail;
+
+    char* cq = static_cast<char*>(_cqRing);
+    _cqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+    _cqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+    _cqMask = *reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+}
+
+IceInternal::IoUring::~IoUring()
+{
+    munmap(_sqes, _sqesSize);
+    if (_cqRing != _sqRing)
+    {
+        munmap(_cqRing, _cqRingSize);
+    }
+    munmap(_sqRing, _sqRingSize);
+    ::close(_fd);
+}
+
+void
+IceInternal::IoUring::pollAdd(int fd, uint32_t events, uint64_t userData)
+{
+    io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#    if __BYTE_ORDER == __BIG_ENDIAN
+    events = (events << 16) | (events >> 16);
+#    endif
+    sqe->poll32_events = events;
+    sqe->user_data = userData;
+    __atomic_store_n(_sqTail, ++_sqeTail, __ATOMIC_RELEASE);
+    ++_pending;
+}
+
+void
+IceInternal::IoUring::pollRemove(uint64_t userData, uint64_t removalUserData)
+{
+    io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = userData;
+    sqe->user_data = removalUserData;
+    __atomic_store_n(_sqTail, ++_sqeTail, __ATOMIC_RELEASE);
+    ++_pending;
+}
+
+int
+IceInternal::IoUring::submitAndWait(int timeout)
+{
+    //
+    // Don't wait if completions are already available, we still enter the kernel to submit the queued requests.
+    //
+    unsigned int minComplete = timeout == 0 || available() > 0 ? 0 : 1;
+    if (enter(_pending, minComplete, timeout) < 0)
+    {
+        if (errno == ETIME || errno == EBUSY)
+        {
+            // Timeout or the kernel has overflowed completions to flush, return the completions available.
+            return static_cast<int>(available());
+        }
+        return -1;
+    }
+    return static_cast<int>(available());
+}
+
+bool
+IceInternal::IoUring::nextCompletion(uint64_t& userData, int32_t& result)
+{
+    unsigned int head = __atomic_load_n(_cqHead, __ATOMIC_RELAXED);
+    if (head == __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+
+    const io_uring_cqe& cqe = _cqes[head & _cqMask];
+    userData = cqe.user_data;
+    result = cqe.res;
+    __atomic_store_n(_cqHead, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+io_uring_sqe*
+IceInternal::IoUring::getSqe()
+{
+    if (_sqeTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries)
+    {
+        // The submission ring is full, submit the queued requests without waiting for completions.
+        if (enter(_pending, 0, 0) < 0 || _sqeTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries)
+        {
+            throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+        }
+    }
+
+    unsigned int index = _sqeTail & _sqMask;
+    io_uring_sqe* sqe = &_sqes[index];
+    memset(sqe, 0, sizeof(io_uring_sqe));
+    _sqArray[index] = index;
+    return sqe;
+}
+
+int
+IceInternal::IoUring::enter(unsigned int toSubmit, unsigned int minComplete, int timeout)
+{
+    if (toSubmit == 0 && minComplete == 0)
+    {
+        return 0;
+    }
+
+    io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(io_uring_getevents_arg));
+    struct timespec ts;
+    if (timeout > 0)
+    {
+        ts.tv_sec = timeout / 1000;
+        ts.tv_nsec = (timeout % 1000) * 1000000L;
+        arg.ts = reinterpret_cast<uint64_t>(&ts);
+    }
+
+    unsigned int flags = IORING_ENTER_EXT_ARG;
+    if (minComplete > 0)
+    {
+        flags |= IORING_ENTER_GETEVENTS;
+    }
+
+    long ret = syscall(__NR_io_uring_enter, _fd, toSubmit, minComplete, flags, &arg, sizeof(arg));
+    if (ret < 0)
+    {
+        return -1;
+    }
+    _pending -= min(static_cast<unsigned int>(ret), _pending);
+    return static_cast<int>(ret);
+}
+
+unsigned int
+IceInternal::IoUring::available() const
+{
+    return __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE) - __atomic_load_n(_cqHead, __ATOMIC_RELAXED);
+}
+
+#endif
@@ -0,0 +1,78 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_IO_URING_H
+#define ICE_IO_URING_H
+
+#include "Network.h"
+
+#if defined(ICE_USE_IO_URING)
+
+#    include <linux/io_uring.h>
+
+#    include <cstdint>
+
+namespace IceInternal
+{
+    // A minimal wrapper for a Linux io_uring submission/completion ring pair, used by the selector to arm poll
+    // requests and wait for their completions with a single io_uring_enter system call.
+    class IoUring final
+    {
+    public:
+        // Creates a ring with the given number of submission entries. Throws Ice::SocketException if the ring can't
+        // be created and Ice::FeatureNotSupportedException if the kernel doesn't support the required features.
+        IoUring(unsigned int);
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        // Queues a one-shot poll request for the given file descriptor and poll mask.
+        void pollAdd(int, std::uint32_t, std::uint64_t);
+
+        // Queues the removal of the poll request with the given user data. The completion of the removal request is
+        // posted with the given removal user data.
+        void pollRemove(std::uint64_t, std::uint64_t);
+
+        // Submits the queued requests and waits for at least one completion for up to the given timeout in
+        // milliseconds (0 doesn't wait, -1 waits forever). Returns the number of available completions, or -1 on
+        // failure with errno set (EINTR if interrupted).
+        int submitAndWait(int);
+
+        // Retrieves the next available completion, returns false if there's none.
+        bool nextCompletion(std::uint64_t&, std::int32_t&);
+
+    private:
+        io_uring_sqe* getSqe();
+        int enter(unsigned int, unsigned int, int);
+        unsigned int available() const;
+
+        int _fd;
+        unsigned int _features;
+
+        void* _sqRing;
+        std::size_t _sqRingSize;
+        void* _cqRing;
+        std::size_t _cqRingSize;
+        io_uring_sqe* _sqes;
+        std::size_t _sqesSize;
+
+        unsigned int* _sqHead;
+        unsigned int* _sqTail;
+        unsigned int _sqMask;
+        unsigned int _sqEntries;
+        unsigned int* _sqArray;
+        unsigned int _sqeTail;
+        unsigned int _pending;
+
+        unsigned int* _cqHead;
+        unsigned int* _cqTail;
+        unsigned int _cqMask;
+        io_uring_cqe* _cqes;
+    };
+}
+
+#endif
+
+#endif
@@ -196,6 +196,12 @@ Ice::InvocationTimeoutException::ice_id() const noexcept
     return "::Ice::InvocationTimeoutException";
 }
 
+const char*
+Ice::DeadlineExpiredException::ice_id() const noexcept
+{
+    return "::Ice::DeadlineExpiredException";
+}
+
 //
 // Syscall exceptions
 //
@@ -350,6 +356,12 @@ Ice::CommunicatorDestroyedException::ice_id() const noexcept
     return "::Ice::CommunicatorDestroyedException";
 }
 
+const char*
+Ice::ConcurrencyLimitException::ice_id() const noexcept
+{
+    return "::Ice::ConcurrencyLimitException";
+}
+
 const char*
 Ice::ConnectionAbortedException::ice_id() const noexcept
 {
@@ -25,6 +25,12 @@ ifeq ($(os),Linux)
 ifeq ($(shell pkg-config --exists libsystemd 2> /dev/null && echo yes),yes)
 Ice_cppflags                            += -DICE_USE_SYSTEMD $(shell pkg-config --cflags libsystemd)
 endif
+ifeq ($(shell pkg-config --exists libzstd 2> /dev/null && echo yes),yes)
+Ice_cppflags                            += -DICE_HAS_ZSTD $(shell pkg-config --cflags libzstd)
+endif
+ifeq ($(shell pkg-config --exists liblz4 2> /dev/null && echo yes),yes)
+Ice_cppflags                            += -DICE_HAS_LZ4 $(shell pkg-config --cflags liblz4)
+endif
 endif
 
 Ice[iphoneos]_excludes                  := $(wildcard src/Ice/CtrlCHandler.cpp $(addprefix $(currentdir)/,Tcp*.cpp Service.cpp))
@@ -13,6 +13,7 @@
 
 #include "Ice/StringUtil.h"
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 
@@ -29,9 +30,44 @@ namespace
         "Accept.*",
         "Reject.*",
         "RetainDetached",
+        "Histogram.Min",
+        "Histogram.Max",
         "Map.*",
     };
 
+    // The number of stripes of counters of a histogram. Threads are assigned a stripe in a round-robin fashion.
+    const size_t histogramStripes = 4;
+
+    // Counters of different stripes are at least 64 bytes (a cache line) apart.
+    const size_t histogramStrideAlignment = 64 / sizeof(int64_t);
+
+    size_t currentHistogramStripe()
+    {
+        static atomic<size_t> nextStripe{0};
+        static thread_local const size_t stripe = nextStripe++ % histogramStripes;
+        return stripe;
+    }
+
+    shared_ptr<const vector<int64_t>> parseHistogramBounds(const PropertiesPtr& properties, const string& prefix)
+    {
+        int64_t min = properties->getIcePropertyAsInt(prefix + "Histogram.Min");
+        int64_t max = properties->getIcePropertyAsInt(prefix + "Histogram.Max");
+        if (max <= 0)
+        {
+            return nullptr; // Histograms are disabled.
+        }
+
+        // The upper bounds of the buckets are powers of two times the minimum, up to the first bound which is greater
+        // than or equal to the maximum.
+        auto bounds = make_shared<vector<int64_t>>();
+        bounds->push_back(std::max(min, int64_t{1}));
+        while (bounds->back() < max)
+        {
+            bounds->push_back(bounds->back() * 2);
+        }
+        return bounds;
+    }
+
     void validateProperties(const string& prefix, const PropertiesPtr& properties)
     {
         vector<string> unknownProps;
@@ -85,6 +121,43 @@ namespace
     }
 }
 
+MetricsHistogramI::MetricsHistogramI(shared_ptr<const vector<int64_t>> bounds)
+    : _bounds(std::move(bounds)),
+      _stride(
+          (_bounds->size() + 1 + histogramStrideAlignment - 1) / histogramStrideAlignment * histogramStrideAlignment),
+      _counts(new atomic<int64_t>[histogramStripes * _stride])
+{
+    for (size_t i = 0; i < histogramStripes * _stride; ++i)
+    {
+        _counts[i].store(0, memory_order_relaxed);
+    }
+}
+
+void
+MetricsHistogramI::record(int64_t value) noexcept
+{
+    // The bucket of a value is the first bucket with an upper bound greater than or equal to the value, or the last
+    // bucket if the value is greater than all the bounds.
+    auto bucket = static_cast<size_t>(lower_bound(_bounds->begin(), _bounds->end(), value) - _bounds->begin());
+    _counts[currentHistogramStripe() * _stride + bucket].fetch_add(1, memory_order_relaxed);
+}
+
+MetricsHistogram
+MetricsHistogramI::get() const
+{
+    MetricsHistogram histogram;
+    histogram.bounds = *_bounds;
+    histogram.counts.resize(_bounds->size() + 1);
+    for (size_t stripe = 0; stripe < histogramStripes; ++stripe)
+    {
+        for (size_t bucket = 0; bucket < histogram.counts.size(); ++bucket)
+        {
+            histogram.counts[bucket] += _counts[stripe * _stride + bucket].load(memory_order_relaxed);
+        }
+    }
+    return histogram;
+}
+
 MetricsMapI::RegExp::RegExp(const string& attribute, const string& regexp) : _attribute(attribute)
 {
     _regex = regex(regexp, std::regex_constants::extended | std::regex_constants::nosubs);
@@ -105,7 +178,8 @@ MetricsMapI::MetricsMapI(const std::string& mapPrefix, const PropertiesPtr& prop
     : _properties(properties->getPropertiesForPrefix(mapPrefix)),
       _retain(properties->getIcePropertyAsInt(mapPrefix + "RetainDetached")),
       _accept(parseRule(properties, mapPrefix + "Accept")),
-      _reject(parseRule(properties, mapPrefix + "Reject"))
+      _reject(parseRule(properties, mapPrefix + "Reject")),
+      _histogramBounds(parseHistogramBounds(properties, mapPrefix))
 {
     validateProperties(mapPrefix, properties);
 
@@ -160,7 +234,8 @@ MetricsMapI::MetricsMapI(const MetricsMapI& map)
       _groupBySeparators(map._groupBySeparators),
       _retain(map._retain),
       _accept(map._accept),
-      _reject(map._reject)
+      _reject(map._reject),
+      _histogramBounds(map._histogramBounds)
 {
 }
 
@@ -180,8 +255,10 @@ MetricsMapFactory::MetricsMapFactory(Updater* updater) : _updater(updater) {}
 void
 MetricsMapFactory::update()
 {
-    assert(_updater);
-    _updater->update();
+    if (_updater)
+    {
+        _updater->update();
+    }
 }
 
 MetricsViewI::MetricsViewI(const string& name) : _name(name) {}
@@ -439,6 +516,21 @@ MetricsAdminI::updateViews()
     }
 }
 
+void
+MetricsAdminI::registerMap(const std::string& map, const MetricsMapFactoryPtr& factory)
+{
+    bool updated;
+    {
+        lock_guard lock(_mutex);
+        _factories[map] = factory;
+        updated = addOrUpdateMap(map, factory);
+    }
+    if (updated)
+    {
+        factory->update();
+    }
+}
+
 void
 MetricsAdminI::unregisterMap(const std::string& mapName)
 {
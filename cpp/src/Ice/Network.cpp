@@ -56,7 +56,7 @@ namespace
     void
     sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
     {
-        if (selType == Ice::EndpointSelectionType::Random)
+        if (selType != Ice::EndpointSelectionType::Ordered)
         {
             IceInternal::shuffle(addrs.begin(), addrs.end());
         }
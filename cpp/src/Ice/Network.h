@@ -49,6 +49,10 @@ typedef int ssize_t;
 #    define ICE_USE_POLL 1
 #endif
 
+#if defined(ICE_USE_EPOLL) && !defined(ICE_NO_IO_URING) && __has_include(<linux/io_uring.h>)
+#    define ICE_USE_IO_URING 1
+#endif
+
 #if defined(_WIN32) || defined(__osf__)
 typedef int socklen_t;
 #endif
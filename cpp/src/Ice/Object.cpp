@@ -102,47 +102,57 @@ Ice::Object::_iceD_ice_id(IncomingRequest& request, function<void(OutgoingRespon
 void
 Ice::Object::dispatch(IncomingRequest& request, std::function<void(OutgoingResponse)> sendResponse)
 {
-    static constexpr string_view allOperations[] = {"ice_id", "ice_ids", "ice_isA", "ice_ping"};
-
     const Current& current = request.current();
 
-    pair<const string_view*, const string_view*> r = equal_range(allOperations, allOperations + 4, current.operation);
-
-    if (r.first == r.second)
-    {
-        sendResponse(makeOutgoingResponse(make_exception_ptr(OperationNotExistException(__FILE__, __LINE__)), current));
-        return;
-    }
-
-    switch (r.first - allOperations)
+    // Same as the dispatch generated by slice2cpp: switch over the length of the operation name, then over the
+    // character that tells apart operations with the same length.
+    switch (current.operation.size())
     {
-        case 0:
+        case 6:
         {
-            _iceD_ice_id(request, std::move(sendResponse));
-            break;
-        }
-        case 1:
-        {
-            _iceD_ice_ids(request, std::move(sendResponse));
+            if (current.operation == "ice_id")
+            {
+                _iceD_ice_id(request, std::move(sendResponse));
+                return;
+            }
             break;
         }
-        case 2:
+        case 7:
         {
-            _iceD_ice_isA(request, std::move(sendResponse));
+            switch (current.operation[5])
+            {
+                case 'd':
+                {
+                    if (current.operation == "ice_ids")
+                    {
+                        _iceD_ice_ids(request, std::move(sendResponse));
+                        return;
+                    }
+                    break;
+                }
+                case 's':
+                {
+                    if (current.operation == "ice_isA")
+                    {
+                        _iceD_ice_isA(request, std::move(sendResponse));
+                        return;
+                    }
+                    break;
+                }
+            }
             break;
         }
-        case 3:
+        case 8:
         {
-            _iceD_ice_ping(request, std::move(sendResponse));
+            if (current.operation == "ice_ping")
+            {
+                _iceD_ice_ping(request, std::move(sendResponse));
+                return;
+            }
             break;
         }
-        default:
-        {
-            assert(false);
-            sendResponse(
-                makeOutgoingResponse(make_exception_ptr(OperationNotExistException(__FILE__, __LINE__)), current));
-        }
     }
+    sendResponse(makeOutgoingResponse(make_exception_ptr(OperationNotExistException(__FILE__, __LINE__)), current));
 }
 
 namespace
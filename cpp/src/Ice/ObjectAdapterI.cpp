@@ -4,6 +4,7 @@
 
 #include "ObjectAdapterI.h"
 #include "CheckIdentity.h"
+#include "ConcurrencyLimitMiddleware.h"
 #include "ConnectionFactory.h"
 #include "ConsoleUtil.h"
 #include "DefaultsAndOverrides.h"
@@ -19,6 +20,7 @@
 #include "Ice/Router.h"
 #include "Ice/UUID.h"
 #include "Instance.h"
+#include "InstrumentationI.h"
 #include "LocatorInfo.h"
 #include "LoggerMiddleware.h"
 #include "ObjectAdapterFactory.h"
@@ -26,9 +28,11 @@
 #include "PropertyNames.h"
 #include "ReferenceFactory.h"
 #include "RouterInfo.h"
+#include "SchedulerMiddleware.h"
 #include "ServantManager.h"
 #include "ThreadPool.h"
 #include "TraceLevels.h"
+#include "WorkStealingExecutor.h"
 
 #ifdef _WIN32
 #    include <sys/timeb.h>
@@ -46,6 +50,26 @@ using namespace IceInternal;
 namespace
 {
     inline EndpointIPtr toEndpointI(const EndpointPtr& endp) { return dynamic_pointer_cast<EndpointI>(endp); }
+
+    // Returns the value of an object adapter property as an integer. When the property is not set, returns the default
+    // value of the objectadapter property class of PropertyNames.xml, looked up through the Ice.Admin object adapter
+    // properties, which belong to this class.
+    int32_t getAdapterPropertyAsInt(const PropertiesPtr& properties, const string& adapterName, const string& suffix)
+    {
+        const string key = "Ice.Admin." + suffix;
+        const PropertyArray& iceProps = PropertyNames::IceProps;
+        int32_t defaultValue = 0;
+        for (int i = 0; i < iceProps.length; ++i)
+        {
+            if (key == iceProps.properties[i].pattern)
+            {
+                string_view value = iceProps.properties[i].defaultValue;
+                defaultValue = value.empty() ? 0 : stoi(string{value});
+                break;
+            }
+        }
+        return properties->getPropertyAsIntWithDefault(adapterName + "." + suffix, defaultValue);
+    }
 }
 
 string
@@ -314,6 +338,14 @@ Ice::ObjectAdapterI::destroy() noexcept
         _threadPool->joinWithAllThreads();
     }
 
+    //
+    // Destroy the dispatch executor, once the thread pool no longer hands off requests to it.
+    //
+    if (_dispatchExecutor)
+    {
+        _dispatchExecutor->destroy();
+    }
+
     if (_objectAdapterFactory)
     {
         _objectAdapterFactory->removeObjectAdapter(shared_from_this());
@@ -333,6 +365,7 @@ Ice::ObjectAdapterI::destroy() noexcept
         //
         _instance = 0;
         _threadPool = 0;
+        _dispatchExecutor = 0;
         _routerInfo = 0;
         _publishedEndpoints.clear();
         _locatorInfo = 0;
@@ -887,6 +920,73 @@ Ice::ObjectAdapterI::initialize(optional<RouterPrx> router)
 {
     // shared_from_this() is available now and is called by `use`.
 
+    // The concurrency limiter is the first middleware, to reject the requests over the limit before any other
+    // processing. It's followed by the scheduler, which sheds expired requests.
+    {
+        const PropertiesPtr& properties = _instance->initializationData().properties;
+        string limitAlgorithm = properties->getProperty(_name + ".Dispatch.ConcurrencyLimit");
+        if (!limitAlgorithm.empty())
+        {
+            ConcurrencyLimitMiddleware::Algorithm algorithm;
+            if (limitAlgorithm == "AIMD")
+            {
+                algorithm = ConcurrencyLimitMiddleware::Algorithm::AIMD;
+            }
+            else if (limitAlgorithm == "Gradient")
+            {
+                algorithm = ConcurrencyLimitMiddleware::Algorithm::Gradient;
+            }
+            else
+            {
+                throw InitializationException(
+                    __FILE__,
+                    __LINE__,
+                    "invalid concurrency limit algorithm '" + limitAlgorithm + "' for object adapter '" + _name + "'");
+            }
+
+            int minLimit = max(getAdapterPropertyAsInt(properties, _name, "Dispatch.ConcurrencyLimit.Min"), 1);
+            int maxLimit = max(getAdapterPropertyAsInt(properties, _name, "Dispatch.ConcurrencyLimit.Max"), minLimit);
+            int initialLimit = getAdapterPropertyAsInt(properties, _name, "Dispatch.ConcurrencyLimit.Initial");
+            chrono::milliseconds latencyThreshold{
+                max(getAdapterPropertyAsInt(properties, _name, "Dispatch.ConcurrencyLimit.Latency"), 1)};
+
+            // The limiter reports its limit through the ConcurrencyLimit map of the Metrics admin facet, if enabled.
+            auto communicatorObserver =
+                dynamic_pointer_cast<CommunicatorObserverI>(_instance->initializationData().observer);
+
+            use(
+                [name = _name,
+                 algorithm,
+                 initialLimit,
+                 minLimit,
+                 maxLimit,
+                 latencyThreshold,
+                 communicatorObserver](ObjectPtr next)
+                {
+                    auto limiter = make_shared<ConcurrencyLimitMiddleware>(
+                        std::move(next),
+                        name,
+                        algorithm,
+                        initialLimit,
+                        minLimit,
+                        maxLimit,
+                        latencyThreshold);
+                    if (communicatorObserver)
+                    {
+                        communicatorObserver->addConcurrencyLimiter(limiter);
+                    }
+                    return limiter;
+                });
+        }
+
+        int maxDispatches = max(properties->getPropertyAsInt(_name + ".Dispatch.MaxDispatches"), 0);
+        if (maxDispatches > 0 || properties->getPropertyAsInt(_name + ".Dispatch.Deadline") > 0)
+        {
+            use([maxDispatches, timer = _instance->timer()](ObjectPtr next)
+                { return make_shared<SchedulerMiddleware>(std::move(next), maxDispatches, timer); });
+        }
+    }
+
     const LoggerPtr logger = _instance->initializationData().logger;
     if (logger)
     {
@@ -978,9 +1078,38 @@ Ice::ObjectAdapterI::initialize(optional<RouterPrx> router)
         // Create the per-adapter thread pool, if necessary. This is done before the creation of the incoming
         // connection factory as the thread pool is needed during creation for the call to incFdsInUse.
         //
-        if (threadPoolSize > 0 || threadPoolSizeMax > 0 || hasPriority)
+        //
+        // Create the dispatch executor, if configured. Its thread pool only reads requests and hands them off to the
+        // executor, so the dispatch executor requires a per-adapter thread pool.
+        //
+        string executorType = properties->getProperty(_name + ".Dispatch.Executor");
+        if (executorType == "WorkStealing")
+        {
+            _dispatchExecutor = make_shared<WorkStealingExecutor>(
+                _instance,
+                _name + ".Dispatch",
+                properties->getPropertyAsInt(_name + ".Dispatch.Size"),
+                properties->getPropertyAsInt(_name + ".ThreadPool.Serialize") > 0);
+        }
+        else if (!executorType.empty())
         {
-            _threadPool = ThreadPool::create(_instance, _name + ".ThreadPool", 0);
+            throw InitializationException(
+                __FILE__,
+                __LINE__,
+                "invalid dispatch executor '" + executorType + "' for object adapter '" + _name + "'");
+        }
+
+        if (threadPoolSize > 0 || threadPoolSizeMax > 0 || hasPriority || _dispatchExecutor)
+        {
+            function<void(function<void()>, const ConnectionPtr&)> executor;
+            if (_dispatchExecutor)
+            {
+                executor = [dispatchExecutor = _dispatchExecutor](
+                               function<void()> call,
+                               const ConnectionPtr& connection)
+                { dispatchExecutor->execute(std::move(call), connection); };
+            }
+            _threadPool = ThreadPool::create(_instance, _name + ".ThreadPool", 0, std::move(executor));
         }
 
         if (!router)
@@ -1396,14 +1525,27 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "AdapterId",
         "Connection.CloseTimeout",
         "Connection.ConnectTimeout",
+        "Connection.CorkDelay",
+        "Connection.CorkSize",
         "Connection.EnableIdleCheck",
         "Connection.IdleTimeout",
         "Connection.InactivityTimeout",
+        "Connection.ReadBufferSize",
+        "Dispatch.ConcurrencyLimit",
+        "Dispatch.ConcurrencyLimit.Initial",
+        "Dispatch.ConcurrencyLimit.Latency",
+        "Dispatch.ConcurrencyLimit.Max",
+        "Dispatch.ConcurrencyLimit.Min",
+        "Dispatch.Deadline",
+        "Dispatch.Executor",
+        "Dispatch.MaxDispatches",
+        "Dispatch.Size",
         "Endpoints",
         "Locator",
         "Locator.EncodingVersion",
         "Locator.EndpointSelection",
         "Locator.ConnectionCached",
+        "Locator.ConnectionPoolSize",
         "Locator.PreferSecure",
         "Locator.CollocationOptimized",
         "Locator.Router",
@@ -1414,11 +1556,13 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Router.EncodingVersion",
         "Router.EndpointSelection",
         "Router.ConnectionCached",
+        "Router.ConnectionPoolSize",
         "Router.PreferSecure",
         "Router.CollocationOptimized",
         "Router.Locator",
         "Router.Locator.EndpointSelection",
         "Router.Locator.ConnectionCached",
+        "Router.Locator.ConnectionPoolSize",
         "Router.Locator.PreferSecure",
         "Router.Locator.CollocationOptimized",
         "Router.Locator.LocatorCacheTimeout",
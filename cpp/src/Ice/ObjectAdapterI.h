@@ -20,6 +20,7 @@
 #include "RouterInfoF.h"
 #include "ServantManagerF.h"
 #include "ThreadPoolF.h"
+#include "WorkStealingExecutorF.h"
 
 #include <list>
 #include <mutex>
@@ -140,6 +141,7 @@ namespace Ice
         CommunicatorPtr _communicator;
         IceInternal::ObjectAdapterFactoryPtr _objectAdapterFactory;
         IceInternal::ThreadPoolPtr _threadPool;
+        IceInternal::WorkStealingExecutorPtr _dispatchExecutor; // Set with <adapter>.Dispatch.Executor=WorkStealing
         const IceInternal::ServantManagerPtr _servantManager;
 
         mutable ObjectPtr _dispatchPipeline;
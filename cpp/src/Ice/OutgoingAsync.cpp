@@ -6,6 +6,7 @@
 #include "CollocatedRequestHandler.h"
 #include "ConnectionFactory.h"
 #include "ConnectionI.h"
+#include "HedgingPolicy.h"
 #include "Ice/ImplicitContext.h"
 #include "Ice/LocalExceptions.h"
 #include "Ice/LoggerUtil.h"
@@ -327,6 +328,15 @@ ProxyOutgoingAsyncBase::exception(std::exception_ptr exc)
         _childObserver.detach();
     }
 
+    if (_hedgeTask)
+    {
+        Lock sync(_m);
+        if (_completion == Completion::CompletedByHedge)
+        {
+            return false; // The hedged invocation completed this invocation, don't retry.
+        }
+    }
+
     _cachedConnection = nullptr;
 
     //
@@ -414,6 +424,7 @@ ProxyOutgoingAsyncBase::ProxyOutgoingAsyncBase(ObjectPrx proxy)
     : OutgoingAsyncBase(proxy->_getReference()->getInstance()),
       _proxy(std::move(proxy)),
       _mode(OperationMode::Normal),
+      _completion(Completion::Pending),
       _cnt(0),
       _sent(false)
 {
@@ -526,6 +537,11 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
 bool
 ProxyOutgoingAsyncBase::exceptionImpl(std::exception_ptr ex)
 {
+    if (!claimCompletion(false))
+    {
+        return false;
+    }
+
     if (_proxy._getReference()->getInvocationTimeout() != -1)
     {
         _instance->timer()->cancel(shared_from_this());
@@ -549,6 +565,43 @@ ProxyOutgoingAsyncBase::runTimerTask()
     cancel(make_exception_ptr(InvocationTimeoutException(__FILE__, __LINE__)));
 }
 
+bool
+ProxyOutgoingAsyncBase::claimCompletion(bool byHedge)
+{
+    if (!_hedgeTask)
+    {
+        return true; // Not a hedged invocation.
+    }
+
+    ProxyOutgoingAsyncBasePtr hedge;
+    {
+        Lock sync(_m);
+        if (_completion != Completion::Pending)
+        {
+            return !byHedge && _completion == Completion::Completed;
+        }
+        _completion = byHedge ? Completion::CompletedByHedge : Completion::Completed;
+        hedge = std::move(_hedge);
+    }
+
+    _instance->timer()->cancel(_hedgeTask);
+
+    if (hedge && !byHedge)
+    {
+        // This can be called with the connection locked so the hedged invocation is canceled from the client thread
+        // pool.
+        try
+        {
+            _instance->clientThreadPool()->execute([hedge]() { hedge->cancel(); }, nullptr);
+        }
+        catch (const CommunicatorDestroyedException&)
+        {
+            // The hedged invocation is canceled when its connection is closed.
+        }
+    }
+    return true;
+}
+
 int
 ProxyOutgoingAsyncBase::handleRetryAfterException(std::exception_ptr ex)
 {
@@ -780,6 +833,74 @@ ProxyOutgoingAsyncBase::checkRetryAfterException(std::exception_ptr ex)
     return interval;
 }
 
+namespace
+{
+    // Sends the hedged invocation of an invocation that didn't receive its reply within the hedging delay.
+    class HedgeTask final : public TimerTask
+    {
+    public:
+        HedgeTask(weak_ptr<OutgoingAsync> outAsync) : _outAsync(std::move(outAsync)) {}
+
+        void runTimerTask() final
+        {
+            if (auto outAsync = _outAsync.lock())
+            {
+                outAsync->hedge();
+            }
+        }
+
+    private:
+        const weak_ptr<OutgoingAsync> _outAsync;
+    };
+
+    // The duplicate of a request sent by OutgoingAsync::hedge. Its reply completes the original invocation, its
+    // failures are ignored.
+    class HedgedOutgoingAsync final : public OutgoingAsync
+    {
+    public:
+        HedgedOutgoingAsync(
+            ObjectPrx proxy,
+            weak_ptr<OutgoingAsync> parent,
+            OperationMode mode,
+            const vector<byte>& requestBody)
+            : OutgoingAsync(std::move(proxy), false), _parent(std::move(parent))
+        {
+            _mode = mode;
+
+            // The connection fills in the request ID, compression status and size of the header.
+            _os.writeBlob(requestHdr, sizeof(requestHdr));
+            _os.writeBlob(requestBody);
+        }
+
+        bool response() final
+        {
+            if (_childObserver)
+            {
+                _childObserver->reply(static_cast<int32_t>(_is.b.size() - headerSize - 4));
+                _childObserver.detach();
+            }
+
+            if (auto parent = _parent.lock())
+            {
+                parent->hedgeResponse(static_pointer_cast<OutgoingAsync>(shared_from_this()));
+            }
+            return responseImpl(true, false);
+        }
+
+    protected:
+        bool handleSent(bool, bool) noexcept final { return false; }
+        bool handleException(exception_ptr) noexcept final { return false; }
+        bool handleResponse(bool) final { return false; }
+
+        void handleInvokeSent(bool, OutgoingAsyncBase*) const final { assert(false); }
+        void handleInvokeException(exception_ptr, OutgoingAsyncBase*) const final { assert(false); }
+        void handleInvokeResponse(bool, OutgoingAsyncBase*) const final { assert(false); }
+
+    private:
+        const weak_ptr<OutgoingAsync> _parent;
+    };
+}
+
 OutgoingAsync::OutgoingAsync(ObjectPrx proxy, bool synchronous)
     : ProxyOutgoingAsyncBase(std::move(proxy)),
       _encoding(_proxy->_getReference()->getEncoding()),
@@ -835,7 +956,33 @@ OutgoingAsync::prepare(string_view operation, OperationMode mode, const Context&
 
     _os.write(static_cast<uint8_t>(_mode));
 
-    if (&context != &noExplicitContext)
+    int invocationTimeout = ref->getInvocationTimeout();
+    if (invocationTimeout > 0 && _instance->propagateDeadline())
+    {
+        //
+        // Propagate the deadline of the invocation with the reserved _deadline context entry, unless the context
+        // already carries a deadline.
+        //
+        Context ctx;
+        if (&context != &noExplicitContext)
+        {
+            ctx = context;
+        }
+        else if (const ImplicitContextPtr& implicitContext = ref->getInstance()->getImplicitContext())
+        {
+            implicitContext->combine(ref->getContext()->getValue(), ctx);
+        }
+        else
+        {
+            ctx = ref->getContext()->getValue();
+        }
+        auto deadline = chrono::system_clock::now() + chrono::milliseconds(invocationTimeout);
+        ctx.emplace(
+            deadlineContextKey,
+            to_string(chrono::duration_cast<chrono::milliseconds>(deadline.time_since_epoch()).count()));
+        _os.write(ctx);
+    }
+    else if (&context != &noExplicitContext)
     {
         //
         // Explicit context
@@ -883,142 +1030,160 @@ OutgoingAsync::response()
         _childObserver.detach();
     }
 
-    uint8_t replyStatus;
+    if (!claimCompletion(false))
+    {
+        return false; // The hedged invocation already completed this invocation.
+    }
+
+    if (_hedgeKey)
+    {
+        _instance->hedgingPolicy()->record(
+            *_hedgeKey,
+            chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - _invokeTime));
+    }
+
     try
     {
-        _is.read(replyStatus);
+        return responseImpl(readReplyStatus() == replyOK, true);
+    }
+    catch (const Exception&)
+    {
+        return exception(current_exception());
+    }
+}
 
-        switch (replyStatus)
+uint8_t
+OutgoingAsync::readReplyStatus()
+{
+    uint8_t replyStatus;
+    _is.read(replyStatus);
+
+    switch (replyStatus)
+    {
+        case replyOK:
         {
-            case replyOK:
-            {
-                break;
-            }
-            case replyUserException:
+            break;
+        }
+        case replyUserException:
+        {
+            _observer.userException();
+            break;
+        }
+
+        case replyObjectNotExist:
+        case replyFacetNotExist:
+        case replyOperationNotExist:
+        {
+            Identity ident;
+            _is.read(ident);
+
+            //
+            // For compatibility with the old FacetPath.
+            //
+            vector<string> facetPath;
+            _is.read(facetPath);
+            string facet;
+            if (!facetPath.empty())
             {
-                _observer.userException();
-                break;
+                if (facetPath.size() > 1)
+                {
+                    throw MarshalException{__FILE__, __LINE__, "received facet path with more than one element"};
+                }
+                facet.swap(facetPath[0]);
             }
 
-            case replyObjectNotExist:
-            case replyFacetNotExist:
-            case replyOperationNotExist:
+            string operation;
+            _is.read(operation, false);
+            switch (replyStatus)
             {
-                Identity ident;
-                _is.read(ident);
-
-                //
-                // For compatibility with the old FacetPath.
-                //
-                vector<string> facetPath;
-                _is.read(facetPath);
-                string facet;
-                if (!facetPath.empty())
+                case replyObjectNotExist:
                 {
-                    if (facetPath.size() > 1)
-                    {
-                        throw MarshalException{__FILE__, __LINE__, "received facet path with more than one element"};
-                    }
-                    facet.swap(facetPath[0]);
+                    throw ObjectNotExistException{
+                        __FILE__,
+                        __LINE__,
+                        std::move(ident),
+                        std::move(facet),
+                        std::move(operation)};
+                    break;
                 }
 
-                string operation;
-                _is.read(operation, false);
-                switch (replyStatus)
+                case replyFacetNotExist:
                 {
-                    case replyObjectNotExist:
-                    {
-                        throw ObjectNotExistException{
-                            __FILE__,
-                            __LINE__,
-                            std::move(ident),
-                            std::move(facet),
-                            std::move(operation)};
-                        break;
-                    }
-
-                    case replyFacetNotExist:
-                    {
-                        throw FacetNotExistException{
-                            __FILE__,
-                            __LINE__,
-                            std::move(ident),
-                            std::move(facet),
-                            std::move(operation)};
-                        break;
-                    }
+                    throw FacetNotExistException{
+                        __FILE__,
+                        __LINE__,
+                        std::move(ident),
+                        std::move(facet),
+                        std::move(operation)};
+                    break;
+                }
 
-                    case replyOperationNotExist:
-                    {
-                        throw OperationNotExistException{
-                            __FILE__,
-                            __LINE__,
-                            std::move(ident),
-                            std::move(facet),
-                            std::move(operation)};
-                        break;
-                    }
+                case replyOperationNotExist:
+                {
+                    throw OperationNotExistException{
+                        __FILE__,
+                        __LINE__,
+                        std::move(ident),
+                        std::move(facet),
+                        std::move(operation)};
+                    break;
+                }
 
-                    default:
-                    {
-                        assert(false);
-                        break;
-                    }
+                default:
+                {
+                    assert(false);
+                    break;
                 }
-                break;
             }
+            break;
+        }
 
-            case replyUnknownException:
-            case replyUnknownLocalException:
-            case replyUnknownUserException:
-            {
-                string message;
-                _is.read(message, false);
+        case replyUnknownException:
+        case replyUnknownLocalException:
+        case replyUnknownUserException:
+        {
+            string message;
+            _is.read(message, false);
 
-                switch (replyStatus)
+            switch (replyStatus)
+            {
+                case replyUnknownException:
                 {
-                    case replyUnknownException:
-                    {
-                        throw UnknownException{__FILE__, __LINE__, std::move(message)};
-                        break;
-                    }
-
-                    case replyUnknownLocalException:
-                    {
-                        throw UnknownLocalException{__FILE__, __LINE__, std::move(message)};
-                        break;
-                    }
+                    throw UnknownException{__FILE__, __LINE__, std::move(message)};
+                    break;
+                }
 
-                    case replyUnknownUserException:
-                    {
-                        throw UnknownUserException{__FILE__, __LINE__, std::move(message)};
-                        break;
-                    }
+                case replyUnknownLocalException:
+                {
+                    throw UnknownLocalException{__FILE__, __LINE__, std::move(message)};
+                    break;
+                }
 
-                    default:
-                    {
-                        assert(false);
-                        break;
-                    }
+                case replyUnknownUserException:
+                {
+                    throw UnknownUserException{__FILE__, __LINE__, std::move(message)};
+                    break;
                 }
-                break;
-            }
 
-            default:
-            {
-                throw ProtocolException{
-                    __FILE__,
-                    __LINE__,
-                    "received unknown reply status in Reply message" + to_string(replyStatus)};
+                default:
+                {
+                    assert(false);
+                    break;
+                }
             }
+            break;
         }
 
-        return responseImpl(replyStatus == replyOK, true);
-    }
-    catch (const Exception&)
-    {
-        return exception(current_exception());
+        default:
+        {
+            throw ProtocolException{
+                __FILE__,
+                __LINE__,
+                "received unknown reply status in Reply message" + to_string(replyStatus)};
+        }
     }
+
+    return replyStatus;
 }
 
 AsyncStatus
@@ -1034,22 +1199,6 @@ OutgoingAsync::invokeCollocated(CollocatedRequestHandler* handler)
     return handler->invokeAsyncRequest(this, 0, _synchronous);
 }
 
-void
-OutgoingAsync::abort(std::exception_ptr ex)
-{
-    if (_proxy._getReference()->isBatch())
-    {
-        //
-        // If we didn't finish a batch oneway or datagram request, we
-        // must notify the connection about that we give up ownership
-        // of the batch stream.
-        //
-        _proxy._getReference()->getBatchRequestQueue()->abortBatchRequest(&_os);
-    }
-
-    ProxyOutgoingAsyncBase::abort(ex);
-}
-
 void
 OutgoingAsync::invoke(string_view operation)
 {
@@ -1061,6 +1210,26 @@ OutgoingAsync::invoke(string_view operation)
         return;
     }
 
+    // Idempotent operations can be hedged: if no reply is received within the hedging delay, the request is sent again
+    // over another connection and the first reply wins.
+    const HedgingPolicyPtr& hedgingPolicy = _instance->hedgingPolicy();
+    if (hedgingPolicy && _mode != OperationMode::Normal && _proxy._getReference()->isTwoway() && !_proxy->ice_isFixed())
+    {
+        _hedgeKey = HedgingPolicy::key(_proxy._getReference(), operation);
+        _invokeTime = chrono::steady_clock::now();
+
+        chrono::microseconds delay = hedgingPolicy->delay(*_hedgeKey);
+        if (delay > chrono::microseconds::zero())
+        {
+            // The connection sending this request can swap _os with its write stream, the hedged invocation is created
+            // from a copy of the request body taken before the request is sent.
+            _hedgeRequestBody.assign(_os.b.begin() + sizeof(requestHdr), _os.b.end());
+
+            _hedgeTask = make_shared<HedgeTask>(static_pointer_cast<OutgoingAsync>(shared_from_this()));
+            _instance->timer()->schedule(_hedgeTask, delay);
+        }
+    }
+
     //
     // NOTE: invokeImpl doesn't throw so this can be called from the
     // try block with the catch block calling abort(ex) in case of an
@@ -1098,6 +1267,79 @@ OutgoingAsync::invoke(
     }
 }
 
+void
+OutgoingAsync::hedge()
+{
+    OutgoingAsyncPtr hedge;
+    {
+        Lock sync(_m);
+        if (_completion != Completion::Pending || _hedge || !_instance->hedgingPolicy()->takeBudget(*_hedgeKey))
+        {
+            return;
+        }
+
+        // The hedged invocation uses its own connection, which is established to another endpoint unless the proxy
+        // has a single endpoint or uses the ordered endpoint selection.
+        hedge = make_shared<HedgedOutgoingAsync>(
+            _proxy->ice_connectionId(_proxy->ice_getConnectionId() + "-hedge"),
+            static_pointer_cast<OutgoingAsync>(shared_from_this()),
+            _mode,
+            _hedgeRequestBody);
+        _hedge = hedge;
+    }
+    hedge->retry();
+}
+
+void
+OutgoingAsync::hedgeResponse(const OutgoingAsyncPtr& hedge)
+{
+    if (claimCompletion(true))
+    {
+        // Called with the connection of the hedged invocation locked, the completion is done from the client thread
+        // pool.
+        auto self = static_pointer_cast<OutgoingAsync>(shared_from_this());
+        try
+        {
+            _instance->clientThreadPool()->execute([self, hedge]() { self->completeWithHedge(hedge); }, nullptr);
+        }
+        catch (const CommunicatorDestroyedException&)
+        {
+        }
+    }
+}
+
+void
+OutgoingAsync::completeWithHedge(const OutgoingAsyncPtr& hedge)
+{
+    // Cancel this invocation first: once canceled, its connection no longer updates the input stream.
+    OutgoingAsyncBase::cancel(make_exception_ptr(InvocationCanceledException(__FILE__, __LINE__)));
+    if (_proxy._getReference()->getInvocationTimeout() != -1)
+    {
+        _instance->timer()->cancel(shared_from_this());
+    }
+
+    _instance->hedgingPolicy()->record(
+        *_hedgeKey,
+        chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - _invokeTime));
+
+    _is.swap(*hedge->getIs());
+
+    bool invoke;
+    try
+    {
+        invoke = OutgoingAsyncBase::responseImpl(readReplyStatus() == replyOK, true);
+    }
+    catch (const Exception&)
+    {
+        invoke = OutgoingAsyncBase::exceptionImpl(current_exception());
+    }
+
+    if (invoke)
+    {
+        invokeResponse(); // Calls the exception callback if the reply is an exception.
+    }
+}
+
 void
 OutgoingAsync::throwUserException()
 {
@@ -17,6 +17,13 @@
 
 #include <iterator>
 
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <cerrno>
+#    include <unistd.h>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -333,6 +340,56 @@ Ice::OutputStream::writeBlob(const vector<byte>& v)
     }
 }
 
+void
+Ice::OutputStream::write(const FileRange& v)
+{
+    if (v.size < 0 || v.offset < 0)
+    {
+        throw MarshalException(__FILE__, __LINE__, "invalid file range");
+    }
+
+    writeSize(v.size);
+    Container::size_type pos = b.size();
+    resize(pos + static_cast<size_t>(v.size));
+
+    // Read the range with positional reads, which don't change the file offset.
+    size_t count = 0;
+    while (count < static_cast<size_t>(v.size))
+    {
+        size_t remaining = static_cast<size_t>(v.size) - count;
+        int64_t offset = v.offset + static_cast<int64_t>(count);
+#ifdef _WIN32
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD ret = 0;
+        if (!ReadFile(v.file, &b[pos + count], static_cast<DWORD>(remaining), &ret, &overlapped))
+        {
+            DWORD error = GetLastError();
+            if (error != ERROR_HANDLE_EOF)
+            {
+                throw SyscallException(__FILE__, __LINE__, "cannot read file range", error);
+            }
+        }
+#else
+        ssize_t ret = ::pread(v.file, &b[pos + count], remaining, static_cast<off_t>(offset));
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw SyscallException(__FILE__, __LINE__, "cannot read file range", errno);
+        }
+#endif
+        if (ret == 0)
+        {
+            throw MarshalException(__FILE__, __LINE__, "file range extends beyond the end of the file");
+        }
+        count += static_cast<size_t>(ret);
+    }
+}
+
 void
 Ice::OutputStream::write(const byte* begin, const byte* end)
 {
@@ -48,6 +48,13 @@ namespace IceInternal
     extern const std::byte requestBatchHdr[headerSize + sizeof(std::int32_t)];
     extern const std::byte replyHdr[headerSize];
 
+    //
+    // The reserved request context entries carrying the deadline of a request, in milliseconds since the Unix epoch,
+    // and its dispatch priority.
+    //
+    const char* const deadlineContextKey = "_deadline";
+    const char* const priorityContextKey = "_priority";
+
     //
     // IPv4/IPv6 support enumeration.
     //
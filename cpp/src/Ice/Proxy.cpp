@@ -121,6 +121,12 @@ Ice::ObjectPrx::ice_isConnectionCached() const noexcept
     return _reference->getCacheConnection();
 }
 
+int32_t
+Ice::ObjectPrx::ice_getConnectionPoolSize() const noexcept
+{
+    return _reference->getConnectionPoolSize();
+}
+
 EndpointSelectionType
 Ice::ObjectPrx::ice_getEndpointSelection() const noexcept
 {
@@ -354,6 +360,25 @@ Ice::ObjectPrx::_connectionId(string id) const
     }
 }
 
+ReferencePtr
+Ice::ObjectPrx::_connectionPoolSize(int newSize) const
+{
+    if (newSize < 1)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_connectionPoolSize: " << newSize;
+        throw invalid_argument(s.str());
+    }
+    if (newSize == _reference->getConnectionPoolSize())
+    {
+        return _reference;
+    }
+    else
+    {
+        return _reference->changeConnectionPoolSize(newSize);
+    }
+}
+
 ReferencePtr
 Ice::ObjectPrx::_context(Context newContext) const
 {
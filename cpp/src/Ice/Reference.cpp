@@ -527,6 +527,12 @@ IceInternal::FixedReference::getEndpointSelection() const noexcept
     return EndpointSelectionType::Random;
 }
 
+int
+IceInternal::FixedReference::getConnectionPoolSize() const noexcept
+{
+    return 1;
+}
+
 int
 IceInternal::FixedReference::getLocatorCacheTimeout() const noexcept
 {
@@ -575,6 +581,12 @@ IceInternal::FixedReference::changeCacheConnection(bool) const
     throw FixedProxyException(__FILE__, __LINE__);
 }
 
+ReferencePtr
+IceInternal::FixedReference::changeConnectionPoolSize(int) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+}
+
 ReferencePtr
 IceInternal::FixedReference::changePreferSecure(bool) const
 {
@@ -735,6 +747,12 @@ IceInternal::FixedReference::operator<(const Reference& r) const noexcept
     return _fixedConnection < rhs->_fixedConnection;
 }
 
+size_t
+IceInternal::FixedReference::targetHash() const noexcept
+{
+    return std::hash<ConnectionI*>{}(_fixedConnection.get());
+}
+
 ReferencePtr
 IceInternal::FixedReference::clone() const
 {
@@ -765,6 +783,7 @@ IceInternal::RoutableReference::RoutableReference(
     bool cacheConnection,
     bool preferSecure,
     EndpointSelectionType endpointSelection,
+    int connectionPoolSize,
     int locatorCacheTimeout,
     int invocationTimeout,
     const Ice::Context& ctx)
@@ -777,6 +796,7 @@ IceInternal::RoutableReference::RoutableReference(
       _cacheConnection(cacheConnection),
       _preferSecure(preferSecure),
       _endpointSelection(endpointSelection),
+      _connectionPoolSize(connectionPoolSize),
       _locatorCacheTimeout(locatorCacheTimeout)
 {
     assert(_adapterId.empty() || _endpoints.empty());
@@ -831,6 +851,12 @@ IceInternal::RoutableReference::getEndpointSelection() const noexcept
     return _endpointSelection;
 }
 
+int
+IceInternal::RoutableReference::getConnectionPoolSize() const noexcept
+{
+    return _connectionPoolSize;
+}
+
 int
 IceInternal::RoutableReference::getLocatorCacheTimeout() const noexcept
 {
@@ -952,6 +978,14 @@ IceInternal::RoutableReference::changeEndpointSelection(EndpointSelectionType ne
     return r;
 }
 
+ReferencePtr
+IceInternal::RoutableReference::changeConnectionPoolSize(int newSize) const
+{
+    RoutableReferencePtr r = dynamic_pointer_cast<RoutableReference>(clone());
+    r->_connectionPoolSize = newSize;
+    return r;
+}
+
 ReferencePtr
 IceInternal::RoutableReference::changeLocatorCacheTimeout(int timeout) const
 {
@@ -1090,8 +1124,19 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
-    properties[prefix + ".EndpointSelection"] =
-        _endpointSelection == EndpointSelectionType::Random ? "Random" : "Ordered";
+    switch (_endpointSelection)
+    {
+        case EndpointSelectionType::Random:
+            properties[prefix + ".EndpointSelection"] = "Random";
+            break;
+        case EndpointSelectionType::Ordered:
+            properties[prefix + ".EndpointSelection"] = "Ordered";
+            break;
+        case EndpointSelectionType::LeastLoaded:
+            properties[prefix + ".EndpointSelection"] = "LeastLoaded";
+            break;
+    }
+    properties[prefix + ".ConnectionPoolSize"] = to_string(_connectionPoolSize);
     properties[prefix + ".LocatorCacheTimeout"] = to_string(_locatorCacheTimeout);
     properties[prefix + ".InvocationTimeout"] = to_string(getInvocationTimeout());
 
@@ -1125,6 +1170,23 @@ IceInternal::RoutableReference::hash() const noexcept
     return h;
 }
 
+size_t
+IceInternal::RoutableReference::targetHash() const noexcept
+{
+    size_t h = 5381;
+    if (_endpoints.empty() && _adapterId.empty())
+    {
+        hashAdd(h, getIdentity().name);
+        hashAdd(h, getIdentity().category);
+    }
+    else
+    {
+        hashAdd(h, _adapterId);
+        hashAdd(h, _endpoints);
+    }
+    return h;
+}
+
 bool
 IceInternal::RoutableReference::operator==(const Reference& r) const noexcept
 {
@@ -1157,6 +1219,10 @@ IceInternal::RoutableReference::operator==(const Reference& r) const noexcept
     {
         return false;
     }
+    if (_connectionPoolSize != rhs->_connectionPoolSize)
+    {
+        return false;
+    }
     if (_connectionId != rhs->_connectionId)
     {
         return false;
@@ -1249,6 +1315,14 @@ IceInternal::RoutableReference::operator<(const Reference& r) const noexcept
     {
         return false;
     }
+    if (_connectionPoolSize < rhs->_connectionPoolSize)
+    {
+        return true;
+    }
+    else if (rhs->_connectionPoolSize < _connectionPoolSize)
+    {
+        return false;
+    }
     if (_connectionId < rhs->_connectionId)
     {
         return true;
@@ -1478,6 +1552,33 @@ IceInternal::RoutableReference::createConnectionAsync(
     OutgoingConnectionFactoryPtr factory = getInstance()->outgoingConnectionFactory();
     auto self = static_pointer_cast<RoutableReference>(const_cast<RoutableReference*>(this)->shared_from_this());
 
+    const bool leastLoaded = getEndpointSelection() == EndpointSelectionType::LeastLoaded;
+    if (leastLoaded && endpoints.size() > 1)
+    {
+        //
+        // Power of two choices: pick two random endpoints among the preferred endpoints (filterEndpoints puts the
+        // preferred secure or non-secure endpoints first) and try first the one with the less loaded connection. An
+        // endpoint without connection has no load, a connection to this endpoint is established. The other endpoints
+        // remain in random order for fail-over.
+        //
+        auto preferred = static_cast<unsigned int>(
+            find_if(
+                endpoints.begin(),
+                endpoints.end(),
+                [secure = endpoints.front()->secure()](const EndpointIPtr& p) { return p->secure() != secure; }) -
+            endpoints.begin());
+        if (preferred > 1)
+        {
+            unsigned int i = IceInternal::random(preferred);
+            unsigned int j = IceInternal::random(preferred - 1);
+            if (j >= i)
+            {
+                ++j;
+            }
+            swap(endpoints[0], endpoints[factory->getLoad(endpoints[j]) < factory->getLoad(endpoints[i]) ? j : i]);
+        }
+    }
+
     auto createConnectionSucceded =
         [routerInfo = _routerInfo, response = std::move(response)](Ice::ConnectionIPtr connection, bool compress)
     {
@@ -1490,13 +1591,14 @@ IceInternal::RoutableReference::createConnectionAsync(
         response(std::move(connection), compress);
     };
 
-    if (getCacheConnection() || endpoints.size() == 1)
+    if ((getCacheConnection() && !leastLoaded) || endpoints.size() == 1)
     {
         // Get an existing connection or create one if there's no existing connection to one of the given endpoints.
         factory->createAsync(
             std::move(endpoints),
             false,
             getEndpointSelection(),
+            _connectionPoolSize,
             std::move(createConnectionSucceded),
             std::move(exception));
     }
@@ -1513,11 +1615,13 @@ IceInternal::RoutableReference::createConnectionAsync(
                 vector<EndpointIPtr> endpoints,
                 OutgoingConnectionFactoryPtr factory,
                 EndpointSelectionType endpointSelection,
+                int connectionPoolSize,
                 function<void(Ice::ConnectionIPtr, bool)> createConnectionSucceded,
                 function<void(exception_ptr)> exception)
                 : _endpoints(std::move(endpoints)),
                   _factory(std::move(factory)),
                   _endpointSelection(endpointSelection),
+                  _connectionPoolSize(connectionPoolSize),
                   _createConnectionSucceded(std::move(createConnectionSucceded)),
                   _createConnectionFailed(std::move(exception))
             {
@@ -1529,6 +1633,7 @@ IceInternal::RoutableReference::createConnectionAsync(
                     {_endpoints[_endpointIndex]},
                     true,
                     _endpointSelection,
+                    _connectionPoolSize,
                     _createConnectionSucceded,
                     [self = shared_from_this()](exception_ptr e) { self->handleException(e); });
             }
@@ -1551,6 +1656,7 @@ IceInternal::RoutableReference::createConnectionAsync(
                     {_endpoints[_endpointIndex]},
                     more,
                     _endpointSelection,
+                    _connectionPoolSize,
                     _createConnectionSucceded,
                     [self = shared_from_this()](exception_ptr e) { self->handleException(e); });
             }
@@ -1561,6 +1667,7 @@ IceInternal::RoutableReference::createConnectionAsync(
             vector<EndpointIPtr> _endpoints;
             OutgoingConnectionFactoryPtr _factory;
             EndpointSelectionType _endpointSelection;
+            int _connectionPoolSize;
             std::function<void(Ice::ConnectionIPtr, bool)> _createConnectionSucceded;
             std::function<void(exception_ptr)> _createConnectionFailed;
         };
@@ -1569,6 +1676,7 @@ IceInternal::RoutableReference::createConnectionAsync(
             std::move(endpoints),
             std::move(factory),
             getEndpointSelection(),
+            _connectionPoolSize,
             std::move(createConnectionSucceded),
             std::move(exception));
         state->createAsync();
@@ -1599,6 +1707,7 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r)
       _cacheConnection(r._cacheConnection),
       _preferSecure(r._preferSecure),
       _endpointSelection(r._endpointSelection),
+      _connectionPoolSize(r._connectionPoolSize),
       _locatorCacheTimeout(r._locatorCacheTimeout),
       _connectionId(r._connectionId)
 {
@@ -1649,6 +1758,7 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
     switch (getEndpointSelection())
     {
         case EndpointSelectionType::Random:
+        case EndpointSelectionType::LeastLoaded: // The least loaded endpoint is moved first by createConnectionAsync.
         {
             IceInternal::shuffle(endpoints.begin(), endpoints.end());
             break;
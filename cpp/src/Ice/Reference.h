@@ -68,6 +68,7 @@ namespace IceInternal
         virtual bool getCacheConnection() const noexcept = 0;
         virtual bool getPreferSecure() const noexcept = 0;
         virtual Ice::EndpointSelectionType getEndpointSelection() const noexcept = 0;
+        virtual int getConnectionPoolSize() const noexcept = 0;
         virtual int getLocatorCacheTimeout() const noexcept = 0;
         virtual std::string getConnectionId() const = 0;
 
@@ -94,12 +95,17 @@ namespace IceInternal
         virtual ReferencePtr changeCacheConnection(bool) const = 0;
         virtual ReferencePtr changePreferSecure(bool) const = 0;
         virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const = 0;
+        virtual ReferencePtr changeConnectionPoolSize(int) const = 0;
 
         virtual ReferencePtr changeConnectionId(std::string) const = 0;
         virtual ReferencePtr changeConnection(Ice::ConnectionIPtr) const = 0;
 
         virtual std::size_t hash() const noexcept;
 
+        // Returns a hash of the target of this reference: its endpoints, its adapter ID, or its identity for a
+        // well-known reference. Unlike hash, it doesn't depend on the invocation settings of the reference.
+        virtual std::size_t targetHash() const noexcept = 0;
+
         // Gets the effective compression setting, taking into account the override.
         std::optional<bool> getCompressOverride() const noexcept;
 
@@ -195,6 +201,7 @@ namespace IceInternal
         bool getCacheConnection() const noexcept final;
         bool getPreferSecure() const noexcept final;
         Ice::EndpointSelectionType getEndpointSelection() const noexcept final;
+        int getConnectionPoolSize() const noexcept final;
         int getLocatorCacheTimeout() const noexcept final;
         std::string getConnectionId() const final;
 
@@ -206,6 +213,7 @@ namespace IceInternal
         ReferencePtr changeCacheConnection(bool) const final;
         ReferencePtr changePreferSecure(bool) const final;
         ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const final;
+        ReferencePtr changeConnectionPoolSize(int) const final;
         ReferencePtr changeLocatorCacheTimeout(int) const final;
 
         ReferencePtr changeConnectionId(std::string) const final;
@@ -223,6 +231,8 @@ namespace IceInternal
         bool operator==(const Reference&) const noexcept final;
         bool operator<(const Reference&) const noexcept final;
 
+        std::size_t targetHash() const noexcept final;
+
         ReferencePtr clone() const final;
 
     private:
@@ -254,6 +264,7 @@ namespace IceInternal
             Ice::EndpointSelectionType,
             int,
             int,
+            int,
             const Ice::Context&);
 
         RoutableReference(const RoutableReference&);
@@ -266,6 +277,7 @@ namespace IceInternal
         bool getCacheConnection() const noexcept final;
         bool getPreferSecure() const noexcept final;
         Ice::EndpointSelectionType getEndpointSelection() const noexcept final;
+        int getConnectionPoolSize() const noexcept final;
         int getLocatorCacheTimeout() const noexcept final;
         std::string getConnectionId() const final;
 
@@ -280,6 +292,7 @@ namespace IceInternal
         ReferencePtr changeCacheConnection(bool) const final;
         ReferencePtr changePreferSecure(bool) const final;
         ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const final;
+        ReferencePtr changeConnectionPoolSize(int) const final;
         ReferencePtr changeLocatorCacheTimeout(int) const final;
 
         ReferencePtr changeConnectionId(std::string) const final;
@@ -296,6 +309,7 @@ namespace IceInternal
         bool operator<(const Reference&) const noexcept final;
 
         std::size_t hash() const noexcept final;
+        std::size_t targetHash() const noexcept final;
 
         ReferencePtr clone() const final;
 
@@ -335,6 +349,7 @@ namespace IceInternal
         bool _cacheConnection;
         bool _preferSecure;
         Ice::EndpointSelectionType _endpointSelection;
+        int _connectionPoolSize;
         int _locatorCacheTimeout;
 
         std::string _connectionId;
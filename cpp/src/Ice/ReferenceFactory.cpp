@@ -689,6 +689,7 @@ IceInternal::ReferenceFactory::checkForUnknownProperties(const string& prefix)
     static const string suffixes[] = {
         "EndpointSelection",
         "ConnectionCached",
+        "ConnectionPoolSize",
         "PreferSecure",
         "LocatorCacheTimeout",
         "InvocationTimeout",
@@ -774,6 +775,7 @@ IceInternal::ReferenceFactory::create(
     bool cacheConnection = true;
     bool preferSecure = defaultsAndOverrides->defaultPreferSecure;
     Ice::EndpointSelectionType endpointSelection = defaultsAndOverrides->defaultEndpointSelection;
+    int connectionPoolSize = defaultsAndOverrides->defaultConnectionPoolSize;
     int locatorCacheTimeout = defaultsAndOverrides->defaultLocatorCacheTimeout;
     int invocationTimeout = defaultsAndOverrides->defaultInvocationTimeout;
     Ice::Context ctx;
@@ -842,18 +844,38 @@ IceInternal::ReferenceFactory::create(
             {
                 endpointSelection = EndpointSelectionType::Ordered;
             }
+            else if (type == "LeastLoaded")
+            {
+                endpointSelection = EndpointSelectionType::LeastLoaded;
+            }
             else
             {
                 throw ParseException(
                     __FILE__,
                     __LINE__,
-                    "illegal value '" + type + "' for property " + property + "; expected 'Random' or 'Ordered'");
+                    "illegal value '" + type + "' for property " + property +
+                        "; expected 'Random', 'Ordered' or 'LeastLoaded'");
             }
         }
 
-        property = propertyPrefix + ".LocatorCacheTimeout";
+        property = propertyPrefix + ".ConnectionPoolSize";
         string value = properties->getProperty(property);
         if (!value.empty())
+        {
+            connectionPoolSize = properties->getPropertyAsIntWithDefault(property, connectionPoolSize);
+            if (connectionPoolSize < 1)
+            {
+                connectionPoolSize = 1;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "'" << properties->getProperty(property) << "'"
+                    << ": defaulting to 1";
+            }
+        }
+
+        property = propertyPrefix + ".LocatorCacheTimeout";
+        value = properties->getProperty(property);
+        if (!value.empty())
         {
             locatorCacheTimeout = properties->getPropertyAsIntWithDefault(property, locatorCacheTimeout);
             if (locatorCacheTimeout < -1)
@@ -910,6 +932,7 @@ IceInternal::ReferenceFactory::create(
         cacheConnection,
         preferSecure,
         endpointSelection,
+        connectionPoolSize,
         locatorCacheTimeout,
         invocationTimeout,
         ctx);
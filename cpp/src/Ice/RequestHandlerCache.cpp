@@ -13,7 +13,11 @@ using namespace IceInternal;
 
 RequestHandlerCache::RequestHandlerCache(const ReferencePtr& reference)
     : _reference(reference),
-      _cacheConnection(reference->getCacheConnection())
+      // With LeastLoaded or a connection pool, the connection is selected for each invocation.
+      _cacheConnection(
+          reference->getCacheConnection() &&
+          reference->getEndpointSelection() != EndpointSelectionType::LeastLoaded &&
+          reference->getConnectionPoolSize() <= 1)
 {
 }
 
@@ -0,0 +1,259 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "SchedulerMiddleware.h"
+#include "Ice/InputStream.h"
+#include "Ice/LocalExceptions.h"
+#include "ObjectAdapterI.h"
+#include "Protocol.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <chrono>
+#include <optional>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    // The largest deadline that fits in a system_clock time point, in milliseconds since the Unix epoch.
+    const int64_t maxDeadline =
+        chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::duration::max()).count();
+
+    // Returns the integer value of the given context entry, or nullopt if the entry is absent or malformed.
+    optional<int64_t> readContextEntry(const Context& context, const char* key)
+    {
+        auto p = context.find(key);
+        if (p == context.end())
+        {
+            return nullopt;
+        }
+
+        int64_t value;
+        const char* last = p->second.data() + p->second.size();
+        auto [ptr, ec] = from_chars(p->second.data(), last, value);
+        if (ec != errc{} || ptr != last)
+        {
+            return nullopt;
+        }
+        return value;
+    }
+
+    // Sheds a queued request when its deadline expires.
+    class DeadlineTimerTask final : public TimerTask
+    {
+    public:
+        DeadlineTimerTask(function<void()> shed) : _shed(std::move(shed)) {}
+
+        void runTimerTask() final { _shed(); }
+
+    private:
+        const function<void()> _shed;
+    };
+}
+
+SchedulerMiddleware::SchedulerMiddleware(ObjectPtr next, int maxDispatches, TimerPtr timer)
+    : _next(std::move(next)),
+      _maxDispatches(maxDispatches),
+      _timer(std::move(timer)),
+      _dispatchCount(0),
+      _nextSequence(0)
+{
+    assert(_next);
+    assert(_maxDispatches >= 0);
+    assert(_timer);
+}
+
+void
+SchedulerMiddleware::dispatch(IncomingRequest& request, function<void(OutgoingResponse)> sendResponse)
+{
+    const Current& current = request.current();
+
+    optional<chrono::system_clock::time_point> deadline;
+    if (auto value = readContextEntry(current.ctx, deadlineContextKey))
+    {
+        deadline = chrono::system_clock::time_point{chrono::milliseconds{clamp<int64_t>(*value, 0, maxDeadline)}};
+        if (chrono::system_clock::now() >= *deadline)
+        {
+            // Skip the encapsulation without unmarshaling it. This allows the next batch requests in the same
+            // InputStream to proceed.
+            request.inputStream().skipEncapsulation();
+            throw DeadlineExpiredException{__FILE__, __LINE__};
+        }
+    }
+
+    if (_maxDispatches == 0)
+    {
+        _next->dispatch(request, std::move(sendResponse));
+        return;
+    }
+
+    {
+        lock_guard lock(_mutex);
+        if (_dispatchCount < _maxDispatches)
+        {
+            // A slot is only free when no request is queued: release hands its slot over to the first queued request.
+            assert(_queue.empty());
+            ++_dispatchCount;
+        }
+        else
+        {
+            // Queue a copy of the request and skip its encapsulation, as if it had been dispatched.
+            InputStream& stream = request.inputStream();
+            stream.skipEncapsulation();
+
+            QueueKey key{
+                -static_cast<int>(clamp<int64_t>(
+                    readContextEntry(current.ctx, priorityContextKey).value_or(0),
+                    -INT32_MAX,
+                    INT32_MAX)),
+                _nextSequence++};
+            QueuedRequest& queued = _queue[key];
+            queued.bytes.assign(stream.i - request.size(), stream.i);
+            queued.current = current;
+            queued.sendResponse = std::move(sendResponse);
+            queued.deadline = deadline;
+            if (deadline)
+            {
+                queued.deadlineTask = make_shared<DeadlineTimerTask>(
+                    [self = weak_ptr<SchedulerMiddleware>{shared_from_this()}, key]
+                    {
+                        if (auto middleware = self.lock())
+                        {
+                            middleware->shed(key);
+                        }
+                    });
+                try
+                {
+                    _timer->schedule(
+                        queued.deadlineTask,
+                        max(*deadline - chrono::system_clock::now(), chrono::system_clock::duration::zero()));
+                }
+                catch (const invalid_argument&)
+                {
+                    // The timer is destroyed with the communicator: the request waits for a slot like a request
+                    // without deadline.
+                }
+            }
+            return;
+        }
+    }
+
+    try
+    {
+        dispatchAdmitted(request, std::move(sendResponse));
+    }
+    catch (...)
+    {
+        // When we catch an exception, the dispatch logic guarantees sendResponse was not called.
+        release();
+        throw;
+    }
+}
+
+void
+SchedulerMiddleware::dispatchAdmitted(IncomingRequest& request, function<void(OutgoingResponse)> sendResponse)
+{
+    _next->dispatch(
+        request,
+        [sendResponse = std::move(sendResponse), self = shared_from_this()](OutgoingResponse response)
+        {
+            self->release();
+            sendResponse(std::move(response));
+        });
+}
+
+void
+SchedulerMiddleware::dispatchQueued(QueuedRequest& queued) noexcept
+{
+    // The deadline can expire between the release of the slot and the execution of this dispatch by the thread pool,
+    // before the timer sheds the request.
+    if (queued.deadline && chrono::system_clock::now() >= *queued.deadline)
+    {
+        release();
+        queued.sendResponse(
+            makeOutgoingResponse(make_exception_ptr(DeadlineExpiredException{__FILE__, __LINE__}), queued.current));
+        return;
+    }
+
+    try
+    {
+        // The request header is marshaled with the protocol encoding, like the message the request was copied from.
+        InputStream stream{queued.current.adapter->getCommunicator(), currentProtocolEncoding, queued.bytes};
+        IncomingRequest request{queued.current.requestId, queued.current.con, queued.current.adapter, stream};
+        dispatchAdmitted(request, queued.sendResponse);
+    }
+    catch (...)
+    {
+        // sendResponse was not called, see dispatch.
+        release();
+        queued.sendResponse(makeOutgoingResponse(current_exception(), queued.current));
+    }
+}
+
+void
+SchedulerMiddleware::shed(const QueueKey& key) noexcept
+{
+    QueuedRequest queued;
+    {
+        lock_guard lock(_mutex);
+        auto p = _queue.find(key);
+        if (p == _queue.end())
+        {
+            return; // Already dispatched.
+        }
+        queued = std::move(p->second);
+        _queue.erase(p);
+    }
+    queued.sendResponse(
+        makeOutgoingResponse(make_exception_ptr(DeadlineExpiredException{__FILE__, __LINE__}), queued.current));
+}
+
+void
+SchedulerMiddleware::release() noexcept
+{
+    while (true)
+    {
+        shared_ptr<QueuedRequest> queued;
+        {
+            lock_guard lock(_mutex);
+            assert(_dispatchCount > 0);
+            if (_queue.empty())
+            {
+                --_dispatchCount;
+                return;
+            }
+
+            // The slot goes to the first queued request.
+            queued = make_shared<QueuedRequest>(std::move(_queue.begin()->second));
+            _queue.erase(_queue.begin());
+        }
+
+        if (queued->deadlineTask)
+        {
+            _timer->cancel(queued->deadlineTask);
+        }
+
+        // Dispatch the queued request from the adapter's thread pool, not from the thread releasing the slot, which
+        // can be a thread sending an AMD response.
+        try
+        {
+            auto adapter = dynamic_pointer_cast<ObjectAdapterI>(queued->current.adapter);
+            assert(adapter);
+            adapter->getThreadPool()->execute(
+                [self = shared_from_this(), queued] { self->dispatchQueued(*queued); },
+                queued->current.con);
+            return;
+        }
+        catch (...)
+        {
+            // The thread pool is destroyed; fail the request and release its slot.
+            queued->sendResponse(makeOutgoingResponse(current_exception(), queued->current));
+        }
+    }
+}
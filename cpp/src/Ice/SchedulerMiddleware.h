@@ -0,0 +1,65 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_SCHEDULER_MIDDLEWARE_H
+#define ICE_SCHEDULER_MIDDLEWARE_H
+
+#include "Ice/Object.h"
+#include "Ice/Timer.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace IceInternal
+{
+    // A middleware that sheds the requests whose deadline, carried by the _deadline context entry, has expired. When
+    // configured with a dispatch limit, it also limits the number of concurrent dispatches: the requests that exceed
+    // the limit are queued and admitted by decreasing priority, carried by the _priority context entry, then by
+    // arrival order. A queued request doesn't hold a thread: it's dispatched by the adapter's thread pool when a
+    // dispatch slot is released, or shed as soon as its deadline expires.
+    class SchedulerMiddleware final : public Ice::Object, public std::enable_shared_from_this<SchedulerMiddleware>
+    {
+    public:
+        SchedulerMiddleware(Ice::ObjectPtr next, int maxDispatches, Ice::TimerPtr timer);
+
+        void dispatch(Ice::IncomingRequest&, std::function<void(Ice::OutgoingResponse)>) final;
+
+    private:
+        // The negated priority and the arrival sequence of a queued request.
+        using QueueKey = std::pair<int, std::uint64_t>;
+
+        // A queued request. It holds a copy of the request bytes since the caller reuses its input stream once
+        // dispatch returns.
+        struct QueuedRequest
+        {
+            std::vector<std::byte> bytes; // All the bytes of the request, starting with the identity of the target.
+            Ice::Current current;
+            std::function<void(Ice::OutgoingResponse)> sendResponse;
+            std::optional<std::chrono::system_clock::time_point> deadline;
+            Ice::TimerTaskPtr deadlineTask; // Sheds the request when its deadline expires, null if it has no deadline.
+        };
+
+        void dispatchAdmitted(Ice::IncomingRequest&, std::function<void(Ice::OutgoingResponse)>);
+        void dispatchQueued(QueuedRequest&) noexcept;
+        void shed(const QueueKey&) noexcept;
+        void release() noexcept;
+
+        Ice::ObjectPtr _next;
+        const int _maxDispatches; // 0 means no limit.
+        const Ice::TimerPtr _timer;
+
+        std::mutex _mutex;
+        int _dispatchCount;
+        std::uint64_t _nextSequence;
+        std::map<QueueKey, QueuedRequest> _queue;
+    };
+}
+
+#endif
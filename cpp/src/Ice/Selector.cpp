@@ -24,6 +24,14 @@ namespace
 {
     struct timespec zeroTimeout = {0, 0};
 }
+#elif defined(ICE_USE_IO_URING)
+namespace
+{
+    // The io_uring user data of the interrupt pipe poll request and of poll removal requests. The poll requests of
+    // event handlers use increasing identifiers starting after these.
+    const uint64_t ioUringWakeupId = 0;
+    const uint64_t ioUringRemoveId = 1;
+}
 #endif
 
 #if defined(ICE_USE_IOCP)
@@ -199,6 +207,10 @@ Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrup
         Ice::Error out(_instance->initializationData().logger);
         out << "error while updating selector:\n" << IceInternal::errorToString(IceInternal::getSocketErrno());
     }
+#        if defined(ICE_USE_IO_URING)
+    _nextIoUringId = ioUringRemoveId + 1;
+    _ioUringWakeupArmed = false;
+#        endif
 #    elif defined(ICE_USE_KQUEUE)
     _events.resize(256);
     _queueFd = kqueue();
@@ -223,9 +235,33 @@ Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrup
 #    endif
 }
 
+#    if defined(ICE_USE_IO_URING)
+void
+Selector::setupIoUring()
+{
+    assert(!_ioUring);
+    try
+    {
+        _ioUring = make_unique<IoUring>(static_cast<unsigned int>(_events.size()));
+    }
+    catch (const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_instance->initializationData().logger);
+        out << "io_uring is not available, using epoll:\n" << ex;
+    }
+}
+#    endif
+
 void
 Selector::destroy()
 {
+#    if defined(ICE_USE_IO_URING)
+    _ioUringChanges.clear();
+    _ioUringIds.clear();
+    _ioUringPolls.clear();
+    _ioUring.reset();
+#    endif
+
 #    if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
     try
     {
@@ -297,6 +333,13 @@ Selector::enable(EventHandler* handler, SocketOperation status)
     if (handler->_registered & status)
     {
 #    if defined(ICE_USE_EPOLL)
+#        if defined(ICE_USE_IO_URING)
+        if (_ioUring)
+        {
+            queueIoUringUpdate(handler);
+            return;
+        }
+#        endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation previous = static_cast<SocketOperation>(handler->_registered & ~(handler->_disabled | status));
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
@@ -352,6 +395,13 @@ Selector::disable(EventHandler* handler, SocketOperation status)
     if (handler->_registered & status)
     {
 #    if defined(ICE_USE_EPOLL)
+#        if defined(ICE_USE_IO_URING)
+        if (_ioUring)
+        {
+            queueIoUringUpdate(handler);
+            return;
+        }
+#        endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
         epoll_event event;
@@ -413,6 +463,11 @@ Selector::finish(EventHandler* handler, bool closeNow)
     {
         return false;
     }
+#    elif defined(ICE_USE_IO_URING)
+    if (_ioUring && _ioUringPolls.find(handler) != _ioUringPolls.end())
+    {
+        return false; // Don't close now, the poll request still references the file until the next select
+    }
 #    endif
 
     return closeNow;
@@ -492,7 +547,12 @@ Selector::startSelect()
         _interrupted = false;
     }
 
-#    if !defined(ICE_USE_EPOLL)
+#    if defined(ICE_USE_IO_URING)
+    if (_ioUring)
+    {
+        updateIoUring();
+    }
+#    elif !defined(ICE_USE_EPOLL)
     if (!_changes.empty())
     {
         updateSelector();
@@ -514,6 +574,13 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation>>& handlers)
 
     assert(handlers.empty());
 
+#    if defined(ICE_USE_IO_URING)
+    if (_ioUring)
+    {
+        finishIoUringSelect();
+    }
+#    endif
+
 #    if defined(ICE_USE_POLL)
     if (_interrupted) // Interrupted, we have to process the interrupt before returning any handlers
     {
@@ -624,7 +691,16 @@ Selector::select(int timeout)
     while (true)
     {
 #    if defined(ICE_USE_EPOLL)
-        _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+#        if defined(ICE_USE_IO_URING)
+        if (_ioUring)
+        {
+            _count = _ioUring->submitAndWait(timeout);
+        }
+        else
+#        endif
+        {
+            _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+        }
 #    elif defined(ICE_USE_KQUEUE)
         assert(!_events.empty());
         if (timeout >= 0)
@@ -789,6 +865,14 @@ Selector::updateSelectorForEventHandler(
     [[maybe_unused]] SocketOperation add)
 {
 #    if defined(ICE_USE_EPOLL)
+#        if defined(ICE_USE_IO_URING)
+    if (_ioUring)
+    {
+        queueIoUringUpdate(handler);
+        checkReady(handler);
+        return;
+    }
+#        endif
     SocketOperation previous = handler->_registered;
     previous = static_cast<SocketOperation>(previous & ~add);
     previous = static_cast<SocketOperation>(previous | remove);
@@ -885,6 +969,132 @@ Selector::updateSelectorForEventHandler(
     checkReady(handler);
 }
 
+#    if defined(ICE_USE_IO_URING)
+void
+Selector::queueIoUringUpdate(EventHandler* handler)
+{
+    // The poll request of the handler is updated by the next select, we wake up the selecting thread if needed.
+    _ioUringChanges.insert(handler->shared_from_this());
+    wakeup();
+}
+
+void
+Selector::updateIoUring()
+{
+    if (!_ioUringWakeupArmed)
+    {
+        _ioUring->pollAdd(_fdIntrRead, POLLIN, ioUringWakeupId);
+        _ioUringWakeupArmed = true;
+    }
+
+    for (const auto& handler : _ioUringChanges)
+    {
+        NativeInfoPtr nativeInfo = handler->getNativeInfo();
+        SOCKET fd = nativeInfo ? nativeInfo->fd() : INVALID_SOCKET;
+        SocketOperation status = SocketOperationNone;
+        if (fd != INVALID_SOCKET)
+        {
+            status = static_cast<SocketOperation>(
+                handler->_registered & ~handler->_disabled & (SocketOperationRead | SocketOperationWrite));
+        }
+
+        auto p = _ioUringPolls.find(handler.get());
+        if (p != _ioUringPolls.end() && p->second.id != 0 && (p->second.armed != status || p->second.fd != fd))
+        {
+            // Remove the armed poll request, its completion is ignored since it's no longer in _ioUringIds.
+            _ioUring->pollRemove(p->second.id, ioUringRemoveId);
+            _ioUringIds.erase(p->second.id);
+            p->second.id = 0;
+            p->second.armed = SocketOperationNone;
+        }
+
+        if (status == SocketOperationNone)
+        {
+            if (p != _ioUringPolls.end())
+            {
+                _ioUringPolls.erase(p);
+            }
+            continue;
+        }
+
+        if (p == _ioUringPolls.end())
+        {
+            p = _ioUringPolls.insert(make_pair(handler.get(), IoUringPoll{handler, fd, 0, SocketOperationNone})).first;
+        }
+
+        if (p->second.id == 0)
+        {
+            uint32_t events = 0;
+            if (status & SocketOperationRead)
+            {
+                events |= POLLIN;
+            }
+            if (status & SocketOperationWrite)
+            {
+                events |= POLLOUT;
+            }
+            p->second.fd = fd;
+            p->second.id = _nextIoUringId++;
+            p->second.armed = status;
+            _ioUringIds.insert(make_pair(p->second.id, handler.get()));
+            _ioUring->pollAdd(fd, events, p->second.id);
+        }
+    }
+    _ioUringChanges.clear();
+}
+
+void
+Selector::finishIoUringSelect()
+{
+    //
+    // Convert the completions into epoll events. The poll requests are one-shot so the completed requests are re-armed
+    // by the next select if the handler is still registered for the operation.
+    //
+    _count = 0;
+    uint64_t id;
+    int32_t result;
+    while (static_cast<size_t>(_count) < _events.size() && _ioUring->nextCompletion(id, result))
+    {
+        EventHandler* handler = nullptr;
+        if (id == ioUringRemoveId)
+        {
+            continue;
+        }
+        else if (id == ioUringWakeupId)
+        {
+            _ioUringWakeupArmed = false;
+        }
+        else
+        {
+            auto p = _ioUringIds.find(id);
+            if (p == _ioUringIds.end())
+            {
+                continue; // Completion of a removed poll request.
+            }
+            handler = p->second;
+            _ioUringIds.erase(p);
+
+            IoUringPoll& poll = _ioUringPolls[handler];
+            poll.id = 0;
+            poll.armed = SocketOperationNone;
+            _ioUringChanges.insert(poll.handler);
+        }
+
+        struct epoll_event& ev = _events[static_cast<size_t>(_count++)];
+        memset(&ev, 0, sizeof(epoll_event));
+        ev.data.ptr = handler;
+        if (result < 0 || (result & (POLLERR | POLLHUP)))
+        {
+            ev.events = EPOLLERR;
+        }
+        else
+        {
+            ev.events = static_cast<uint32_t>(result);
+        }
+    }
+}
+#    endif
+
 #elif defined(ICE_USE_CFSTREAM)
 
 namespace
@@ -14,8 +14,17 @@
 
 #include <map>
 
+#if defined(ICE_USE_IO_URING)
+#    include <memory>
+#    include <set>
+#    include <unordered_map>
+#endif
+
 #if defined(ICE_USE_EPOLL)
 #    include <sys/epoll.h>
+#    if defined(ICE_USE_IO_URING)
+#        include "IoUring.h"
+#    endif
 #elif defined(ICE_USE_KQUEUE)
 #    include <sys/event.h>
 #elif defined(ICE_USE_IOCP)
@@ -83,6 +92,12 @@ namespace IceInternal
 
         void destroy();
 
+#    if defined(ICE_USE_IO_URING)
+        // Switches this selector to io_uring poll requests instead of epoll. Falls back to epoll with a warning if
+        // io_uring isn't available. Must be called before any event handler is registered.
+        void setupIoUring();
+#    endif
+
         void initialize(EventHandler*)
         {
             // Nothing to do
@@ -103,6 +118,11 @@ namespace IceInternal
         void checkReady(EventHandler*);
         void updateSelector();
         void updateSelectorForEventHandler(EventHandler*, SocketOperation, SocketOperation);
+#    if defined(ICE_USE_IO_URING)
+        void queueIoUringUpdate(EventHandler*);
+        void updateIoUring();
+        void finishIoUringSelect();
+#    endif
 
         const InstancePtr _instance;
 
@@ -117,6 +137,26 @@ namespace IceInternal
 #    if defined(ICE_USE_EPOLL)
         std::vector<struct epoll_event> _events;
         int _queueFd;
+#        if defined(ICE_USE_IO_URING)
+        //
+        // With io_uring, each registered event handler has at most one armed one-shot poll request. The requests are
+        // (re-)armed by startSelect for the handlers in _ioUringChanges and submitted with the wait of select. This
+        // provides the level-triggered semantics of epoll with a single system call per select.
+        //
+        struct IoUringPoll
+        {
+            EventHandlerPtr handler;
+            SOCKET fd;
+            std::uint64_t id;
+            SocketOperation armed;
+        };
+        std::unique_ptr<IoUring> _ioUring;
+        std::map<EventHandler*, IoUringPoll> _ioUringPolls;
+        std::unordered_map<std::uint64_t, EventHandler*> _ioUringIds;
+        std::set<EventHandlerPtr> _ioUringChanges;
+        std::uint64_t _nextIoUringId;
+        bool _ioUringWakeupArmed;
+#        endif
 #    elif defined(ICE_USE_KQUEUE)
         std::vector<struct kevent> _events;
         std::vector<struct kevent> _changes;
@@ -3,6 +3,7 @@
 //
 
 #include "ServantManager.h"
+#include "HashUtil.h"
 #include "Ice/InputStream.h"
 #include "Ice/LocalExceptions.h"
 #include "Ice/LoggerUtil.h"
@@ -21,16 +22,13 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    ServantMapShard& shard = getShard(ident);
+    lock_guard shardLock(shard.mutex);
 
-    if (p == _servantMapMap.end() || p->first != ident)
+    ServantMapMap::iterator p = shard.servantMapMap.find(ident);
+    if (p == shard.servantMapMap.end())
     {
-        p = _servantMapMap.find(ident);
-    }
-
-    if (p == _servantMapMap.end())
-    {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
+        p = shard.servantMapMap.insert(pair<const Identity, FacetMap>(ident, FacetMap())).first;
     }
     else
     {
@@ -47,8 +45,6 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
         }
     }
 
-    _servantMapMapHint = p;
-
     p->second.insert(pair<const string, ObjectPtr>(facet, object));
 }
 
@@ -79,15 +75,13 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
+    ServantMapShard& shard = getShard(ident);
+    lock_guard shardLock(shard.mutex);
 
-    if (p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    ServantMapMap::iterator p = shard.servantMapMap.find(ident);
+    FacetMap::iterator q;
 
-    if (p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if (p == shard.servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
         ToStringMode toStringMode = _instance->toStringMode();
         ostringstream os;
@@ -104,15 +98,7 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     if (p->second.empty())
     {
-        if (p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        shard.servantMapMap.erase(p);
     }
     return servant;
 }
@@ -147,14 +133,11 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    if (p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    ServantMapShard& shard = getShard(ident);
+    lock_guard shardLock(shard.mutex);
 
-    if (p == _servantMapMap.end())
+    ServantMapMap::iterator p = shard.servantMapMap.find(ident);
+    if (p == shard.servantMapMap.end())
     {
         throw NotRegisteredException(
             __FILE__,
@@ -163,26 +146,14 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
             Ice::identityToString(ident, _instance->toStringMode()));
     }
 
-    FacetMap result = p->second;
-
-    if (p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
-    {
-        _servantMapMap.erase(p);
-    }
-
+    FacetMap result = std::move(p->second);
+    shard.servantMapMap.erase(p);
     return result;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    lock_guard lock(_mutex);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -191,30 +162,30 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     //
     // assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if (p == servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
+        const ServantMapShard& shard = getShard(ident);
+        shared_lock shardLock(shard.mutex);
+
+        ServantMapMap::const_iterator p = shard.servantMapMap.find(ident);
+        if (p != shard.servantMapMap.end())
+        {
+            FacetMap::const_iterator q = p->second.find(facet);
+            if (q != p->second.end())
+            {
+                return q->second;
+            }
+        }
     }
 
-    if (p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    shared_lock lock(_mutex);
+
+    DefaultServantMap::const_iterator d = _defaultServantMap.find(ident.category);
+    if (d == _defaultServantMap.end())
     {
-        DefaultServantMap::const_iterator d = _defaultServantMap.find(ident.category);
+        d = _defaultServantMap.find("");
         if (d == _defaultServantMap.end())
         {
-            d = _defaultServantMap.find("");
-            if (d == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return d->second;
-            }
+            return 0;
         }
         else
         {
@@ -223,15 +194,14 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return d->second;
     }
 }
 
 ObjectPtr
 IceInternal::ServantManager::findDefaultServant(const string& category) const
 {
-    lock_guard lock(_mutex);
+    shared_lock lock(_mutex);
 
     DefaultServantMap::const_iterator p = _defaultServantMap.find(category);
     if (p == _defaultServantMap.end())
@@ -247,26 +217,16 @@ IceInternal::ServantManager::findDefaultServant(const string& category) const
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    lock_guard lock(_mutex);
-
-    assert(_instance); // Must not be called after destruction.
+    const ServantMapShard& shard = getShard(ident);
+    shared_lock shardLock(shard.mutex);
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if (p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if (p == servantMapMap.end())
+    ServantMapMap::const_iterator p = shard.servantMapMap.find(ident);
+    if (p == shard.servantMapMap.end())
     {
         return FacetMap();
     }
     else
     {
-        _servantMapMapHint = p;
         return p->second;
     }
 }
@@ -274,8 +234,6 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    lock_guard lock(_mutex);
-
     //
     // This assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
@@ -284,21 +242,16 @@ IceInternal::ServantManager::hasServant(const Identity& ident) const
     //
     // assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    const ServantMapShard& shard = getShard(ident);
+    shared_lock shardLock(shard.mutex);
 
-    if (p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if (p == servantMapMap.end())
+    ServantMapMap::const_iterator p = shard.servantMapMap.find(ident);
+    if (p == shard.servantMapMap.end())
     {
         return false;
     }
     else
     {
-        _servantMapMapHint = p;
         assert(!p->second.empty());
         return true;
     }
@@ -311,13 +264,10 @@ IceInternal::ServantManager::addServantLocator(const ServantLocatorPtr& locator,
 
     assert(_instance); // Must not be called after destruction.
 
-    if ((_locatorMapHint != _locatorMap.end() && _locatorMapHint->first == category) ||
-        _locatorMap.find(category) != _locatorMap.end())
+    if (!_locatorMap.insert(pair<const string, ServantLocatorPtr>(category, locator)).second)
     {
         throw AlreadyRegisteredException(__FILE__, __LINE__, "servant locator", category);
     }
-
-    _locatorMapHint = _locatorMap.insert(_locatorMapHint, pair<const string, ServantLocatorPtr>(category, locator));
 }
 
 ServantLocatorPtr
@@ -327,20 +277,7 @@ IceInternal::ServantManager::removeServantLocator(const string& category)
 
     assert(_instance); // Must not be called after destruction.
 
-    map<string, ServantLocatorPtr>::iterator p = _locatorMap.end();
-    if (_locatorMapHint != p)
-    {
-        if (_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if (p == _locatorMap.end())
-    {
-        p = _locatorMap.find(category);
-    }
-
+    map<string, ServantLocatorPtr>::iterator p = _locatorMap.find(category);
     if (p == _locatorMap.end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "servant locator", category);
@@ -348,14 +285,13 @@ IceInternal::ServantManager::removeServantLocator(const string& category)
 
     ServantLocatorPtr locator = p->second;
     _locatorMap.erase(p);
-    _locatorMapHint = _locatorMap.begin();
     return locator;
 }
 
 ServantLocatorPtr
 IceInternal::ServantManager::findServantLocator(const string& category) const
 {
-    lock_guard lock(_mutex);
+    shared_lock lock(_mutex);
 
     //
     // This assert is not valid if the adapter dispatch incoming
@@ -365,25 +301,9 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
     //
     // assert(_instance); // Must not be called after destruction.
 
-    map<string, ServantLocatorPtr>& locatorMap = const_cast<map<string, ServantLocatorPtr>&>(_locatorMap);
-
-    map<string, ServantLocatorPtr>::iterator p = locatorMap.end();
-    if (_locatorMapHint != locatorMap.end())
-    {
-        if (_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if (p == locatorMap.end())
+    map<string, ServantLocatorPtr>::const_iterator p = _locatorMap.find(category);
+    if (p != _locatorMap.end())
     {
-        p = locatorMap.find(category);
-    }
-
-    if (p != locatorMap.end())
-    {
-        _locatorMapHint = p;
         return p->second;
     }
     else
@@ -393,10 +313,7 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
 }
 
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
-    : _instance(instance),
-      _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
-      _locatorMapHint(_locatorMap.end())
+    : _instance(instance), _adapterName(adapterName)
 {
 }
 
@@ -413,7 +330,7 @@ IceInternal::ServantManager::~ServantManager()
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
+    vector<ServantMapMap> servantMapMaps;
     DefaultServantMap defaultServantMap;
     map<string, ServantLocatorPtr> locatorMap;
     Ice::LoggerPtr logger;
@@ -430,13 +347,16 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        servantMapMaps.resize(_servantMapShards.size());
+        for (size_t i = 0; i < _servantMapShards.size(); ++i)
+        {
+            lock_guard shardLock(_servantMapShards[i].mutex);
+            servantMapMaps[i].swap(_servantMapShards[i].servantMapMap);
+        }
 
         defaultServantMap.swap(_defaultServantMap);
 
         locatorMap.swap(_locatorMap);
-        _locatorMapHint = _locatorMap.end();
 
         _instance = 0;
     }
@@ -469,11 +389,32 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors).
     //
-    servantMapMap.clear();
+    servantMapMaps.clear();
     locatorMap.clear();
     defaultServantMap.clear();
 }
 
+size_t
+IceInternal::ServantManager::IdentityHash::operator()(const Identity& ident) const noexcept
+{
+    size_t h = 5381;
+    hashAdd(h, ident.name);
+    hashAdd(h, ident.category);
+    return h;
+}
+
+IceInternal::ServantManager::ServantMapShard&
+IceInternal::ServantManager::getShard(const Identity& ident)
+{
+    return _servantMapShards[IdentityHash{}(ident) % _servantMapShards.size()];
+}
+
+const IceInternal::ServantManager::ServantMapShard&
+IceInternal::ServantManager::getShard(const Identity& ident) const
+{
+    return _servantMapShards[IdentityHash{}(ident) % _servantMapShards.size()];
+}
+
 void
 ServantManager::dispatch(IncomingRequest& request, function<void(OutgoingResponse)> sendResponse)
 {
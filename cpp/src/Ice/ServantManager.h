@@ -12,7 +12,9 @@
 #include "Ice/ServantLocator.h"
 #include "ServantManagerF.h"
 
-#include <mutex>
+#include <array>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace Ice
 {
@@ -47,21 +49,38 @@ namespace IceInternal
         void destroy();
         friend class Ice::ObjectAdapterI;
 
+        struct IdentityHash
+        {
+            std::size_t operator()(const Ice::Identity&) const noexcept;
+        };
+
+        typedef std::unordered_map<Ice::Identity, Ice::FacetMap, IdentityHash> ServantMapMap;
+        typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
+
+        // The servants are sharded by identity, each shard with its own reader-writer lock: concurrent dispatches
+        // only share a lock when they look up servants of the same shard, and never wait for one another.
+        struct ServantMapShard
+        {
+            mutable std::shared_mutex mutex;
+            ServantMapMap servantMapMap;
+        };
+
+        ServantMapShard& getShard(const Ice::Identity&);
+        const ServantMapShard& getShard(const Ice::Identity&) const;
+
         InstancePtr _instance;
 
         const std::string _adapterName;
 
-        typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
-        typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
-
-        ServantMapMap _servantMapMap;
-        mutable ServantMapMap::iterator _servantMapMapHint;
+        std::array<ServantMapShard, 16> _servantMapShards;
 
         DefaultServantMap _defaultServantMap;
 
         std::map<std::string, Ice::ServantLocatorPtr> _locatorMap;
-        mutable std::map<std::string, Ice::ServantLocatorPtr>::iterator _locatorMapHint;
-        mutable std::mutex _mutex;
+
+        // Protects _instance, _defaultServantMap and _locatorMap, and serializes the updates of the servant map
+        // shards. Always locked before the mutex of a shard.
+        mutable std::shared_mutex _mutex;
     };
 }
 
@@ -6,8 +6,20 @@
 #include "NetworkProxy.h"
 #include "ProtocolInstance.h"
 
+#if !defined(_WIN32)
+#    include <sys/uio.h>
+#endif
+
 using namespace IceInternal;
 
+namespace
+{
+#if !defined(ICE_USE_IOCP)
+    // The maximum number of buffers written with a single writev call.
+    const int maxGatherBuffers = 64;
+#endif
+}
+
 StreamSocket::StreamSocket(
     const ProtocolInstancePtr& instance,
     const NetworkProxyPtr& proxy,
@@ -210,6 +222,90 @@ StreamSocket::write(Buffer& buf)
     return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
 }
 
+#if !defined(ICE_USE_IOCP)
+SocketOperation
+StreamSocket::write(const std::vector<Buffer*>& bufs)
+{
+    assert(_fd != INVALID_SOCKET);
+    assert(!bufs.empty());
+
+    if (_state != StateConnected)
+    {
+        return write(*bufs.front());
+    }
+
+    iovec iov[maxGatherBuffers];
+    while (true)
+    {
+        int count = 0;
+        for (std::vector<Buffer*>::const_iterator p = bufs.begin(); p != bufs.end() && count < maxGatherBuffers; ++p)
+        {
+            Buffer& buf = **p;
+            if (buf.i != buf.b.end())
+            {
+                iov[count].iov_base = &*buf.i;
+                iov[count].iov_len = static_cast<size_t>(buf.b.end() - buf.i);
+                ++count;
+            }
+        }
+
+        if (count == 0)
+        {
+            return SocketOperationNone;
+        }
+
+        ssize_t ret = ::writev(_fd, iov, count);
+        if (ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if (ret == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                continue;
+            }
+
+            if (wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            if (noBuffers())
+            {
+                // Fallback to the regular write which reduces the packet size.
+                for (Buffer* buf : bufs)
+                {
+                    if (buf->i != buf->b.end())
+                    {
+                        return write(*buf);
+                    }
+                }
+            }
+
+            if (connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        // Advance the buffer iterators past the bytes that were sent.
+        size_t sent = static_cast<size_t>(ret);
+        for (std::vector<Buffer*>::const_iterator p = bufs.begin(); p != bufs.end() && sent > 0; ++p)
+        {
+            Buffer& buf = **p;
+            size_t n = std::min(sent, static_cast<size_t>(buf.b.end() - buf.i));
+            buf.i += n;
+            sent -= n;
+        }
+    }
+}
+#endif
+
 ssize_t
 StreamSocket::read(char* buf, size_t length)
 {
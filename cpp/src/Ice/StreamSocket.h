@@ -10,6 +10,7 @@
 #include "ProtocolInstanceF.h"
 
 #include <memory>
+#include <vector>
 
 namespace IceInternal
 {
@@ -29,6 +30,9 @@ namespace IceInternal
 
         SocketOperation read(Buffer&);
         SocketOperation write(Buffer&);
+#if !defined(ICE_USE_IOCP)
+        SocketOperation write(const std::vector<Buffer*>&);
+#endif
 
         ssize_t read(char*, size_t);
         ssize_t write(const char*, size_t);
@@ -2,14 +2,6 @@
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
 
-// TODO codecvt was deprecated in C++17 and cause build failures in C++17 mode
-// For VC++ we should replace this code with MultiByteToWideChar() and WideCharToMultiByte()
-#if defined(_MSC_VER) && (_MSVC_LANG >= 201703L)
-#    define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
-#elif (__cplusplus >= 201703L)
-#    include "DisableWarnings.h"
-#endif
-
 #include "Ice/StringConverter.h"
 #include "Ice/StringUtil.h"
 
@@ -17,10 +9,21 @@
 #    include <windows.h>
 #endif
 
+#if defined(__x86_64__) || defined(_M_X64)
+#    define ICE_UTF8_SIMD
+#    include <immintrin.h>
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        define ICE_TARGET_AVX2
+#    else
+#        define ICE_TARGET_AVX2 __attribute__((target("avx2")))
+#    endif
+#endif
+
 #include <cassert>
-#include <codecvt>
-#include <locale>
+#include <cstring>
 #include <mutex>
+#include <type_traits>
 
 using namespace Ice;
 using namespace IceInternal;
@@ -32,109 +35,289 @@ namespace
     StringConverterPtr processStringConverter;
     WstringConverterPtr processWstringConverter;
 
-    template<size_t wcharSize> struct SelectCodeCvt;
+    //
+    // UTF-8 transcoding. ASCII runs, the common case, are found with SIMD kernels selected at runtime based on the CPU
+    // features and are widened or narrowed without further checks. The other characters are transcoded and validated
+    // one at a time.
+    //
 
-    template<> struct SelectCodeCvt<2>
+    // Returns the length of the ASCII prefix of the given bytes.
+    size_t asciiPrefixScalar(const uint8_t* p, size_t n) noexcept
     {
-        typedef std::codecvt_utf8_utf16<wchar_t> Type;
-    };
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, p + i, sizeof(uint64_t));
+            if (word & 0x8080808080808080ULL)
+            {
+                break;
+            }
+        }
+        while (i < n && p[i] < 0x80)
+        {
+            ++i;
+        }
+        return i;
+    }
 
-    template<> struct SelectCodeCvt<4>
+#ifdef ICE_UTF8_SIMD
+    unsigned int countTrailingZeros(uint32_t mask) noexcept
     {
-        typedef std::codecvt_utf8<wchar_t> Type;
-    };
+        assert(mask != 0);
+#    if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned int>(index);
+#    else
+        return static_cast<unsigned int>(__builtin_ctz(mask));
+#    endif
+    }
 
-    class UnicodeWstringConverter final : public WstringConverter
+    // SSE2 is always available on x64.
+    size_t asciiPrefixSSE2(const uint8_t* p, size_t n) noexcept
     {
-    public:
-        byte* toUTF8(const wchar_t* sourceStart, const wchar_t* sourceEnd, UTF8Buffer& buffer) const final
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16)
         {
-            //
-            // Max bytes for a character encoding in UTF-8 is 4,
-            // however MSVC returns 6
-            //
-#ifdef _MSC_VER
-            assert(_codecvt.max_length() == 4 || _codecvt.max_length() == 6);
-#else
-            assert(_codecvt.max_length() == 4);
-#endif
-            if (sourceStart == sourceEnd)
+            auto mask = static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i))));
+            if (mask != 0)
             {
-                return buffer.getMoreBytes(1, nullptr);
+                return i + countTrailingZeros(mask);
+            }
+        }
+        return i + asciiPrefixScalar(p + i, n - i);
+    }
+
+    ICE_TARGET_AVX2 size_t asciiPrefixAVX2(const uint8_t* p, size_t n) noexcept
+    {
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            auto mask = static_cast<uint32_t>(
+                _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i))));
+            if (mask != 0)
+            {
+                return i + countTrailingZeros(mask);
             }
+        }
+        return i + asciiPrefixSSE2(p + i, n - i);
+    }
+
+    bool hasAVX2() noexcept
+    {
+#    if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 0x6) != 0x6) // OSXSAVE and YMM state saved by the OS.
+        {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#    else
+        return __builtin_cpu_supports("avx2");
+#    endif
+    }
+#endif
 
-            char* targetStart = 0;
-            char* targetEnd = 0;
-            char* targetNext = 0;
+    size_t asciiPrefix(const uint8_t* p, size_t n) noexcept
+    {
+        using Kernel = size_t (*)(const uint8_t*, size_t) noexcept;
+#ifdef ICE_UTF8_SIMD
+        static const Kernel kernel = hasAVX2() ? asciiPrefixAVX2 : asciiPrefixSSE2;
+#else
+        static const Kernel kernel = asciiPrefixScalar;
+#endif
+        return kernel(p, n);
+    }
 
-            mbstate_t state = mbstate_t(); // must be initialized!
-            const wchar_t* sourceNext = sourceStart;
+    template<typename Char> char32_t toCodePoint(Char c) noexcept
+    {
+        return static_cast<char32_t>(static_cast<std::make_unsigned_t<Char>>(c));
+    }
 
-            bool more = false;
+    // Decodes and validates the UTF-8 sequence starting at p and advances p past this sequence.
+    char32_t decodeUTF8Sequence(const uint8_t*& p, const uint8_t* end)
+    {
+        const uint8_t lead = *p;
+        size_t length;
+        char32_t c;
+        char32_t min;
+        if (lead >= 0xC2 && lead <= 0xDF)
+        {
+            length = 2;
+            c = lead & 0x1F;
+            min = 0x80;
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            length = 3;
+            c = lead & 0x0F;
+            min = 0x800;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4)
+        {
+            length = 4;
+            c = lead & 0x07;
+            min = 0x10000;
+        }
+        else
+        {
+            throw IllegalConversionException(__FILE__, __LINE__, "invalid UTF-8 lead byte");
+        }
 
-            //
-            // The number of bytes we request from buffer for each remaining source character
-            //
-            size_t factor = 2;
+        if (static_cast<size_t>(end - p) < length)
+        {
+            throw IllegalConversionException(__FILE__, __LINE__, "truncated UTF-8 sequence");
+        }
 
-            do
+        for (size_t k = 1; k < length; ++k)
+        {
+            if ((p[k] & 0xC0) != 0x80)
             {
-                assert(factor <= 4);
-                const size_t chunkSize = std::max<size_t>(static_cast<size_t>(sourceEnd - sourceStart) * factor, 4);
-                ++factor; // at the next round, we'll allocate more bytes per remaining source character
+                throw IllegalConversionException(__FILE__, __LINE__, "invalid UTF-8 continuation byte");
+            }
+            c = (c << 6) | (p[k] & 0x3F);
+        }
 
-                targetStart =
-                    reinterpret_cast<char*>(buffer.getMoreBytes(chunkSize, reinterpret_cast<byte*>(targetNext)));
-                targetEnd = targetStart + chunkSize;
-                targetNext = targetStart;
+        // Reject overlong encodings, surrogates and code points beyond the Unicode range.
+        if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+        {
+            throw IllegalConversionException(__FILE__, __LINE__, "invalid UTF-8 sequence");
+        }
+        p += length;
+        return c;
+    }
 
-                codecvt_base::result result =
-                    _codecvt.out(state, sourceStart, sourceEnd, sourceNext, targetStart, targetEnd, targetNext);
+    // Converts UTF-8 to UTF-16 if Char is 2 bytes or to UTF-32 otherwise. The target must hold at least as many
+    // characters as the source has bytes. Returns the end of the converted characters.
+    template<typename Char> Char* fromUTF8Chars(const uint8_t* p, const uint8_t* end, Char* target)
+    {
+        while (p < end)
+        {
+            const size_t n = asciiPrefix(p, static_cast<size_t>(end - p));
+            for (size_t k = 0; k < n; ++k)
+            {
+                target[k] = static_cast<Char>(p[k]);
+            }
+            target += n;
+            p += n;
 
-                switch (result)
+            while (p < end && *p >= 0x80)
+            {
+                char32_t c = decodeUTF8Sequence(p, end);
+                if (sizeof(Char) == 2 && c >= 0x10000)
                 {
-                    case codecvt_base::ok:
-                        //
-                        // MSVC returns ok when target is exhausted
-                        //
-                        more = sourceNext < sourceEnd;
-                        break;
-
-                    case codecvt_base::partial:
-                        //
-                        // clang/libc++ and g++5 return partial when target is exhausted
-                        //
-                        more = true;
-                        assert(sourceNext < sourceEnd);
-                        break;
-
-                    case codecvt_base::noconv:
-                        //
-                        // Unexpected
-                        //
-                        assert(0);
-                        throw IllegalConversionException(__FILE__, __LINE__, "codecvt.out noconv");
-
-                    default:
-                        throw IllegalConversionException(__FILE__, __LINE__, "codecvt.out error");
+                    c -= 0x10000;
+                    *target++ = static_cast<Char>(0xD800 + (c >> 10));
+                    *target++ = static_cast<Char>(0xDC00 + (c & 0x3FF));
                 }
-
-                if (targetStart == targetNext)
+                else
                 {
-                    // We didn't convert a single character
-                    throw IllegalConversionException(__FILE__, __LINE__, "no character converted by codecvt.out");
+                    *target++ = static_cast<Char>(c);
                 }
+            }
+        }
+        return target;
+    }
+
+    // Reads the next code point of UTF-16 (if Char is 2 bytes) or UTF-32 characters and advances p past it.
+    template<typename Char> char32_t readCodePoint(const Char*& p, const Char* end)
+    {
+        char32_t c = toCodePoint(*p++);
+        if (sizeof(Char) == 2 && c >= 0xD800 && c <= 0xDFFF)
+        {
+            if (c > 0xDBFF || p == end || toCodePoint(*p) < 0xDC00 || toCodePoint(*p) > 0xDFFF)
+            {
+                throw IllegalConversionException(__FILE__, __LINE__, "invalid UTF-16 surrogate pair");
+            }
+            c = 0x10000 + ((c - 0xD800) << 10) + (toCodePoint(*p++) - 0xDC00);
+        }
+        else if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+        {
+            throw IllegalConversionException(__FILE__, __LINE__, "invalid UTF-32 character");
+        }
+        return c;
+    }
 
-                sourceStart = sourceNext;
-            } while (more);
+    // Returns the size of the UTF-8 encoding of the given UTF-16 or UTF-32 characters, and validates them.
+    template<typename Char> size_t utf8Size(const Char* p, const Char* end)
+    {
+        size_t size = 0;
+        while (p < end)
+        {
+            if (toCodePoint(*p) < 0x80)
+            {
+                ++p;
+                ++size;
+                continue;
+            }
+            char32_t c = readCodePoint(p, end);
+            size += c < 0x800 ? 2 : (c < 0x10000 ? 3 : 4);
+        }
+        return size;
+    }
+
+    // Converts validated UTF-16 or UTF-32 characters to UTF-8. Returns the end of the converted bytes.
+    template<typename Char> uint8_t* toUTF8Bytes(const Char* p, const Char* end, uint8_t* target)
+    {
+        while (p < end)
+        {
+            while (p < end && toCodePoint(*p) < 0x80)
+            {
+                *target++ = static_cast<uint8_t>(*p++);
+            }
+            if (p == end)
+            {
+                break;
+            }
+
+            char32_t c = readCodePoint(p, end);
+            if (c < 0x800)
+            {
+                *target++ = static_cast<uint8_t>(0xC0 | (c >> 6));
+            }
+            else if (c < 0x10000)
+            {
+                *target++ = static_cast<uint8_t>(0xE0 | (c >> 12));
+                *target++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+            }
+            else
+            {
+                *target++ = static_cast<uint8_t>(0xF0 | (c >> 18));
+                *target++ = static_cast<uint8_t>(0x80 | ((c >> 12) & 0x3F));
+                *target++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+            }
+            *target++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+        }
+        return target;
+    }
+
+    class UnicodeWstringConverter final : public WstringConverter
+    {
+    public:
+        byte* toUTF8(const wchar_t* sourceStart, const wchar_t* sourceEnd, UTF8Buffer& buffer) const final
+        {
+            if (sourceStart == sourceEnd)
+            {
+                return buffer.getMoreBytes(1, nullptr);
+            }
 
-            return reinterpret_cast<byte*>(targetNext);
+            const size_t size = utf8Size(sourceStart, sourceEnd);
+            auto target = reinterpret_cast<uint8_t*>(buffer.getMoreBytes(size, nullptr));
+            return reinterpret_cast<byte*>(toUTF8Bytes(sourceStart, sourceEnd, target));
         }
 
         void fromUTF8(const byte* sourceStart, const byte* sourceEnd, wstring& target) const final
         {
             const size_t sourceSize = static_cast<size_t>(sourceEnd - sourceStart);
-
             if (sourceSize == 0)
             {
                 target = L"";
@@ -142,35 +325,13 @@ namespace
             else
             {
                 target.resize(sourceSize);
-                wchar_t* targetStart = const_cast<wchar_t*>(target.data());
-                wchar_t* targetEnd = targetStart + sourceSize;
-                wchar_t* targetNext = targetStart;
-
-                const char* sourceNext = reinterpret_cast<const char*>(sourceStart);
-
-                mbstate_t state = mbstate_t();
-
-                codecvt_base::result result = _codecvt.in(
-                    state,
-                    reinterpret_cast<const char*>(sourceStart),
-                    reinterpret_cast<const char*>(sourceEnd),
-                    sourceNext,
-                    targetStart,
-                    targetEnd,
-                    targetNext);
-
-                if (result != codecvt_base::ok)
-                {
-                    throw IllegalConversionException(__FILE__, __LINE__, "codecvt.in failure");
-                }
-
-                target.resize(static_cast<size_t>(targetNext - targetStart));
+                wchar_t* targetEnd = fromUTF8Chars(
+                    reinterpret_cast<const uint8_t*>(sourceStart),
+                    reinterpret_cast<const uint8_t*>(sourceEnd),
+                    target.data());
+                target.resize(static_cast<size_t>(targetEnd - target.data()));
             }
         }
-
-    private:
-        typedef SelectCodeCvt<sizeof(wchar_t)>::Type CodeCvt;
-        const CodeCvt _codecvt;
     };
 
     const WstringConverterPtr& getUnicodeWstringConverter()
@@ -355,35 +516,15 @@ Ice::UTF8ToNative(const string& str, const Ice::StringConverterPtr& converter)
     return tmp;
 }
 
-typedef char16_t Char16T;
-typedef char32_t Char32T;
-
 vector<unsigned short>
 IceInternal::toUTF16(const vector<uint8_t>& source)
 {
     vector<unsigned short> result;
     if (!source.empty())
     {
-        assert(sizeof(Char16T) == sizeof(unsigned short));
-
-        typedef wstring_convert<codecvt_utf8_utf16<Char16T>, Char16T> Convert;
-
-        Convert convert;
-
-        try
-        {
-            Convert::wide_string ws = convert.from_bytes(
-                reinterpret_cast<const char*>(&source.front()),
-                reinterpret_cast<const char*>(&source.front() + source.size()));
-
-            result = vector<unsigned short>(
-                reinterpret_cast<const unsigned short*>(ws.data()),
-                reinterpret_cast<const unsigned short*>(ws.data()) + ws.length());
-        }
-        catch (const std::range_error& ex)
-        {
-            throw Ice::IllegalConversionException(__FILE__, __LINE__, ex.what());
-        }
+        result.resize(source.size());
+        unsigned short* last = fromUTF8Chars(source.data(), source.data() + source.size(), result.data());
+        result.resize(static_cast<size_t>(last - result.data()));
     }
     return result;
 }
@@ -394,25 +535,9 @@ IceInternal::toUTF32(const vector<uint8_t>& source)
     vector<unsigned int> result;
     if (!source.empty())
     {
-        assert(sizeof(Char32T) == sizeof(unsigned int));
-
-        typedef wstring_convert<codecvt_utf8<Char32T>, Char32T> Convert;
-        Convert convert;
-
-        try
-        {
-            Convert::wide_string ws = convert.from_bytes(
-                reinterpret_cast<const char*>(&source.front()),
-                reinterpret_cast<const char*>(&source.front() + source.size()));
-
-            result = vector<unsigned int>(
-                reinterpret_cast<const unsigned int*>(ws.data()),
-                reinterpret_cast<const unsigned int*>(ws.data()) + ws.length());
-        }
-        catch (const std::range_error& ex)
-        {
-            throw Ice::IllegalConversionException(__FILE__, __LINE__, ex.what());
-        }
+        result.resize(source.size());
+        unsigned int* last = fromUTF8Chars(source.data(), source.data() + source.size(), result.data());
+        result.resize(static_cast<size_t>(last - result.data()));
     }
     return result;
 }
@@ -423,25 +548,10 @@ IceInternal::fromUTF32(const vector<unsigned int>& source)
     vector<uint8_t> result;
     if (!source.empty())
     {
-        assert(sizeof(Char32T) == sizeof(unsigned int));
-
-        typedef wstring_convert<codecvt_utf8<Char32T>, Char32T> Convert;
-        Convert convert;
-
-        try
-        {
-            Convert::byte_string bs = convert.to_bytes(
-                reinterpret_cast<const Char32T*>(&source.front()),
-                reinterpret_cast<const Char32T*>(&source.front() + source.size()));
-
-            result = vector<uint8_t>(
-                reinterpret_cast<const uint8_t*>(bs.data()),
-                reinterpret_cast<const uint8_t*>(bs.data()) + bs.length());
-        }
-        catch (const std::range_error& ex)
-        {
-            throw Ice::IllegalConversionException(__FILE__, __LINE__, ex.what());
-        }
+        const unsigned int* begin = source.data();
+        const unsigned int* end = begin + source.size();
+        result.resize(utf8Size(begin, end));
+        toUTF8Bytes(begin, end, result.data());
     }
     return result;
 }
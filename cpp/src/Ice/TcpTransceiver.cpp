@@ -55,6 +55,14 @@ IceInternal::TcpTransceiver::read(Buffer& buf)
     return _stream->read(buf);
 }
 
+#    if !defined(ICE_USE_IOCP)
+SocketOperation
+IceInternal::TcpTransceiver::writeGather(const vector<Buffer*>& bufs)
+{
+    return _stream->write(bufs);
+}
+#    endif
+
 #    if defined(ICE_USE_IOCP)
 bool
 IceInternal::TcpTransceiver::startWrite(Buffer& buf)
@@ -28,6 +28,10 @@ namespace IceInternal
         void close() final;
         SocketOperation write(Buffer&) final;
         SocketOperation read(Buffer&) final;
+#if !defined(ICE_USE_IOCP)
+        SocketOperation writeGather(const std::vector<Buffer*>&) final;
+        bool hasGatherWrites() const noexcept final { return true; }
+#endif
 #if defined(ICE_USE_IOCP)
         bool startWrite(Buffer&) final;
         void finishWrite(Buffer&) final;
@@ -12,6 +12,8 @@
 #include "ObjectAdapterFactory.h"
 #include "TraceLevels.h"
 
+#include <algorithm>
+
 #if defined(__FreeBSD__)
 #    include <sys/sysctl.h>
 #endif
@@ -139,16 +141,34 @@ IceInternal::ThreadPoolWorkQueue::getNativeInfo()
 }
 
 ThreadPoolPtr
-IceInternal::ThreadPool::create(const InstancePtr& instance, const string& prefix, int timeout)
+IceInternal::ThreadPool::create(
+    const InstancePtr& instance,
+    const string& prefix,
+    int timeout,
+    function<void(function<void()>, const Ice::ConnectionPtr&)> executor)
 {
-    auto threadPool = std::shared_ptr<ThreadPool>(new ThreadPool(instance, prefix, timeout));
+    if (!executor)
+    {
+        executor = instance->initializationData().executor;
+    }
+    auto threadPool = std::shared_ptr<ThreadPool>(new ThreadPool(instance, prefix, timeout, std::move(executor)));
     threadPool->initialize();
     return threadPool;
 }
 
-IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout)
+IceInternal::ThreadPool::ThreadPool(
+    const InstancePtr& instance,
+    const string& prefix,
+    int timeout,
+    function<void(function<void()>, const Ice::ConnectionPtr&)> executor,
+    int reactorIndex,
+    ThreadPool* parent)
     : _instance(instance),
-      _executor(_instance->initializationData().executor),
+      _reactorIndex(reactorIndex),
+      _parent(parent),
+      _idle(false),
+      _nextReactor(0),
+      _executor(std::move(executor)),
       _destroyed(false),
       _prefix(prefix),
       _selector(instance),
@@ -252,6 +272,56 @@ IceInternal::ThreadPool::initialize()
 
 #ifdef ICE_USE_IOCP
     _selector.setup(_sizeIO);
+#else
+    int reactors = _reactorIndex < 0 ? properties->getPropertyAsIntWithDefault(_prefix + ".Reactors", 1) : 1;
+    if (reactors < 1)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".Reactors < 1; Reactors adjusted to 1";
+        reactors = 1;
+    }
+
+    if (reactors > 1)
+    {
+        //
+        // Each reactor is a thread pool configured with the properties of this thread pool. The reactors wait with
+        // the server idle time and shut down the object adapters once all of them are idle.
+        //
+        if (_instance->traceLevels()->threadPool >= 1)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+            out << "creating " << _prefix << ": Reactors = " << reactors;
+        }
+
+        try
+        {
+            for (int i = 0; i < reactors; ++i)
+            {
+                auto reactor =
+                    shared_ptr<ThreadPool>(new ThreadPool(_instance, _prefix, _serverIdleTime, _executor, i, this));
+                reactor->initialize();
+                _reactors.push_back(std::move(reactor));
+            }
+        }
+        catch (const Ice::Exception&)
+        {
+            for (const auto& reactor : _reactors)
+            {
+                reactor->destroy();
+                reactor->joinWithAllThreads();
+            }
+            _reactors.clear();
+            throw;
+        }
+        return;
+    }
+#endif
+
+#if defined(ICE_USE_IO_URING)
+    if (properties->getPropertyAsInt(_prefix + ".IoUring") > 0)
+    {
+        _selector.setupIoUring();
+    }
 #endif
 
 #if defined(__APPLE__)
@@ -286,8 +356,12 @@ IceInternal::ThreadPool::initialize()
     if (_instance->traceLevels()->threadPool >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
-        out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax
-            << ", SizeWarn = " << _sizeWarn;
+        out << "creating " << _prefix;
+        if (_reactorIndex >= 0)
+        {
+            out << " reactor " << _reactorIndex;
+        }
+        out << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = " << _sizeWarn;
     }
 
     try
@@ -323,12 +397,27 @@ IceInternal::ThreadPool::destroy()
         return;
     }
     _destroyed = true;
-    _workQueue->destroy();
+    if (_reactors.empty())
+    {
+        _workQueue->destroy();
+    }
+    else
+    {
+        for (const auto& reactor : _reactors)
+        {
+            reactor->destroy();
+        }
+    }
 }
 
 void
 IceInternal::ThreadPool::updateObservers()
 {
+    for (const auto& reactor : _reactors)
+    {
+        reactor->updateObservers();
+    }
+
     lock_guard lock(_mutex);
     for (auto& p : _threads)
     {
@@ -339,6 +428,15 @@ IceInternal::ThreadPool::updateObservers()
 void
 IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 {
+    if (!_reactors.empty())
+    {
+        // Pin the handler to the next reactor. The reactor handles all the subsequent updates for this handler.
+        const ThreadPoolPtr& reactor = _reactors[_nextReactor++ % _reactors.size()];
+        handler->_reactor = reactor.get();
+        reactor->initialize(handler);
+        return;
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
     _selector.initialize(handler.get());
@@ -364,6 +462,12 @@ IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 void
 IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation remove, SocketOperation add)
 {
+    if (handler->_reactor && handler->_reactor != this)
+    {
+        handler->_reactor->update(handler, remove, add);
+        return;
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
 
@@ -384,6 +488,11 @@ IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation
 bool
 IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 {
+    if (handler->_reactor && handler->_reactor != this)
+    {
+        return handler->_reactor->finish(handler, closeNow);
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
 #if !defined(ICE_USE_IOCP)
@@ -434,6 +543,12 @@ IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 void
 IceInternal::ThreadPool::ready(const EventHandlerPtr& handler, SocketOperation op, bool value)
 {
+    if (handler->_reactor && handler->_reactor != this)
+    {
+        handler->_reactor->ready(handler, op, value);
+        return;
+    }
+
     lock_guard lock(_mutex);
     if (_destroyed)
     {
@@ -475,8 +590,28 @@ IceInternal::ThreadPool::executeFromThisThread(function<void()> call, const Ice:
 }
 
 void
-IceInternal::ThreadPool::execute(function<void()> call, const Ice::ConnectionPtr& connection)
+IceInternal::ThreadPool::execute(
+    function<void()> call,
+    const Ice::ConnectionPtr& connection,
+    const EventHandler* handler)
 {
+    if (!_reactors.empty())
+    {
+        if (handler)
+        {
+            for (const auto& reactor : _reactors)
+            {
+                if (reactor.get() == handler->_reactor)
+                {
+                    reactor->execute(std::move(call), connection);
+                    return;
+                }
+            }
+        }
+        _reactors[_nextReactor++ % _reactors.size()]->execute(std::move(call), connection);
+        return;
+    }
+
     lock_guard lock(_mutex);
     if (_destroyed)
     {
@@ -506,6 +641,10 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->join();
     }
+    for (const auto& reactor : _reactors)
+    {
+        reactor->joinWithAllThreads();
+    }
     _selector.destroy();
 }
 
@@ -553,14 +692,23 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             try
             {
                 _selector.select(_serverIdleTime);
+                if (_parent && _idle.load(memory_order_relaxed))
+                {
+                    _idle.store(false, memory_order_relaxed);
+                }
             }
             catch (const SelectorTimeoutException&)
             {
                 lock_guard lock(_mutex);
                 if (!_destroyed && _inUse == 0)
                 {
-                    _workQueue->queue([instance = _instance](ThreadPoolCurrent& shutdownCurrent)
-                                      { shutdown(shutdownCurrent, instance); });
+                    // A reactor only shuts down the object adapters when the other reactors are idle as well.
+                    _idle.store(true, memory_order_relaxed);
+                    if (!_parent || _parent->reactorsIdle())
+                    {
+                        _workQueue->queue([instance = _instance](ThreadPoolCurrent& shutdownCurrent)
+                                          { shutdown(shutdownCurrent, instance); });
+                    }
                 }
                 continue;
             }
@@ -575,6 +723,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                     _selector.finishSelect(_handlers);
                     _nextHandler = _handlers.begin();
                     select = false;
+                    thread->setQueueDepth(static_cast<int>(_handlers.size()));
                 }
                 else if (!current._leader && followerWait(current, lock))
                 {
@@ -1010,7 +1159,12 @@ string
 IceInternal::ThreadPool::nextThreadId()
 {
     ostringstream os;
-    os << _prefix << "-" << _nextThreadId++;
+    os << _prefix << "-";
+    if (_reactorIndex >= 0)
+    {
+        os << _reactorIndex << "-";
+    }
+    os << _nextThreadId++;
     return os.str();
 }
 
@@ -1035,10 +1189,20 @@ IceInternal::ThreadPool::shutdown(const ThreadPoolCurrent& current, const Instan
     }
 }
 
+bool
+IceInternal::ThreadPool::reactorsIdle() const noexcept
+{
+    return all_of(
+        _reactors.begin(),
+        _reactors.end(),
+        [](const ThreadPoolPtr& reactor) { return reactor->_idle.load(memory_order_relaxed); });
+}
+
 IceInternal::ThreadPool::EventHandlerThread::EventHandlerThread(const ThreadPoolPtr& pool, const string& name)
     : _name(name),
       _pool(pool),
-      _state(ThreadState::ThreadStateIdle)
+      _state(ThreadState::ThreadStateIdle),
+      _queueDepth(-1)
 {
     updateObserver();
 }
@@ -1051,6 +1215,7 @@ IceInternal::ThreadPool::EventHandlerThread::updateObserver()
     if (obsv)
     {
         _observer.attach(obsv->getThreadObserver(_pool->_prefix, _name, _state, _observer.get()));
+        _queueDepth = -1; // Report the queue depth to the new observer.
     }
 }
 
@@ -1068,6 +1233,17 @@ IceInternal::ThreadPool::EventHandlerThread::setState(Ice::Instrumentation::Thre
     _state = s;
 }
 
+void
+IceInternal::ThreadPool::EventHandlerThread::setQueueDepth(int depth)
+{
+    // Must be called with the thread pool mutex locked
+    if (_observer && depth != _queueDepth)
+    {
+        _queueDepth = depth;
+        _observer->queueDepth(depth);
+    }
+}
+
 void
 IceInternal::ThreadPool::EventHandlerThread::start()
 {
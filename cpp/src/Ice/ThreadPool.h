@@ -15,9 +15,11 @@
 #include "Selector.h"
 #include "ThreadPoolF.h"
 
+#include <atomic>
 #include <list>
 #include <set>
 #include <thread>
+#include <vector>
 
 namespace IceInternal
 {
@@ -39,17 +41,24 @@ namespace IceInternal
 
             void updateObserver();
             void setState(Ice::Instrumentation::ThreadState);
+            void setQueueDepth(int);
 
         private:
             std::string _name;
             ThreadPoolPtr _pool;
             ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
             Ice::Instrumentation::ThreadState _state;
+            int _queueDepth; // The last queue depth reported to the observer, or -1.
             std::thread _thread;
         };
         using EventHandlerThreadPtr = std::shared_ptr<EventHandlerThread>;
 
-        static ThreadPoolPtr create(const InstancePtr&, const std::string&, int);
+        // The executor, if set, replaces the executor of the communicator's InitializationData for this thread pool.
+        static ThreadPoolPtr create(
+            const InstancePtr&,
+            const std::string&,
+            int,
+            std::function<void(std::function<void()>, const Ice::ConnectionPtr&)> = nullptr);
 
         virtual ~ThreadPool();
 
@@ -71,14 +80,25 @@ namespace IceInternal
         void ready(const EventHandlerPtr&, SocketOperation, bool);
 
         void executeFromThisThread(std::function<void()>, const Ice::ConnectionPtr&);
-        void execute(std::function<void()>, const Ice::ConnectionPtr&);
+
+        // Executes the call on a thread of this thread pool. With reactors, the call is executed on the reactor of the
+        // given event handler if it's pinned to one of our reactors, otherwise on the next reactor.
+        void execute(std::function<void()>, const Ice::ConnectionPtr&, const EventHandler* = nullptr);
 
         void joinWithAllThreads();
 
         std::string prefix() const;
 
+        bool hasExecutor() const noexcept { return _executor != nullptr; }
+
     private:
-        ThreadPool(const InstancePtr&, const std::string&, int);
+        ThreadPool(
+            const InstancePtr&,
+            const std::string&,
+            int,
+            std::function<void(std::function<void()>, const Ice::ConnectionPtr&)>,
+            int = -1,
+            ThreadPool* = nullptr);
         void initialize();
 
         void run(const EventHandlerThreadPtr&);
@@ -98,9 +118,27 @@ namespace IceInternal
         static void joinThread(const EventHandlerThreadPtr&);
         static void shutdown(const ThreadPoolCurrent&, const InstancePtr&);
 
+        bool reactorsIdle() const noexcept;
+
         const InstancePtr _instance;
 
-        std::function<void(std::function<void()>, const Ice::ConnectionPtr&)> _executor;
+        // The index of this reactor in its parent thread pool, or -1 if this thread pool isn't a reactor.
+        const int _reactorIndex;
+
+        // The parent thread pool of this reactor, or nullptr if this thread pool isn't a reactor.
+        ThreadPool* const _parent;
+
+        // True if the last select of this reactor timed out with the server idle time and no thread in use. The parent
+        // thread pool is idle when all its reactors are idle.
+        std::atomic<bool> _idle;
+
+        // The reactors of a thread pool configured with <prefix>.Reactors > 1. Each reactor is a thread pool with its
+        // own selector, mutex and threads. Event handlers are pinned to a reactor when they are initialized and this
+        // thread pool forwards their updates to it. Immutable once initialize() returns.
+        std::vector<ThreadPoolPtr> _reactors;
+        std::atomic<size_t> _nextReactor;
+
+        const std::function<void(std::function<void()>, const Ice::ConnectionPtr&)> _executor;
 
         ThreadPoolWorkQueuePtr _workQueue;
         bool _destroyed;
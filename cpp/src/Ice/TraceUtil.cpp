@@ -154,30 +154,43 @@ printHeader(ostream& s, InputStream& stream)
     stream.read(compress);
     s << "\ncompression status = " << static_cast<int>(compress) << ' ';
 
-    switch (compress)
+    if (type == validateConnectionMsg)
     {
-        case 0:
+        // The compression status of a validate connection message is the mask of the supported compression codecs.
+        s << "(supported compression codecs mask)";
+    }
+    else
+    {
+        switch (compress)
         {
-            s << "(not compressed; do not compress response, if any)";
-            break;
-        }
+            case 0:
+            {
+                s << "(not compressed; do not compress response, if any)";
+                break;
+            }
 
-        case 1:
-        {
-            s << "(not compressed; compress response, if any)";
-            break;
-        }
+            case 1:
+            {
+                s << "(not compressed; compress response, if any)";
+                break;
+            }
 
-        case 2:
-        {
-            s << "(compressed; compress response, if any)";
-            break;
-        }
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            {
+                s << "(compressed with codec " << static_cast<int>(compress) << "; compress response, if any)";
+                break;
+            }
 
-        default:
-        {
-            s << "(unknown)";
-            break;
+            default:
+            {
+                s << "(unknown)";
+                break;
+            }
         }
     }
 
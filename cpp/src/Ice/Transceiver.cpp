@@ -3,6 +3,7 @@
 //
 
 #include "Transceiver.h"
+#include "Ice/Buffer.h"
 
 using namespace std;
 using namespace Ice;
@@ -14,3 +15,10 @@ IceInternal::Transceiver::bind()
     assert(false);
     return nullptr;
 }
+
+SocketOperation
+IceInternal::Transceiver::writeGather(const vector<Buffer*>& bufs)
+{
+    assert(!bufs.empty());
+    return write(*bufs.front());
+}
@@ -10,6 +10,8 @@
 #include "Network.h"
 #include "TransceiverF.h"
 
+#include <vector>
+
 namespace IceInternal
 {
     class Buffer;
@@ -27,6 +29,19 @@ namespace IceInternal
         virtual SocketOperation write(Buffer&) = 0;
         virtual SocketOperation read(Buffer&) = 0;
 
+        /// Writes the given buffers in order, with a single gather write (writev) if the transport supports it. The
+        /// iterator of each buffer is advanced past the bytes written from this buffer.
+        /// @param bufs The buffers to write. Only the last buffer written to can be partially written.
+        /// @return SocketOperationWrite if the transport can't accept more data without blocking, SocketOperationNone
+        /// otherwise. With SocketOperationNone, the caller can call writeGather again with the remaining buffers.
+        /// @remark The default implementation writes the first buffer with write. It preserves the framing of
+        /// transports that frame each buffer (ws, ssl) or send each buffer as a separate packet (udp).
+        virtual SocketOperation writeGather(const std::vector<Buffer*>& bufs);
+
+        /// Checks if writeGather writes several buffers with a single write.
+        /// @return true if writeGather writes several buffers at once, false if it only writes the first buffer.
+        virtual bool hasGatherWrites() const noexcept { return false; }
+
 #if defined(ICE_USE_IOCP)
         virtual bool startWrite(Buffer&) = 0;
         virtual void finishWrite(Buffer&) = 0;
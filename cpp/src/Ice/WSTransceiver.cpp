@@ -830,6 +830,7 @@ IceInternal::WSTransceiver::WSTransceiver(
       _readOpCode(0),
       _readHeaderLength(0),
       _readPayloadLength(0),
+      _readFrameOffset(0),
       _writeState(WriteStateHeader),
       _writeBufferSize(16 * 1024),
       _readPending(false),
@@ -858,6 +859,7 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
       _readOpCode(0),
       _readHeaderLength(0),
       _readPayloadLength(0),
+      _readFrameOffset(0),
       _writeState(WriteStateHeader),
       _writeBufferSize(1024),
       _readPending(false),
@@ -1245,7 +1247,7 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                     }
                     _readState = ReadStatePayload;
                     assert(buf.i != buf.b.end());
-                    _readFrameStart = buf.i;
+                    _readFrameOffset = 0;
                     break;
                 }
                 case OP_CLOSE: // Connection close
@@ -1402,11 +1404,12 @@ IceInternal::WSTransceiver::postRead(Buffer& buf)
         // Unmask the data we just read.
         //
         IceInternal::Buffer::Container::iterator p = _readStart;
-        for (size_t n = static_cast<size_t>(_readStart - _readFrameStart); p < buf.i; ++p, ++n)
+        for (size_t n = _readFrameOffset; p < buf.i; ++p, ++n)
         {
             *p ^= _readMask[n % 4];
         }
     }
+    _readFrameOffset += static_cast<size_t>(buf.i - _readStart);
 
     _readPayloadLength -= static_cast<size_t>(buf.i - _readStart);
     _readStart = buf.i;
@@ -110,7 +110,9 @@ namespace IceInternal
         size_t _readHeaderLength;
         size_t _readPayloadLength;
         Buffer::Container::iterator _readStart;
-        Buffer::Container::iterator _readFrameStart;
+        // The number of payload bytes of the current frame already read. The caller might read the payload of a frame
+        // in different buffers, for example when the Ice message header is read in a separate buffer.
+        size_t _readFrameOffset;
         std::byte _readMask[4];
 
         enum WriteState
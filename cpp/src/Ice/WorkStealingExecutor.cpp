@@ -0,0 +1,302 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "WorkStealingExecutor.h"
+#include "Ice/LoggerUtil.h"
+#include "Ice/Properties.h"
+#include "Instance.h"
+#include "TraceLevels.h"
+
+#include <cassert>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    // The executor and the index of the worker running in this thread, if any.
+    thread_local const WorkStealingExecutor* currentExecutor = nullptr;
+    thread_local size_t currentWorker = 0;
+}
+
+IceInternal::WorkStealingExecutor::WorkStealingExecutor(
+    const InstancePtr& instance,
+    string prefix,
+    int size,
+    bool serialize)
+    : _instance(instance),
+      _prefix(std::move(prefix)),
+      _serialize(serialize),
+      _next(0),
+      _pending(0),
+      _idle(0),
+      _destroyed(false)
+{
+    if (size < 1)
+    {
+        size = static_cast<int>(max(thread::hardware_concurrency(), 1u));
+    }
+
+    if (_instance->traceLevels()->threadPool >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+        out << "creating " << _prefix << ": Size = " << size << ", Serialize = " << (_serialize ? "1" : "0");
+    }
+
+    for (int i = 0; i < size; ++i)
+    {
+        _queues.push_back(make_unique<WorkerQueue>());
+    }
+
+    _threads.reserve(_queues.size());
+    try
+    {
+        for (size_t i = 0; i < _queues.size(); ++i)
+        {
+            _threads.emplace_back([this, i] { run(i); });
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        {
+            Error out(_instance->initializationData().logger);
+            out << "cannot create thread for `" << _prefix << "':\n" << ex;
+        }
+        destroy();
+        throw;
+    }
+}
+
+IceInternal::WorkStealingExecutor::~WorkStealingExecutor() { assert(_threads.empty()); }
+
+void
+IceInternal::WorkStealingExecutor::execute(function<void()> call, const ConnectionPtr& connection)
+{
+    if (_destroyed)
+    {
+        invoke(call);
+        return;
+    }
+
+    if (_serialize && connection)
+    {
+        {
+            lock_guard lock(_strandsMutex);
+            auto& strand = _strands[connection.get()];
+            strand.push_back(std::move(call));
+            if (strand.size() > 1)
+            {
+                return; // The strand is already scheduled.
+            }
+        }
+        push([this, key = connection.get()] { runStrand(key); });
+    }
+    else
+    {
+        push(std::move(call));
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::destroy()
+{
+    {
+        lock_guard lock(_mutex);
+        if (_destroyed)
+        {
+            return;
+        }
+        _destroyed = true;
+        _conditionVariable.notify_all();
+    }
+
+    // The workers drain the deques before returning.
+    for (auto& thread : _threads)
+    {
+        thread.join();
+    }
+    _threads.clear();
+
+    // Run the calls pushed while the last workers were returning.
+    function<void()> call;
+    while (pop(0, call))
+    {
+        invoke(call);
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::run(size_t index)
+{
+    currentExecutor = this;
+    currentWorker = index;
+
+    if (_instance->initializationData().threadStart)
+    {
+        try
+        {
+            _instance->initializationData().threadStart();
+        }
+        catch (const std::exception& ex)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "thread hook start() method raised an unexpected exception in `" << _prefix << "':\n" << ex;
+        }
+        catch (...)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "thread hook start() method raised an unexpected exception in `" << _prefix << "'";
+        }
+    }
+
+    while (true)
+    {
+        function<void()> call;
+        if (pop(index, call))
+        {
+            invoke(call);
+            continue;
+        }
+
+        unique_lock lock(_mutex);
+        if (_pending > 0)
+        {
+            continue; // A call was pushed or a deque was busy, try again.
+        }
+        else if (_destroyed)
+        {
+            break;
+        }
+
+        // push() increments _pending before checking _idle, so either push() sees this worker as idle and notifies
+        // it, or this worker sees the new call in the wait predicate.
+        ++_idle;
+        _conditionVariable.wait(lock, [this] { return _pending > 0 || _destroyed; });
+        --_idle;
+    }
+
+    if (_instance->initializationData().threadStop)
+    {
+        try
+        {
+            _instance->initializationData().threadStop();
+        }
+        catch (const std::exception& ex)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << _prefix << "':\n" << ex;
+        }
+        catch (...)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << _prefix << "'";
+        }
+    }
+
+    currentExecutor = nullptr;
+}
+
+void
+IceInternal::WorkStealingExecutor::push(function<void()> call)
+{
+    // A worker pushes to its own deque to keep the follow-up calls of a dispatch on the same thread, other threads
+    // spread their calls over the deques.
+    size_t index = currentExecutor == this ? currentWorker : _next++ % _queues.size();
+    {
+        WorkerQueue& queue = *_queues[index];
+        lock_guard lock(queue.mutex);
+        queue.calls.push_back(std::move(call));
+    }
+
+    ++_pending;
+    if (_idle > 0)
+    {
+        lock_guard lock(_mutex);
+        _conditionVariable.notify_one();
+    }
+}
+
+bool
+IceInternal::WorkStealingExecutor::pop(size_t index, function<void()>& call)
+{
+    // Take the oldest call of the worker's own deque, or else steal the oldest call of another deque. Busy deques are
+    // skipped when stealing, the caller retries as long as _pending is positive.
+    for (size_t i = 0; i < _queues.size(); ++i)
+    {
+        WorkerQueue& queue = *_queues[(index + i) % _queues.size()];
+        unique_lock lock(queue.mutex, defer_lock);
+        if (i == 0)
+        {
+            lock.lock();
+        }
+        else if (!lock.try_lock())
+        {
+            continue;
+        }
+
+        if (!queue.calls.empty())
+        {
+            call = std::move(queue.calls.front());
+            queue.calls.pop_front();
+            --_pending;
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+IceInternal::WorkStealingExecutor::runStrand(const Connection* key)
+{
+    function<void()> call;
+    {
+        lock_guard lock(_strandsMutex);
+        auto p = _strands.find(key);
+        assert(p != _strands.end() && !p->second.empty());
+        call = std::move(p->second.front());
+    }
+
+    invoke(call);
+
+    lock_guard lock(_strandsMutex);
+    auto p = _strands.find(key);
+    assert(p != _strands.end());
+    p->second.pop_front();
+    if (p->second.empty())
+    {
+        _strands.erase(p);
+    }
+    else
+    {
+        // Reschedule the strand rather than running its next call here, to give a chance to the calls of other
+        // connections.
+        push([this, key] { runStrand(key); });
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::invoke(const function<void()>& call) noexcept
+{
+    try
+    {
+        call();
+    }
+    catch (const std::exception& ex)
+    {
+        if (_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Dispatch") > 1)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "dispatch exception:\n" << ex;
+        }
+    }
+    catch (...)
+    {
+        if (_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Dispatch") > 1)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "dispatch exception:\nunknown c++ exception";
+        }
+    }
+}
@@ -0,0 +1,79 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_WORK_STEALING_EXECUTOR_H
+#define ICE_WORK_STEALING_EXECUTOR_H
+
+#include "Ice/ConnectionF.h"
+#include "Ice/InstanceF.h"
+#include "WorkStealingExecutorF.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace IceInternal
+{
+    // The dispatch executor of an object adapter configured with <adapter>.Dispatch.Executor=WorkStealing. The I/O
+    // threads of the adapter's thread pool hand off each dispatch to this executor: the call is pushed to the deque
+    // of one of the workers and idle workers steal calls from the deques of busy workers. When the adapter's thread
+    // pool is configured with Serialize, the calls of a given connection are queued on a strand and never run
+    // concurrently or out of order.
+    class WorkStealingExecutor final
+    {
+    public:
+        WorkStealingExecutor(const InstancePtr&, std::string, int, bool);
+        ~WorkStealingExecutor();
+
+        WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+        WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+        void execute(std::function<void()>, const Ice::ConnectionPtr&);
+
+        // Waits for the queued calls to complete and joins with the workers. Calls executed afterwards run in the
+        // calling thread.
+        void destroy();
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>> calls;
+        };
+
+        void run(std::size_t);
+        void push(std::function<void()>);
+        bool pop(std::size_t, std::function<void()>&);
+        void runStrand(const Ice::Connection*);
+        void invoke(const std::function<void()>&) noexcept;
+
+        const InstancePtr _instance;
+        const std::string _prefix;
+        const bool _serialize;
+
+        std::vector<std::unique_ptr<WorkerQueue>> _queues; // One deque per worker, immutable after construction.
+        std::vector<std::thread> _threads;
+        std::atomic<std::size_t> _next;     // The next deque used by threads other than the workers.
+        std::atomic<std::int64_t> _pending; // The number of calls queued in the deques.
+        std::atomic<int> _idle;             // The number of workers waiting on _conditionVariable.
+        std::atomic<bool> _destroyed;
+        std::mutex _mutex;
+        std::condition_variable _conditionVariable;
+
+        // The calls of each connection with a queued or running call, when _serialize is true. The first call of
+        // each strand is the call being run or about to be run by a worker.
+        std::unordered_map<const Ice::Connection*, std::deque<std::function<void()>>> _strands;
+        std::mutex _strandsMutex;
+    };
+}
+
+#endif
@@ -0,0 +1,16 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_WORK_STEALING_EXECUTOR_F_H
+#define ICE_WORK_STEALING_EXECUTOR_F_H
+
+#include <memory>
+
+namespace IceInternal
+{
+    class WorkStealingExecutor;
+    using WorkStealingExecutorPtr = std::shared_ptr<WorkStealingExecutor>;
+}
+
+#endif
@@ -12,6 +12,8 @@
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <map>
+#include <set>
 #include <string.h>
 
 using namespace std;
@@ -71,6 +73,49 @@ namespace
         }
     }
 
+    // Returns true if the in-memory representation of the mapped type may be identical to its encoding. bool is
+    // excluded since not all byte values are valid bools.
+    bool isBitwiseStreamableType(const TypePtr& type)
+    {
+        BuiltinPtr bp = dynamic_pointer_cast<Builtin>(type);
+        if (bp)
+        {
+            switch (bp->kind())
+            {
+                case Builtin::KindByte:
+                case Builtin::KindShort:
+                case Builtin::KindInt:
+                case Builtin::KindLong:
+                case Builtin::KindFloat:
+                case Builtin::KindDouble:
+                {
+                    return true;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            StructPtr s = dynamic_pointer_cast<Struct>(type);
+            if (s)
+            {
+                DataMemberList members = s->dataMembers();
+                for (DataMemberList::const_iterator i = members.begin(); i != members.end(); ++i)
+                {
+                    if ((*i)->optional() || !isBitwiseStreamableType((*i)->type()))
+                    {
+                        return false;
+                    }
+                }
+                return !members.empty();
+            }
+            return false;
+        }
+    }
+
     string getDeprecatedSymbol(const ContainedPtr& p1)
     {
         string deprecatedSymbol;
@@ -592,6 +637,96 @@ namespace
         out << "::std::function<void" << spar << createOutgoingAsyncParams(p, "", typeContext) << epar << ">";
         return os.str();
     }
+
+    void writeOperationDispatch(Output& C, const string& opName)
+    {
+        C << nl << "if (current.operation == \"" << opName << "\")";
+        C << sb;
+        C << nl << "_iceD_" << opName << "(request, ::std::move(sendResponse));";
+        C << nl << "return;";
+        C << eb;
+    }
+
+    // Writes a switch over the character that best tells apart the given operations, which have the same length.
+    // The operations that share this character are told apart by a nested switch over another character, until each
+    // case of the innermost switch holds a single operation.
+    void writeOperationCharSwitch(Output& C, const vector<string>& names)
+    {
+        assert(names.size() > 1);
+
+        size_t position = 0;
+        size_t maxDistinctChars = 0;
+        for (size_t i = 0; i < names.front().size(); ++i)
+        {
+            set<char> chars;
+            for (const auto& name : names)
+            {
+                chars.insert(name[i]);
+            }
+            if (chars.size() > maxDistinctChars)
+            {
+                position = i;
+                maxDistinctChars = chars.size();
+            }
+        }
+        // The names are distinct and have the same length, at least one character tells them apart.
+        assert(maxDistinctChars > 1);
+
+        map<char, vector<string>> opNamesByChar;
+        for (const auto& name : names)
+        {
+            opNamesByChar[name[position]].push_back(name);
+        }
+
+        C << nl << "switch (current.operation[" << position << "])";
+        C << sb;
+        for (const auto& [c, sameCharNames] : opNamesByChar)
+        {
+            C << nl << "case '" << c << "':";
+            C << sb;
+            if (sameCharNames.size() == 1)
+            {
+                writeOperationDispatch(C, sameCharNames.front());
+            }
+            else
+            {
+                writeOperationCharSwitch(C, sameCharNames);
+            }
+            C << nl << "break;";
+            C << eb;
+        }
+        C << eb;
+    }
+
+    // Writes a switch over the length of the operation name and, when several operations have the same length, over
+    // the characters that tell these operations apart. A request is then dispatched after a single string comparison.
+    void writeOperationSwitch(Output& C, const StringList& opNames)
+    {
+        map<size_t, vector<string>> opNamesByLength;
+        for (const auto& opName : opNames)
+        {
+            opNamesByLength[opName.size()].push_back(opName);
+        }
+
+        C << nl << "switch (current.operation.size())";
+        C << sb;
+        for (const auto& [length, names] : opNamesByLength)
+        {
+            C << nl << "case " << length << ":";
+            C << sb;
+            if (names.size() == 1)
+            {
+                writeOperationDispatch(C, names.front());
+            }
+            else
+            {
+                writeOperationCharSwitch(C, names);
+            }
+            C << nl << "break;";
+            C << eb;
+        }
+        C << eb;
+    }
 }
 
 Slice::Gen::Gen(
@@ -1119,7 +1254,7 @@ Slice::Gen::MetaDataVisitor::validate(
             continue;
         }
 
-        if (operation && s == "cpp:const")
+        if (operation && (s == "cpp:const" || s == "cpp:coroutine"))
         {
             continue;
         }
@@ -1634,6 +1769,7 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     vector<string> inParamsDecl;
     vector<string> inParamsImplDecl;
     vector<string> inParamsImpl;
+    vector<string> inParamsNames;
 
     vector<string> futureOutParams = createOutgoingAsyncParams(p, interfaceScope, _useWstring);
     vector<string> lambdaOutParams =
@@ -1669,6 +1805,7 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
             inParamsDecl.push_back(typeString + ' ' + paramName);
             inParamsImplDecl.push_back(typeString + ' ' + paramPrefix + q->name());
             inParamsImpl.push_back(paramPrefix + q->name());
+            inParamsNames.push_back(paramName);
         }
     }
 
@@ -1771,6 +1908,31 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     C << "context" << epar << ";";
     C << eb;
 
+    //
+    // Coroutine based asynchronous operation, only available when the generated header is compiled with C++20.
+    // It's implemented inline as the generated source file isn't necessarily compiled with C++20.
+    //
+    H << sp;
+    H.zeroIndent();
+    H << nl << "#ifdef ICE_HAS_COROUTINES";
+    H.restoreIndent();
+    if (comment)
+    {
+        StringList postParams, returns;
+        postParams.push_back(contextDoc);
+        returns.push_back("The task for the invocation, to await with co_await.");
+        writeOpDocSummary(H, p, comment, OpDocInParams, false, StringList(), postParams, returns);
+    }
+    H << nl << deprecatedSymbol << "::Ice::Task<" << futureT << "> " << name << "Async" << spar << inParamsDecl
+      << "::Ice::UseTask" << contextDecl << epar << " const";
+    H << sb;
+    H << nl << "return ::IceInternal::makeTaskOutgoing<" << futureT << ">" << spar << "this"
+      << "&" + interface->name() + "Prx::_iceI_" + name << inParamsNames << contextParam << epar << ";";
+    H << eb;
+    H.zeroIndent();
+    H << nl << "#endif";
+    H.restoreIndent();
+
     //
     // Lambda based asynchronous operation
     //
@@ -2842,49 +3004,12 @@ Slice::Gen::InterfaceVisitor::visitInterfaceDefEnd(const InterfaceDefPtr& p)
              "sendResponse)";
         C << sb;
 
-        C << sp;
-        C << nl << "static constexpr ::std::string_view allOperations[] = ";
-        C.spar('{');
-        for (const auto& opName : allOpNames)
-        {
-            C << '"' + opName + '"';
-        }
-        C.epar('}');
-        C << ";";
-
-        C << sp;
         C << nl << "const ::Ice::Current& current = request.current();";
-        C << nl << "::std::pair<const ::std::string_view*, const ::std::string_view*> r = "
-          << "::std::equal_range(allOperations, allOperations"
-          << " + " << allOpNames.size() << ", current.operation);";
-        C << nl << "if(r.first == r.second)";
-        C << sb;
-        C << nl
-          << "sendResponse(::Ice::makeOutgoingResponse(::std::make_exception_ptr(::Ice::OperationNotExistException(__"
-             "FILE__, __LINE__)), current));";
-        C << nl << "return;";
-        C << eb;
-        C << sp;
-        C << nl << "switch(r.first - allOperations)";
-        C << sb;
-        int i = 0;
-        for (StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
-        {
-            C << nl << "case " << i++ << ':';
-            C << sb;
-            C << nl << "_iceD_" << *q << "(request, ::std::move(sendResponse));";
-            C << nl << "break;";
-            C << eb;
-        }
-        C << nl << "default:";
-        C << sb;
-        C << nl << "assert(false);";
+        writeOperationSwitch(C, allOpNames);
         C << nl
           << "sendResponse(::Ice::makeOutgoingResponse(::std::make_exception_ptr(::Ice::OperationNotExistException(__"
              "FILE__, __LINE__)), current));";
         C << eb;
-        C << eb;
-        C << eb;
         C << nl << "/// \\endcond";
     }
 
@@ -2918,7 +3043,13 @@ Slice::Gen::InterfaceVisitor::visitOperation(const OperationPtr& p)
     ParamDeclList outParams = p->outParameters();
     ParamDeclList paramList = p->parameters();
 
-    const bool amd = (interface->hasMetaData("amd") || p->hasMetaData("amd"));
+    // A coroutine operation is an AMD operation that returns an Ice::Task instead of taking response callbacks.
+    const bool coroutine = (interface->hasMetaData("cpp:coroutine") || p->hasMetaData("cpp:coroutine"));
+    const bool amd = (coroutine || interface->hasMetaData("amd") || p->hasMetaData("amd"));
+
+    // The in-parameters of a coroutine can't refer to the request input stream, the coroutine can outlive it.
+    const TypeContext inParamTypeContext =
+        coroutine ? _useWstring : _useWstring | TypeContext::UnmarshalParamZeroCopy;
 
     const string returnValueParam = escapeParam(outParams, "returnValue");
     const string responsecbParam = escapeParam(inParams, "response");
@@ -2938,7 +3069,15 @@ Slice::Gen::InterfaceVisitor::visitOperation(const OperationPtr& p)
     }
 
     string retS;
-    if (amd || !ret)
+    if (coroutine)
+    {
+        retS = "::Ice::Task<" +
+               (p->hasMarshaledResult()
+                    ? marshaledResultStructName(name)
+                    : createOutgoingAsyncTypeParam(createOutgoingAsyncParams(p, interfaceScope, _useWstring))) +
+               ">";
+    }
+    else if (amd || !ret)
     {
         retS = "void";
     }
@@ -2960,12 +3099,7 @@ Slice::Gen::InterfaceVisitor::visitOperation(const OperationPtr& p)
         if (!isOutParam)
         {
             params.push_back(
-                typeToString(
-                    type,
-                    param->optional(),
-                    interfaceScope,
-                    param->getMetaData(),
-                    _useWstring | TypeContext::UnmarshalParamZeroCopy) +
+                typeToString(type, param->optional(), interfaceScope, param->getMetaData(), inParamTypeContext) +
                 " " + paramName);
             args.push_back(condMove(isMovable(type), paramPrefix + param->name()));
         }
@@ -2986,7 +3120,35 @@ Slice::Gen::InterfaceVisitor::visitOperation(const OperationPtr& p)
             responseParamsImplDecl.push_back(responseTypeS + " " + paramPrefix + param->name());
         }
     }
-    if (amd)
+    // The callbacks passed to Task::then by the dispatch of a coroutine operation.
+    string taskResponseArg;
+    string taskExceptionArg;
+    if (coroutine)
+    {
+        if (p->hasMarshaledResult())
+        {
+            taskResponseArg = "[responseHandler](" + marshaledResultStructName(name) +
+                              " marshaledResult) { responseHandler->sendResponse(::std::move(marshaledResult)); }";
+        }
+        else if ((ret && !outParams.empty()) || outParams.size() > 1)
+        {
+            taskResponseArg = "[responseCb = ::std::move(responseCb)](" +
+                              createOutgoingAsyncTypeParam(createOutgoingAsyncParams(p, interfaceScope, _useWstring)) +
+                              "&& result) { ::std::apply(responseCb, ::std::move(result)); }";
+        }
+        else if (ret || !outParams.empty())
+        {
+            taskResponseArg = "::std::move(responseCb)";
+        }
+        else
+        {
+            taskResponseArg = "[responseHandler] { responseHandler->sendEmptyResponse(); }";
+        }
+        taskExceptionArg = "[responseHandler](std::exception_ptr ex) { responseHandler->sendException(ex); }";
+        params.push_back(currentDecl);
+        args.push_back("responseHandler->current()");
+    }
+    else if (amd)
     {
         if (p->hasMarshaledResult())
         {
@@ -3079,7 +3241,11 @@ Slice::Gen::InterfaceVisitor::visitOperation(const OperationPtr& p)
     {
         OpDocParamType pt = (amd || p->hasMarshaledResult()) ? OpDocInParams : OpDocAllParams;
         StringList postParams, returns;
-        if (amd)
+        if (coroutine)
+        {
+            returns.push_back("The task that completes with the result of the operation.");
+        }
+        else if (amd)
         {
             postParams.push_back("@param " + responsecbParam + " The response callback.");
             postParams.push_back("@param " + excbParam + " The exception callback.");
@@ -3116,7 +3282,7 @@ Slice::Gen::InterfaceVisitor::visitOperation(const OperationPtr& p)
     {
         C << nl << "auto istr = &request.inputStream();";
         C << nl << "istr->startEncapsulation();";
-        writeAllocateCode(C, inParams, nullptr, interfaceScope, _useWstring | TypeContext::UnmarshalParamZeroCopy);
+        writeAllocateCode(C, inParams, nullptr, interfaceScope, inParamTypeContext);
         writeUnmarshalCode(C, inParams, nullptr);
         if (p->sendsClasses())
         {
@@ -3212,7 +3378,18 @@ Slice::Gen::InterfaceVisitor::visitOperation(const OperationPtr& p)
         }
         C << nl << "try";
         C << sb;
-        C << nl << "this->" << opName << spar << args << epar << ';';
+        if (coroutine)
+        {
+            C << nl << "this->" << opName << spar << args << epar << ".then(";
+            C.inc();
+            C << nl << taskResponseArg << ",";
+            C << nl << taskExceptionArg << ");";
+            C.dec();
+        }
+        else
+        {
+            C << nl << "this->" << opName << spar << args << epar << ';';
+        }
         C << eb;
         C << nl << "catch (...)";
         C << sb;
@@ -3271,6 +3448,15 @@ Slice::Gen::StreamVisitor::visitStructStart(const StructPtr& p)
     H << nl << "static const bool fixedLength = " << (p->isVariableLength() ? "false" : "true") << ";";
     H << eb << ";" << nl;
 
+    if (isBitwiseStreamableType(p))
+    {
+        H << nl << "template<>";
+        H << nl << "struct IsBitwiseStreamable<" << scoped << "> : IsBitwiseStreamableStruct<" << scoped << ", "
+          << p->minWireSize() << ">";
+        H << sb;
+        H << eb << ";" << nl;
+    }
+
     writeStreamHelpers(H, p, p->dataMembers(), false);
 
     return false;
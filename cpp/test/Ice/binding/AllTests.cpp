@@ -498,6 +498,95 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing least loaded endpoint selection... " << flush;
+    {
+        vector<optional<RemoteObjectAdapterPrx>> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter37", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter38", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter39", "default"));
+
+        TestIntfPrx test = createTestIntfPrx(adapters);
+        test = test->ice_endpointSelection(Ice::EndpointSelectionType::LeastLoaded);
+        test(test->ice_getEndpointSelection() == Ice::EndpointSelectionType::LeastLoaded);
+        test(test->ice_isConnectionCached());
+
+        //
+        // The connection is selected for each invocation, so the requests are spread over all the endpoints
+        // without closing the connections.
+        //
+        set<string> names;
+        names.insert("Adapter37");
+        names.insert("Adapter38");
+        names.insert("Adapter39");
+        for (int i = 0; i < 100 && !names.empty(); ++i)
+        {
+            names.erase(test->getAdapterName());
+        }
+        test(names.empty());
+
+        //
+        // Invocations fail over to the remaining endpoints.
+        //
+        com->deactivateObjectAdapter(adapters[0]);
+        for (int i = 0; i < 10; ++i)
+        {
+            test(test->getAdapterName() != "Adapter37");
+        }
+        com->deactivateObjectAdapter(adapters[1]);
+        for (int i = 0; i < 10; ++i)
+        {
+            test(test->getAdapterName() == "Adapter39");
+        }
+
+        deactivate(com, adapters);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection pool... " << flush;
+    {
+        optional<RemoteObjectAdapterPrx> adapter = com->createObjectAdapter("Adapter40", "default");
+        TestIntfPrx test = adapter->getTestIntf()->ice_connectionPoolSize(3);
+        test(test->ice_getConnectionPoolSize() == 3);
+
+        //
+        // A connection is established for each request until the pool is full, the pooled connections are then
+        // shared.
+        //
+        set<Ice::ConnectionPtr> connections;
+        for (int i = 0; i < 10; ++i)
+        {
+            connections.insert(test->ice_getConnection());
+        }
+        test(test->getAdapterName() == "Adapter40");
+        test(connections.size() == 3);
+
+        //
+        // Closing a pooled connection gets it replaced by a new one.
+        //
+        test->ice_getConnection()->close(Ice::ConnectionClose::GracefullyWithWait);
+        for (int i = 0; i < 10; ++i)
+        {
+            connections.insert(test->ice_getConnection());
+        }
+        test(test->getAdapterName() == "Adapter40");
+        test(connections.size() == 4);
+
+        //
+        // A proxy without connection pool uses a single connection.
+        //
+        connections.clear();
+        test = test->ice_connectionPoolSize(1)->ice_connectionId("single");
+        for (int i = 0; i < 10; ++i)
+        {
+            connections.insert(test->ice_getConnection());
+        }
+        test(test->getAdapterName() == "Adapter40");
+        test(connections.size() == 1);
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
     cout << "testing per request binding with single endpoint... " << flush;
     {
         optional<RemoteObjectAdapterPrx> adapter = com->createObjectAdapter("Adapter41", "default");
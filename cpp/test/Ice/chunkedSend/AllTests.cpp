@@ -0,0 +1,239 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <atomic>
+#include <future>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+    class TestI final : public TestIntf
+    {
+    public:
+        void writeChunk(int64_t offset, pair<const byte*, const byte*> chunk, const Ice::Current&) final
+        {
+            for (const byte* p = chunk.first; p != chunk.second; ++p)
+            {
+                int64_t position = offset + (p - chunk.first);
+                if (*p != static_cast<byte>(position % 251))
+                {
+                    throw ChunkException{position};
+                }
+            }
+            _chunkedBytes += chunk.second - chunk.first;
+        }
+
+        int64_t takeChunkedBytes(const Ice::Current&) final { return _chunkedBytes.exchange(0); }
+
+    private:
+        atomic<int64_t> _chunkedBytes{0};
+    };
+
+    Ice::ByteSeq makePayload(size_t size)
+    {
+        Ice::ByteSeq payload(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            payload[i] = static_cast<byte>(i % 251);
+        }
+        return payload;
+    }
+
+    Ice::SendChunkFunction makeSendChunk(const TestIntfPrx& proxy)
+    {
+        return [proxy](
+                   int64_t offset,
+                   pair<const byte*, const byte*> chunk,
+                   function<void()> response,
+                   function<void(exception_ptr)> exception)
+        { proxy->writeChunkAsync(offset, chunk, std::move(response), std::move(exception)); };
+    }
+}
+
+void
+allTests(Test::TestHelper* helper)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", helper->getTestEndpoint());
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(make_shared<TestI>(), Ice::stringToIdentity("test"));
+    adapter->activate();
+
+    // The invocations are sent by a separate communicator, which uses a single client thread pool thread.
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    initData.properties->setProperty("Ice.ThreadPool.Client.Size", "1");
+    Ice::CommunicatorHolder client(initData);
+    TestIntfPrx proxy(client.communicator(), "test:" + helper->getTestEndpoint());
+
+    // The payload is larger than Ice.MessageSizeMax (1MB by default), it can only be sent in chunks.
+    const size_t size = 8 * 1024 * 1024;
+    const Ice::ByteSeq payload = makePayload(size);
+    const auto data = make_pair(payload.data(), payload.data() + payload.size());
+
+    cout << "testing chunked transfer... " << flush;
+    {
+        Ice::sendChunks(data, makeSendChunk(proxy));
+        test(proxy->takeChunkedBytes() == static_cast<int64_t>(size));
+
+        // A chunk size larger than the payload sends a single chunk.
+        Ice::sendChunks(make_pair(payload.data(), payload.data() + 1000), makeSendChunk(proxy), 1024 * 1024);
+        test(proxy->takeChunkedBytes() == 1000);
+
+        // An empty payload sends no chunks.
+        Ice::sendChunks(make_pair(payload.data(), payload.data()), makeSendChunk(proxy));
+        test(proxy->takeChunkedBytes() == 0);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing outstanding chunk invocations... " << flush;
+    {
+        for (int maxInFlight : {1, 4, 16})
+        {
+            mutex mutex;
+            int inFlight = 0;
+            int maxReached = 0;
+            int chunks = 0;
+            auto sendChunk = makeSendChunk(proxy);
+            Ice::sendChunks(
+                data,
+                [&](int64_t offset,
+                    pair<const byte*, const byte*> chunk,
+                    function<void()> response,
+                    function<void(exception_ptr)> exception)
+                {
+                    {
+                        lock_guard lock(mutex);
+                        maxReached = max(maxReached, ++inFlight);
+                        ++chunks;
+                    }
+                    auto completed = [&mutex, &inFlight]()
+                    {
+                        lock_guard lock(mutex);
+                        --inFlight;
+                    };
+                    sendChunk(
+                        offset,
+                        chunk,
+                        [completed, response = std::move(response)]()
+                        {
+                            completed();
+                            response();
+                        },
+                        [completed, exception = std::move(exception)](exception_ptr ex)
+                        {
+                            completed();
+                            exception(ex);
+                        });
+                },
+                64 * 1024,
+                maxInFlight);
+            test(maxReached <= maxInFlight);
+            test(chunks == static_cast<int>(size / (64 * 1024)));
+            test(inFlight == 0);
+            test(proxy->takeChunkedBytes() == static_cast<int64_t>(size));
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing chunked transfer failures... " << flush;
+    {
+        // The first failure is reported once the outstanding chunk invocations complete, and no chunks are sent
+        // after it.
+        auto sendChunk = makeSendChunk(proxy);
+        try
+        {
+            Ice::sendChunks(
+                data,
+                [&sendChunk](
+                    int64_t offset,
+                    pair<const byte*, const byte*> chunk,
+                    function<void()> response,
+                    function<void(exception_ptr)> exception)
+                {
+                    if (offset >= 1024 * 1024)
+                    {
+                        throw Ice::InvocationCanceledException(__FILE__, __LINE__);
+                    }
+                    sendChunk(offset, chunk, std::move(response), std::move(exception));
+                },
+                64 * 1024,
+                4);
+            test(false);
+        }
+        catch (const Ice::InvocationCanceledException&)
+        {
+        }
+        test(proxy->takeChunkedBytes() == 1024 * 1024);
+
+        // The exception raised by a chunk invocation is reported to the caller.
+        Ice::ByteSeq corrupted = payload;
+        corrupted[3 * 1024 * 1024 + 10] = byte{0xFF};
+        try
+        {
+            Ice::sendChunks(
+                make_pair(corrupted.data(), corrupted.data() + corrupted.size()),
+                sendChunk,
+                256 * 1024,
+                1);
+            test(false);
+        }
+        catch (const ChunkException& ex)
+        {
+            test(ex.offset == 3 * 1024 * 1024 + 10);
+        }
+        test(proxy->takeChunkedBytes() == 3 * 1024 * 1024);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing asynchronous chunked transfer from an Ice thread... " << flush;
+    {
+        // sendChunksAsync doesn't block the calling thread, it can be called from the callback of an asynchronous
+        // invocation, which runs in the single client thread pool thread that also completes the chunk invocations.
+        promise<void> completed;
+        proxy->ice_pingAsync(
+            [&]()
+            {
+                Ice::sendChunksAsync(
+                    data,
+                    makeSendChunk(proxy),
+                    [&completed]() { completed.set_value(); },
+                    [&completed](exception_ptr ex) { completed.set_exception(ex); });
+            },
+            [&completed](exception_ptr ex) { completed.set_exception(ex); });
+        completed.get_future().get();
+        test(proxy->takeChunkedBytes() == static_cast<int64_t>(size));
+
+        promise<void> failed;
+        proxy->ice_pingAsync(
+            [&]()
+            {
+                Ice::sendChunksAsync(
+                    data,
+                    [](int64_t, pair<const byte*, const byte*>, function<void()>, function<void(exception_ptr)>)
+                    { throw Ice::InvocationCanceledException(__FILE__, __LINE__); },
+                    [&failed]() { failed.set_value(); },
+                    [&failed](exception_ptr ex) { failed.set_exception(ex); });
+            },
+            [&failed](exception_ptr ex) { failed.set_exception(ex); });
+        try
+        {
+            failed.get_future().get();
+            test(false);
+        }
+        catch (const Ice::InvocationCanceledException&)
+        {
+        }
+        test(proxy->takeChunkedBytes() == 0);
+    }
+    cout << "ok" << endl;
+
+    adapter->destroy();
+}
@@ -0,0 +1,24 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+
+using namespace std;
+
+class Client : public Test::TestHelper
+{
+public:
+    void run(int, char**);
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::CommunicatorHolder communicator = initialize(argc, argv);
+    void allTests(Test::TestHelper*);
+    allTests(this);
+}
+
+DEFINE_TEST(Client)
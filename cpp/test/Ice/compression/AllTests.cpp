@@ -0,0 +1,186 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <mutex>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+    // The compression status of compressed messages, as set by the built-in codecs.
+    const int bzip2 = 2;
+    const int zstd = 3;
+    const int lz4 = 4;
+
+    int codecId(const string& name)
+    {
+        if (name == "zstd")
+        {
+            return zstd;
+        }
+        else if (name == "lz4")
+        {
+            return lz4;
+        }
+        test(name == "bzip2");
+        return bzip2;
+    }
+
+    // Records the protocol traces of a communicator.
+    class TraceLogger final : public Ice::Logger, public enable_shared_from_this<TraceLogger>
+    {
+    public:
+        void print(const string&) final {}
+
+        void trace(const string&, const string& message) final
+        {
+            lock_guard lock(_mutex);
+            _traces.push_back(message);
+        }
+
+        void warning(const string& message) final { cerr << "warning: " << message << endl; }
+
+        void error(const string& message) final { cerr << "error: " << message << endl; }
+
+        string getPrefix() final { return ""; }
+
+        Ice::LoggerPtr cloneWithPrefix(const string&) final { return shared_from_this(); }
+
+        // Returns the compression status of the last traced message with the given heading, or -1 if there's no such
+        // message.
+        int compressionStatus(const string& heading)
+        {
+            lock_guard lock(_mutex);
+            for (auto p = _traces.rbegin(); p != _traces.rend(); ++p)
+            {
+                if (p->compare(0, heading.size() + 1, heading + " ") == 0)
+                {
+                    const string field = "compression status = ";
+                    auto pos = p->find(field);
+                    test(pos != string::npos);
+                    return stoi(p->substr(pos + field.size()));
+                }
+            }
+            return -1;
+        }
+
+    private:
+        mutex _mutex;
+        list<string> _traces;
+    };
+    using TraceLoggerPtr = shared_ptr<TraceLogger>;
+
+    class TestI final : public TestIntf
+    {
+    public:
+        Ice::ByteSeq echo(Ice::ByteSeq seq, const Ice::Current&) final { return seq; }
+    };
+
+    Ice::CommunicatorPtr
+    createCommunicator(Test::TestHelper* helper, const string& codecs, const TraceLoggerPtr& logger)
+    {
+        Ice::InitializationData initData;
+        initData.properties = helper->communicator()->getProperties()->clone();
+        initData.properties->setProperty("Ice.Trace.Protocol", "1");
+        if (!codecs.empty())
+        {
+            initData.properties->setProperty("Ice.Compression.Codecs", codecs);
+        }
+        initData.logger = logger;
+        return Ice::initialize(initData);
+    }
+
+    // Sends a compressed request from a client with the given codecs to a server with the given codecs and returns the
+    // compression status of the request and the reply. serverMask is set to the codec mask advertised by the server.
+    pair<int, int>
+    invoke(Test::TestHelper* helper, const string& clientCodecs, const string& serverCodecs, int& serverMask)
+    {
+        auto serverLogger = make_shared<TraceLogger>();
+        Ice::CommunicatorHolder server = createCommunicator(helper, serverCodecs, serverLogger);
+        server->getProperties()->setProperty("TestAdapter.Endpoints", helper->getTestEndpoint());
+        Ice::ObjectAdapterPtr adapter = server->createObjectAdapter("TestAdapter");
+        adapter->add(make_shared<TestI>(), Ice::stringToIdentity("test"));
+        adapter->activate();
+
+        auto clientLogger = make_shared<TraceLogger>();
+        Ice::CommunicatorHolder client = createCommunicator(helper, clientCodecs, clientLogger);
+        TestIntfPrx proxy(client.communicator(), "test:" + helper->getTestEndpoint());
+        proxy = proxy->ice_compress(true);
+
+        // A compressible payload, large enough to be compressed.
+        Ice::ByteSeq seq(10 * 1024);
+        for (size_t i = 0; i < seq.size(); ++i)
+        {
+            seq[i] = static_cast<byte>(i % 16);
+        }
+        test(proxy->echo(seq) == seq);
+
+        serverMask = clientLogger->compressionStatus("received validate connection");
+        test(serverMask >= 0);
+        return {serverLogger->compressionStatus("received request"), clientLogger->compressionStatus("received reply")};
+    }
+}
+
+void
+allTests(Test::TestHelper* helper)
+{
+    int mask;
+
+    cout << "testing compression codec negotiation... " << flush;
+    {
+        // The server advertises the codecs it supports, bzip2 is always supported. Both sides use the first codec in
+        // the default order of preference (zstd lz4 bzip2) supported by the peer.
+        auto [request, reply] = invoke(helper, "", "", mask);
+        test(mask & (1 << bzip2));
+        int expected = (mask & (1 << zstd)) ? zstd : ((mask & (1 << lz4)) ? lz4 : bzip2);
+        test(request == expected);
+        test(reply == expected);
+    }
+    {
+        // The client uses its own order of preference among the codecs advertised by the server.
+        auto [request, reply] = invoke(helper, "lz4 zstd bzip2", "zstd lz4", mask);
+        test(mask & (1 << bzip2));
+        int expected = bzip2;
+        for (const char* name : {"lz4", "zstd"})
+        {
+            if (mask & (1 << codecId(name)))
+            {
+                expected = codecId(name);
+                break;
+            }
+        }
+        test(request == expected);
+        test(reply == expected);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing compression codec fallback... " << flush;
+    {
+        // A server which only supports bzip2 only advertises bzip2, the client falls back to bzip2.
+        auto [request, reply] = invoke(helper, "zstd lz4 bzip2", "bzip2", mask);
+        test(mask == (1 << bzip2));
+        test(request == bzip2);
+        test(reply == bzip2);
+    }
+    {
+        // A client which only supports bzip2 sends bzip2 requests, and the server, which only learns the codecs of the
+        // client from the requests it receives, replies with bzip2.
+        auto [request, reply] = invoke(helper, "bzip2", "zstd lz4 bzip2", mask);
+        test(request == bzip2);
+        test(reply == bzip2);
+    }
+    {
+        // bzip2 is supported even if it's not listed: without a common codec, the peers fall back to bzip2.
+        auto [request, reply] = invoke(helper, "zstd", "lz4", mask);
+        test((mask & (1 << bzip2)) && !(mask & (1 << zstd)));
+        test(request == bzip2);
+        test(reply == bzip2);
+    }
+    cout << "ok" << endl;
+}
@@ -0,0 +1,158 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <atomic>
+#include <future>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+    class TestI final : public TestIntf
+    {
+    public:
+        void ping(const Ice::Current&) final { ++_pingCount; }
+
+        int32_t takePingCount(const Ice::Current&) final { return _pingCount.exchange(0); }
+
+    private:
+        atomic<int32_t> _pingCount{0};
+    };
+
+    // Creates a client communicator with the cork mode enabled and the connection metrics enabled.
+    Ice::CommunicatorPtr createCommunicator(Test::TestHelper* helper, int corkSize)
+    {
+        Ice::InitializationData initData;
+        initData.properties = helper->communicator()->getProperties()->clone();
+        initData.properties->setProperty("Ice.Connection.CorkSize", to_string(corkSize));
+        // A long delay, so that the messages sent by the fan-outs below are held.
+        initData.properties->setProperty("Ice.Connection.CorkDelay", "1000000");
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        initData.properties->setProperty("IceMX.Metrics.Cork.Map.Connection.GroupBy", "none");
+        return Ice::initialize(initData);
+    }
+
+    // Sends rounds of concurrent twoway invocations and waits for all of them to complete.
+    void fanOut(const TestIntfPrx& proxy, int rounds, int count)
+    {
+        vector<future<void>> futures;
+        futures.reserve(static_cast<size_t>(count));
+        for (int i = 0; i < rounds; ++i)
+        {
+            for (int j = 0; j < count; ++j)
+            {
+                futures.push_back(proxy->pingAsync());
+            }
+            for (auto& f : futures)
+            {
+                f.get();
+            }
+            futures.clear();
+        }
+    }
+
+    IceMX::ConnectionMetricsPtr getConnectionMetrics(const Ice::CommunicatorPtr& communicator)
+    {
+        auto metricsAdmin = dynamic_pointer_cast<IceMX::MetricsAdmin>(communicator->findAdminFacet("Metrics"));
+        test(metricsAdmin);
+        int64_t timestamp;
+        IceMX::MetricsView view = metricsAdmin->getMetricsView("Cork", timestamp, Ice::Current());
+        test(view["Connection"].size() == 1);
+        return dynamic_pointer_cast<IceMX::ConnectionMetrics>(view["Connection"][0]);
+    }
+}
+
+void
+allTests(Test::TestHelper* helper)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", helper->getTestEndpoint());
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(make_shared<TestI>(), Ice::stringToIdentity("test"));
+    adapter->activate();
+
+    // The cork mode is only enabled on transports with gather writes.
+    const bool gatherWrites = helper->getTestProtocol() == "tcp";
+
+    cout << "testing corked twoway fan-out... " << flush;
+    {
+        Ice::CommunicatorHolder client = createCommunicator(helper, 64 * 1024);
+        TestIntfPrx proxy(client.communicator(), "test:" + helper->getTestEndpoint());
+        proxy->ice_ping();
+
+        fanOut(proxy, 10, 32);
+        test(proxy->takePingCount() == 10 * 32);
+
+        // The requests held while the previous one is written are sent together, with a single write.
+        auto metrics = getConnectionMetrics(client.communicator());
+        if (gatherWrites)
+        {
+            test(metrics->coalescedWrites && *metrics->coalescedMessages > *metrics->coalescedWrites);
+        }
+        else
+        {
+            test(!metrics->coalescedWrites);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing corked messages reaching the cork size... " << flush;
+    {
+        // With a cork size smaller than a request, requests are never held.
+        Ice::CommunicatorHolder client = createCommunicator(helper, 1);
+        TestIntfPrx proxy(client.communicator(), "test:" + helper->getTestEndpoint());
+        proxy->ice_ping();
+
+        fanOut(proxy, 10, 32);
+        test(proxy->takePingCount() == 10 * 32);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing corked oneways... " << flush;
+    {
+        // Held oneway requests are sent in order, before the twoway request that follows them.
+        Ice::CommunicatorHolder client = createCommunicator(helper, 64 * 1024);
+        TestIntfPrx proxy(client.communicator(), "test:" + helper->getTestEndpoint());
+        proxy->ice_ping();
+
+        TestIntfPrx oneway = proxy->ice_oneway();
+        for (int i = 0; i < 5; ++i)
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                oneway->ping();
+            }
+            test(proxy->takePingCount() == 100);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing graceful closure with corked messages... " << flush;
+    {
+        // Closing the connection gracefully sends the held requests and waits for their replies.
+        Ice::CommunicatorHolder client = createCommunicator(helper, 64 * 1024);
+        TestIntfPrx proxy(client.communicator(), "test:" + helper->getTestEndpoint());
+        proxy->ice_ping();
+
+        vector<future<void>> futures;
+        for (int i = 0; i < 32; ++i)
+        {
+            futures.push_back(proxy->pingAsync());
+        }
+        proxy->ice_getConnection()->close(Ice::ConnectionClose::GracefullyWithWait);
+        for (auto& f : futures)
+        {
+            f.get();
+        }
+        test(proxy->takePingCount() == 32);
+    }
+    cout << "ok" << endl;
+
+    adapter->destroy();
+}
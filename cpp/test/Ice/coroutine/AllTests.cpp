@@ -0,0 +1,121 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <future>
+#include <vector>
+
+using namespace std;
+using namespace Ice;
+using namespace Test;
+
+namespace
+{
+    thread_local bool executorThread = false;
+
+    // Runs the given coroutine to completion.
+    void run(Task<void> task)
+    {
+        promise<void> p;
+        task.then([&p] { p.set_value(); }, [&p](exception_ptr ex) { p.set_exception(ex); });
+        p.get_future().get();
+    }
+
+    Task<int32_t> addAsync(TestIntfPrx prx, int32_t x, int32_t y)
+    {
+        int32_t r1 = co_await prx->opIntAsync(x, useTask);
+        int32_t r2 = co_await prx->opIntAsync(y, useTask);
+        co_return r1 + r2;
+    }
+
+    Task<void> testOperations(TestIntfPrx prx)
+    {
+        test(co_await prx->opIntAsync(5, useTask) == 5);
+
+        auto [r, s2] = co_await prx->opStringAsync("hello", useTask);
+        test(r == "hello");
+        test(s2 == "hello");
+
+        co_await prx->opVoidAsync(useTask);
+
+        StringSeq seq{"a", "bb", "ccc"};
+        test(co_await prx->opMarshaledResultAsync(seq, useTask) == seq);
+
+        try
+        {
+            co_await prx->opExceptionAsync("reason", useTask);
+            test(false);
+        }
+        catch (const TestException& ex)
+        {
+            test(ex.reason == "reason");
+        }
+
+        test(co_await addAsync(prx, 3, 4) == 7);
+
+        co_await prx->ice_oneway()->opVoidAsync(useTask);
+    }
+
+    Task<void> testFanOut(TestIntfPrx prx)
+    {
+        vector<Task<int32_t>> tasks;
+        for (int32_t i = 0; i < 20; ++i)
+        {
+            tasks.push_back(prx->opIntAsync(i, useTask));
+        }
+        int32_t sum = 0;
+        for (auto& task : tasks)
+        {
+            sum += co_await task;
+        }
+        test(sum == 190);
+
+        // The server dispatches with a single thread: the fan-out dispatch must not hold it while awaiting.
+        test(co_await prx->opFanOutAsync(prx, 20, useTask) == 190);
+    }
+
+    Task<void> testExecutor(TestIntfPrx prx)
+    {
+        test(!executorThread);
+        co_await prx->sleepAsync(50, useTask);
+        test(executorThread);
+        test(co_await prx->opIntAsync(1, useTask) == 1);
+        test(executorThread);
+    }
+}
+
+TestIntfPrx
+allTests(TestHelper* helper)
+{
+    CommunicatorPtr communicator = helper->communicator();
+    TestIntfPrx prx(communicator, "test:" + helper->getTestEndpoint());
+
+    cout << "testing co_await with proxy invocations... " << flush;
+    run(testOperations(prx));
+    cout << "ok" << endl;
+
+    cout << "testing fan-out with coroutines... " << flush;
+    run(testFanOut(prx));
+    cout << "ok" << endl;
+
+    cout << "testing coroutine resumption with executor... " << flush;
+    {
+        InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.executor = [](function<void()> call, const ConnectionPtr&)
+        {
+            executorThread = true;
+            call();
+            executorThread = false;
+        };
+        CommunicatorHolder executorCommunicator(initData);
+        run(testExecutor(TestIntfPrx(executorCommunicator.communicator(), "test:" + helper->getTestEndpoint())));
+    }
+    cout << "ok" << endl;
+
+    return prx;
+}
@@ -0,0 +1,7 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+$(test)_cppflags += -std=c++20
+
+tests += $(test)
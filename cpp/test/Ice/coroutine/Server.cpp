@@ -0,0 +1,33 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+#include "TestI.h"
+
+using namespace std;
+
+class Server : public Test::TestHelper
+{
+public:
+    void run(int, char**);
+};
+
+void
+Server::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    // A single dispatch thread: the fan-out dispatch doesn't hold it while awaiting the nested invocations.
+    properties->setProperty("Ice.ThreadPool.Server.Size", "1");
+    properties->setProperty("Ice.ThreadPool.Server.SizeMax", "1");
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(std::make_shared<TestIntfI>(), Ice::stringToIdentity("test"));
+    adapter->activate();
+    serverReady();
+    communicator->waitForShutdown();
+}
+
+DEFINE_TEST(Server)
@@ -0,0 +1,76 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "TestI.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace Test;
+
+Ice::Task<int32_t>
+TestIntfI::opIntAsync(int32_t i, const Ice::Current&)
+{
+    co_return i;
+}
+
+Ice::Task<tuple<string, string>>
+TestIntfI::opStringAsync(string s1, const Ice::Current&)
+{
+    co_return make_tuple(s1, s1);
+}
+
+Ice::Task<void>
+TestIntfI::opVoidAsync(const Ice::Current&)
+{
+    co_return;
+}
+
+Ice::Task<void>
+TestIntfI::opExceptionAsync(string reason, const Ice::Current&)
+{
+    throw TestException{std::move(reason)};
+    co_return;
+}
+
+Ice::Task<int32_t>
+TestIntfI::opFanOutAsync(optional<TestIntfPrx> target, int32_t count, const Ice::Current&)
+{
+    // Start all the invocations before awaiting the first result, the dispatch thread isn't blocked while the
+    // invocations are in progress.
+    vector<Ice::Task<int32_t>> tasks;
+    for (int32_t i = 0; i < count; ++i)
+    {
+        tasks.push_back(target->opIntAsync(i, Ice::useTask));
+    }
+
+    int32_t sum = 0;
+    for (auto& task : tasks)
+    {
+        sum += co_await task;
+    }
+    co_return sum;
+}
+
+Ice::Task<TestIntf::OpMarshaledResultMarshaledResult>
+TestIntfI::opMarshaledResultAsync(StringSeq s, const Ice::Current& current)
+{
+    co_return OpMarshaledResultMarshaledResult{s, current};
+}
+
+Ice::Task<void>
+TestIntfI::sleepAsync(int32_t ms, const Ice::Current&)
+{
+    this_thread::sleep_for(chrono::milliseconds(ms));
+    co_return;
+}
+
+Ice::Task<void>
+TestIntfI::shutdownAsync(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+    co_return;
+}
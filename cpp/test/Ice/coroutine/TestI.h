@@ -0,0 +1,30 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+class TestIntfI final : public Test::TestIntf
+{
+public:
+    Ice::Task<std::int32_t> opIntAsync(std::int32_t, const Ice::Current&) final;
+
+    Ice::Task<std::tuple<std::string, std::string>> opStringAsync(std::string, const Ice::Current&) final;
+
+    Ice::Task<void> opVoidAsync(const Ice::Current&) final;
+
+    Ice::Task<void> opExceptionAsync(std::string, const Ice::Current&) final;
+
+    Ice::Task<std::int32_t> opFanOutAsync(std::optional<Test::TestIntfPrx>, std::int32_t, const Ice::Current&) final;
+
+    Ice::Task<OpMarshaledResultMarshaledResult> opMarshaledResultAsync(Test::StringSeq, const Ice::Current&) final;
+
+    Ice::Task<void> sleepAsync(std::int32_t, const Ice::Current&) final;
+
+    Ice::Task<void> shutdownAsync(const Ice::Current&) final;
+};
+
+#endif
@@ -0,0 +1,182 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+    class TestI final : public TestIntf
+    {
+    public:
+        int64_t writeRange(int64_t offset, Ice::ByteSeq range, const Ice::Current&) final
+        {
+            ++_writeCount;
+            for (size_t i = 0; i < range.size(); ++i)
+            {
+                if (range[i] != static_cast<byte>((offset + static_cast<int64_t>(i)) % 251))
+                {
+                    return -1;
+                }
+            }
+            return static_cast<int64_t>(range.size());
+        }
+
+        int32_t takeWriteCount(const Ice::Current&) final { return _writeCount.exchange(0); }
+
+    private:
+        atomic<int32_t> _writeCount{0};
+    };
+
+    // A file created in the temporary directory and opened for reading. The file is closed and removed on
+    // destruction.
+    class TemporaryFile
+    {
+    public:
+        explicit TemporaryFile(size_t size)
+        {
+            random_device rd;
+            _path = filesystem::temp_directory_path() / ("ice-filerange-" + to_string(rd()) + ".dat");
+            {
+                Ice::ByteSeq content(size);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    content[i] = static_cast<byte>(i % 251);
+                }
+                ofstream out(_path, ios::binary);
+                out.write(reinterpret_cast<const char*>(content.data()), static_cast<streamsize>(size));
+                test(out.good());
+            }
+#ifdef _WIN32
+            _file = CreateFileW(
+                _path.c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL,
+                0);
+            test(_file != INVALID_HANDLE_VALUE);
+#else
+            _file = open(_path.c_str(), O_RDONLY);
+            test(_file >= 0);
+#endif
+        }
+
+        ~TemporaryFile()
+        {
+#ifdef _WIN32
+            CloseHandle(_file);
+#else
+            close(_file);
+#endif
+            error_code ec;
+            filesystem::remove(_path, ec);
+        }
+
+        TemporaryFile(const TemporaryFile&) = delete;
+        TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+        [[nodiscard]] Ice::FileDescriptor file() const { return _file; }
+
+    private:
+        filesystem::path _path;
+        Ice::FileDescriptor _file;
+    };
+}
+
+void
+allTests(Test::TestHelper* helper)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", helper->getTestEndpoint());
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(make_shared<TestI>(), Ice::stringToIdentity("test"));
+    adapter->activate();
+
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    Ice::CommunicatorHolder client(initData);
+    TestIntfPrx proxy(client.communicator(), "test:" + helper->getTestEndpoint());
+
+    const int32_t size = 4 * 1024 * 1024;
+    const int32_t chunkSize = 512 * 1024;
+    TemporaryFile file(static_cast<size_t>(size));
+
+    cout << "testing file ranges... " << flush;
+    {
+        for (int32_t offset = 0; offset < size; offset += chunkSize)
+        {
+            test(proxy->writeRange(offset, Ice::FileRange{file.file(), offset, chunkSize}) == chunkSize);
+        }
+
+        // Ranges at unaligned offsets, and a range ending at the end of the file.
+        test(proxy->writeRange(1, Ice::FileRange{file.file(), 1, 1000}) == 1000);
+        test(proxy->writeRange(size - 333, Ice::FileRange{file.file(), size - 333, 333}) == 333);
+
+        // An empty range.
+        test(proxy->writeRange(0, Ice::FileRange{file.file(), 0, 0}) == 0);
+        test(proxy->writeRange(size, Ice::FileRange{file.file(), size, 0}) == 0);
+
+        test(proxy->takeWriteCount() == size / chunkSize + 4);
+
+#ifndef _WIN32
+        // The ranges are read with positional reads, which don't change the file offset.
+        test(lseek(file.file(), 0, SEEK_CUR) == 0);
+#endif
+    }
+    cout << "ok" << endl;
+
+    cout << "testing invalid file ranges... " << flush;
+    {
+        // The range is read when the request is marshaled, the invocation fails before sending the request.
+        try
+        {
+            proxy->writeRange(size - 10, Ice::FileRange{file.file(), size - 10, 20});
+            test(false);
+        }
+        catch (const Ice::MarshalException&)
+        {
+        }
+
+        try
+        {
+            proxy->writeRange(0, Ice::FileRange{file.file(), -1, 10});
+            test(false);
+        }
+        catch (const Ice::MarshalException&)
+        {
+        }
+
+        try
+        {
+            proxy->writeRange(0, Ice::FileRange{file.file(), 0, -1});
+            test(false);
+        }
+        catch (const Ice::MarshalException&)
+        {
+        }
+
+        test(proxy->takeWriteCount() == 0);
+    }
+    cout << "ok" << endl;
+
+    adapter->destroy();
+}
@@ -43,6 +43,7 @@ allTests(Test::TestHelper* helper)
     CommunicatorPtr communicator = helper->communicator();
     HoldPrx hold(communicator, "hold:" + helper->getTestEndpoint());
     HoldPrx holdSerialized(communicator, "hold:" + helper->getTestEndpoint(1));
+    HoldPrx holdWorkStealing(communicator, "hold:" + helper->getTestEndpoint(2));
 
     cout << "changing state between active and hold rapidly... " << flush;
     for (int i = 0; i < 100; ++i)
@@ -177,6 +178,47 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing serialize mode with work-stealing executor... " << flush;
+    {
+        ConditionPtr cond = make_shared<Condition>(true);
+        int value = 0;
+        shared_ptr<promise<void>> completed;
+        while (value < 3000 && cond->value())
+        {
+            completed = make_shared<promise<void>>();
+            auto sent = make_shared<promise<bool>>();
+            auto expected = value;
+            holdWorkStealing->setAsync(
+                value + 1,
+                static_cast<int32_t>(IceInternal::random(1)),
+                [cond, expected, completed](int val)
+                {
+                    if (val != expected)
+                    {
+                        cond->set(false);
+                    }
+                    completed->set_value();
+                },
+                [completed](exception_ptr) { completed->set_value(); },
+                [sent](bool sentSynchronously) { sent->set_value(sentSynchronously); });
+            ++value;
+            if (value % 100 == 0)
+            {
+                sent->get_future().get();
+            }
+        }
+        completed->get_future().get();
+        test(cond->value());
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            holdWorkStealing->ice_oneway()->setOneway(value + 1, value);
+            ++value;
+        }
+        test(holdWorkStealing->set(0, 0) == value);
+    }
+    cout << "ok" << endl;
+
     cout << "testing waitForHold... " << flush;
     {
         hold->waitForHold();
@@ -42,8 +42,16 @@ Server::run(int argc, char** argv)
     Ice::ObjectAdapterPtr adapter2 = communicator->createObjectAdapter("TestAdapter2");
     adapter2->add(make_shared<HoldI>(timer, adapter2), Ice::stringToIdentity("hold"));
 
+    properties->setProperty("TestAdapter3.Endpoints", getTestEndpoint(2));
+    properties->setProperty("TestAdapter3.ThreadPool.Serialize", "1");
+    properties->setProperty("TestAdapter3.Dispatch.Executor", "WorkStealing");
+    properties->setProperty("TestAdapter3.Dispatch.Size", "4");
+    Ice::ObjectAdapterPtr adapter3 = communicator->createObjectAdapter("TestAdapter3");
+    adapter3->add(make_shared<HoldI>(timer, adapter3), Ice::stringToIdentity("hold"));
+
     adapter1->activate();
     adapter2->activate();
+    adapter3->activate();
 
     serverReady();
 
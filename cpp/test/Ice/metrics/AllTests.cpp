@@ -347,6 +347,17 @@ namespace
         }
     }
 
+    int64_t histogramCount(const optional<IceMX::MetricsHistogram>& histogram)
+    {
+        test(histogram && histogram->counts.size() == histogram->bounds.size() + 1);
+        int64_t count = 0;
+        for (auto c : histogram->counts)
+        {
+            count += c;
+        }
+        return count;
+    }
+
     map<string, IceMX::MetricsPtr> toMap(const IceMX::MetricsMap& mmap)
     {
         map<string, IceMX::MetricsPtr> m;
@@ -428,6 +439,19 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         view["Thread"][0]->total == threadCount);
     cout << "ok" << endl;
 
+    cout << "testing buffer pool metrics..." << flush;
+
+    metrics->ice_ping();
+    view = clientMetrics->getMetricsView("View", timestamp);
+    test(!view["BufferPool"].empty());
+    for (const auto& m : view["BufferPool"])
+    {
+        auto bm = dynamic_pointer_cast<IceMX::BufferPoolMetrics>(m);
+        test(bm && bm->total == bm->hits + bm->misses && bm->total > 0);
+        test(bm->bytesHeld >= 0 && bm->bytesHeld % stoi(bm->id) == 0);
+    }
+    cout << "ok" << endl;
+
     cout << "testing group by id..." << flush;
 
     props["IceMX.Metrics.View.GroupBy"] = "id";
@@ -453,12 +477,18 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
 
     IceMX::InvocationMetricsPtr invoke = dynamic_pointer_cast<IceMX::InvocationMetrics>(view["Invocation"][0]);
     test(invoke->id.find("[ice_ping]") > 0 && invoke->current == 0 && invoke->total == 5);
+    test(histogramCount(invoke->latency) == 5);
 
     if (!collocated)
     {
         test(invoke->remotes.size() == 2);
         test(invoke->remotes[0]->total == 2);
         test(invoke->remotes[1]->total == 3);
+        auto rm = dynamic_pointer_cast<IceMX::RemoteMetrics>(invoke->remotes[0]);
+        test(histogramCount(rm->latency) == 2 && histogramCount(rm->sizes) == 2);
+
+        auto cm = dynamic_pointer_cast<IceMX::ConnectionMetrics>(view["Connection"][0]);
+        test(histogramCount(cm->sentSizes) > 0 && histogramCount(cm->receivedSizes) > 0);
     }
     else
     {
@@ -475,6 +505,8 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
     test(view["Dispatch"].size() == 1);
     test(view["Dispatch"][0]->current == 0 && view["Dispatch"][0]->total == 5);
     test(view["Dispatch"][0]->id.find("[ice_ping]") > 0);
+    auto dm = dynamic_pointer_cast<IceMX::DispatchMetrics>(view["Dispatch"][0]);
+    test(histogramCount(dm->latency) == 5 && histogramCount(dm->sizes) == 5);
 
     if (!collocated)
     {
@@ -489,6 +521,143 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
 
     cout << "ok" << endl;
 
+    cout << "testing metrics histograms..." << flush;
+
+    props["IceMX.Metrics.View.Histogram.Min"] = "16";
+    props["IceMX.Metrics.View.Histogram.Max"] = "100";
+    updateProps(clientProps, serverProps, update.get(), props);
+
+    metrics->ice_ping();
+    waitForCurrent(serverMetrics, "View", "Dispatch", 0);
+
+    view = serverMetrics->getMetricsView("View", timestamp);
+    test(view["Dispatch"].size() == 1);
+    dm = dynamic_pointer_cast<IceMX::DispatchMetrics>(view["Dispatch"][0]);
+    test(dm->sizes && dm->sizes->bounds == Ice::LongSeq({16, 32, 64, 128}));
+    test(histogramCount(dm->latency) == 1 && histogramCount(dm->sizes) == 1);
+    {
+        // The size is counted in the first bucket with an upper bound greater than or equal to the size.
+        size_t bucket = 0;
+        while (bucket < dm->sizes->bounds.size() && dm->sizes->bounds[bucket] < dm->size)
+        {
+            ++bucket;
+        }
+        test(dm->sizes->counts[bucket] == 1);
+    }
+
+    props["IceMX.Metrics.View.Histogram.Max"] = "0";
+    updateProps(clientProps, serverProps, update.get(), props);
+
+    metrics->ice_ping();
+    waitForCurrent(serverMetrics, "View", "Dispatch", 0);
+
+    view = serverMetrics->getMetricsView("View", timestamp);
+    test(view["Dispatch"].size() == 1);
+    dm = dynamic_pointer_cast<IceMX::DispatchMetrics>(view["Dispatch"][0]);
+    test(!dm->latency && !dm->sizes);
+
+    if (!collocated)
+    {
+        metrics->ice_getConnection()->close(Ice::ConnectionClose::GracefullyWithWait);
+
+        waitForCurrent(clientMetrics, "View", "Connection", 0);
+        waitForCurrent(serverMetrics, "View", "Connection", 0);
+    }
+
+    props.erase("IceMX.Metrics.View.Histogram.Min");
+    props.erase("IceMX.Metrics.View.Histogram.Max");
+    clearView(clientProps, serverProps, update.get());
+
+    cout << "ok" << endl;
+
+    cout << "testing cached metrics keys..." << flush;
+    {
+        // The Dispatch map keys are cached when GroupBy, Accept and Reject only use the dispatch adapter, identity,
+        // facet, operation or mode.
+        bool remote = serverProps->ice_getConnection() != nullptr;
+        Ice::PropertiesAdminPrx propsAdmin = remote ? serverProps : clientProps;
+        Ice::PropertyDict dict = propsAdmin->getPropertiesForPrefix("IceMX.Metrics");
+        for (auto& p : dict)
+        {
+            p.second = "";
+        }
+        dict["IceMX.Metrics.View.Map.Dispatch.GroupBy"] = "identity [operation]";
+        dict["IceMX.Metrics.View.Map.Dispatch.Reject.parent"] = "Ice\\.Admin|Controller";
+        dict["IceMX.Metrics.View.Map.Dispatch.Reject.operation"] = "ice_ping";
+        propsAdmin->setProperties(dict);
+        if (remote)
+        {
+            propsAdmin->setProperties(Ice::PropertyDict());
+        }
+        else
+        {
+            update->waitForUpdate();
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            metrics->op();
+            metrics->ice_ping();
+        }
+
+        view = serverMetrics->getMetricsView("View", timestamp);
+        test(view["Dispatch"].size() == 1);
+        test(view["Dispatch"][0]->id == "metrics [op]" && view["Dispatch"][0]->total == 3);
+
+        // The oneway and twoway dispatches of the same operation have different keys.
+        dict["IceMX.Metrics.View.Map.Dispatch.GroupBy"] = "mode";
+        propsAdmin->setProperties(dict);
+        if (remote)
+        {
+            propsAdmin->setProperties(Ice::PropertyDict());
+        }
+        else
+        {
+            update->waitForUpdate();
+        }
+
+        for (int i = 0; i < 2; ++i)
+        {
+            metrics->ice_oneway()->op();
+        }
+        for (int i = 0; i < 3; ++i)
+        {
+            metrics->op();
+        }
+
+        // The oneway requests can still be dispatched after the twoway requests complete.
+        map<string, int> totals;
+        for (int i = 0; i < 100; ++i)
+        {
+            view = serverMetrics->getMetricsView("View", timestamp);
+            totals.clear();
+            for (const auto& m : view["Dispatch"])
+            {
+                totals[m->id] = m->total;
+            }
+            if (totals["oneway"] == 2)
+            {
+                break;
+            }
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+        test(view["Dispatch"].size() == 2);
+        test(totals["oneway"] == 2 && totals["twoway"] == 3);
+    }
+
+    updateProps(clientProps, serverProps, update.get(), props);
+    if (!collocated)
+    {
+        metrics->ice_getConnection()->close(Ice::ConnectionClose::GracefullyWithWait);
+
+        waitForCurrent(clientMetrics, "View", "Connection", 0);
+        waitForCurrent(serverMetrics, "View", "Connection", 0);
+    }
+
+    clearView(clientProps, serverProps, update.get());
+
+    cout << "ok" << endl;
+
     map<string, IceMX::MetricsPtr> map;
 
     string type;
@@ -578,6 +747,48 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         test(sm2->receivedBytes - sm1->receivedBytes == requestSz + static_cast<int>(bs.size()) + 4);
         test(sm2->sentBytes - sm1->sentBytes == replySz);
 
+        // The requests queued behind a large request are sent with gather writes, if the transport supports them.
+        // The server holds its connections to make sure the large request isn't sent before the next ones are queued.
+        {
+            ControllerPrx controller(communicator, "controller:" + helper->getTestEndpoint(2));
+            controller->hold();
+
+            vector<future<void>> results;
+            results.push_back(metrics->opByteSAsync(bs));
+            bs.resize(100);
+            for (int i = 0; i < 10; ++i)
+            {
+                results.push_back(metrics->opByteSAsync(bs));
+            }
+
+            controller->resume();
+            for (auto& result : results)
+            {
+                result.get();
+            }
+
+            // The gather writes are reported once the write returns, which can be after the replies are received.
+            int nRetry = 100;
+            while (true)
+            {
+                cm2 = dynamic_pointer_cast<IceMX::ConnectionMetrics>(
+                    clientMetrics->getMetricsView("View", timestamp)["Connection"][0]);
+                if (protocol != "tcp" || cm2->coalescedWrites > 0 || nRetry-- == 0)
+                {
+                    break;
+                }
+                this_thread::sleep_for(chrono::milliseconds(10));
+            }
+            if (protocol == "tcp")
+            {
+                test(cm2->coalescedWrites > 0 && *cm2->coalescedMessages >= *cm2->coalescedWrites);
+            }
+            else
+            {
+                test(!cm2->coalescedWrites && !cm2->coalescedMessages);
+            }
+        }
+
         props["IceMX.Metrics.View.Map.Connection.GroupBy"] = "state";
         updateProps(clientProps, serverProps, update.get(), props, "Connection");
 
@@ -1443,6 +1654,7 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
     if (!collocated)
     {
         test(obsv->connectionObserver->received > 0 && obsv->connectionObserver->sent > 0);
+        test((obsv->connectionObserver->coalesced > 0) == (protocol == "tcp"));
     }
 
     // test(obsv->dispatchObserver->userExceptionCount > 0);
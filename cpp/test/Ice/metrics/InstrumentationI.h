@@ -74,6 +74,7 @@ public:
         ObserverI::reset();
         received = 0;
         sent = 0;
+        coalesced = 0;
     }
 
     void sentBytes(std::int32_t s) final
@@ -88,8 +89,15 @@ public:
         received += s;
     }
 
+    void coalescedMessages(std::int32_t s) final
+    {
+        std::lock_guard lock(_mutex);
+        coalesced += s;
+    }
+
     std::int32_t sent;
     std::int32_t received;
+    std::int32_t coalesced;
 };
 using ConnectionObserverIPtr = std::shared_ptr<ConnectionObserverI>;
 
@@ -101,6 +109,7 @@ public:
         std::lock_guard lock(_mutex);
         ObserverI::reset();
         states = 0;
+        depth = 0;
     }
 
     void stateChanged(Ice::Instrumentation::ThreadState, Ice::Instrumentation::ThreadState) final
@@ -109,7 +118,14 @@ public:
         ++states;
     }
 
+    void queueDepth(std::int32_t d) final
+    {
+        std::lock_guard lock(_mutex);
+        depth = d;
+    }
+
     std::int32_t states;
+    std::int32_t depth;
 };
 using ThreadObserverIPtr = std::shared_ptr<ThreadObserverI>;
 
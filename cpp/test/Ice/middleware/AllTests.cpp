@@ -3,6 +3,12 @@
 #include "TestHelper.h"
 #include "TestI.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 using namespace std;
 using namespace Test;
 
@@ -68,9 +74,216 @@ testMiddlewareExecutionOrder(const Ice::CommunicatorPtr& communicator)
     cout << "ok" << endl;
 }
 
+// Holds the response of each dispatch until the test completes it.
+class GatedObjectI final : public GatedObject
+{
+public:
+    void opAsync(function<void()> response, function<void(exception_ptr)>, const Ice::Current& current) final
+    {
+        lock_guard lock(_mutex);
+        _dispatches.emplace_back(current.ctx, std::move(response));
+        _conditionVariable.notify_all();
+    }
+
+    // Waits for the dispatch with the given index and returns its context.
+    Ice::Context waitForDispatch(size_t index)
+    {
+        unique_lock lock(_mutex);
+        _conditionVariable.wait(lock, [this, index] { return _dispatches.size() > index; });
+        return _dispatches[index].first;
+    }
+
+    // Sends the response of the dispatch with the given index.
+    void complete(size_t index)
+    {
+        function<void()> response;
+        {
+            lock_guard lock(_mutex);
+            response = std::move(_dispatches[index].second);
+        }
+        response();
+    }
+
+    size_t dispatchCount()
+    {
+        lock_guard lock(_mutex);
+        return _dispatches.size();
+    }
+
+private:
+    mutex _mutex;
+    condition_variable _conditionVariable;
+    vector<pair<Ice::Context, function<void()>>> _dispatches;
+};
+
+int64_t
+millisecondsSinceEpoch(chrono::system_clock::time_point time)
+{
+    return chrono::duration_cast<chrono::milliseconds>(time.time_since_epoch()).count();
+}
+
+void
+testScheduler(Test::TestHelper* helper)
+{
+    cout << "testing dispatch deadlines and priorities... " << flush;
+
+    // The adapter has a single thread and a single dispatch slot: the requests waiting for the slot must not hold the
+    // thread, otherwise the adapter would stop reading requests.
+    Ice::CommunicatorPtr communicator = helper->communicator();
+    communicator->getProperties()->setProperty("Scheduler.ThreadPool.Size", "1");
+    communicator->getProperties()->setProperty("Scheduler.Dispatch.MaxDispatches", "1");
+    Ice::ObjectAdapterPtr oa = communicator->createObjectAdapterWithEndpoints("Scheduler", helper->getTestEndpoint());
+    auto servant = make_shared<GatedObjectI>();
+    auto p = Ice::uncheckedCast<GatedObjectPrx>(oa->add(servant, Ice::Identity{"test", ""}))
+                 ->ice_collocationOptimized(false);
+    oa->activate();
+
+    // A request whose deadline has expired is not dispatched.
+    try
+    {
+        p->op(Ice::Context{{"_deadline", "1"}});
+        test(false);
+    }
+    catch (const Ice::UnknownLocalException& ex)
+    {
+        test(string{ex.what()}.find("::Ice::DeadlineExpiredException") != string::npos);
+    }
+    test(servant->dispatchCount() == 0);
+
+    // The client propagates the deadline of an invocation with an invocation timeout.
+    {
+        auto before = millisecondsSinceEpoch(chrono::system_clock::now());
+        auto result = p->ice_invocationTimeout(60000)->opAsync();
+        auto deadline = stoll(servant->waitForDispatch(0)["_deadline"]);
+        test(deadline >= before + 60000 && deadline <= millisecondsSinceEpoch(chrono::system_clock::now()) + 60000);
+        servant->complete(0);
+        result.get();
+    }
+
+    // While the only dispatch slot is busy, the requests are queued.
+    auto blocker = p->opAsync();
+    servant->waitForDispatch(1);
+    auto low = p->opAsync(Ice::Context{{"_priority", "1"}});
+    auto high = p->opAsync(Ice::Context{{"_priority", "10"}});
+
+    // A queued request is shed when its deadline expires, the slot is still busy. The adapter reads the requests of
+    // the connection in order with its single thread, so the requests sent before are queued once this one is shed.
+    try
+    {
+        auto deadline = chrono::system_clock::now() + chrono::milliseconds(100);
+        p->op(Ice::Context{{"_deadline", to_string(millisecondsSinceEpoch(deadline))}});
+        test(false);
+    }
+    catch (const Ice::UnknownLocalException& ex)
+    {
+        test(string{ex.what()}.find("::Ice::DeadlineExpiredException") != string::npos);
+    }
+    test(servant->dispatchCount() == 2);
+
+    // The queued requests are dispatched by decreasing priority as the slot is released.
+    servant->complete(1);
+    blocker.get();
+    test(servant->waitForDispatch(2)["_priority"] == "10");
+    servant->complete(2);
+    high.get();
+    test(servant->waitForDispatch(3)["_priority"] == "1");
+    servant->complete(3);
+    low.get();
+
+    test(servant->dispatchCount() == 4);
+    oa->destroy();
+    cout << "ok" << endl;
+}
+
+// Sleeps for the duration given by the sleep context entry.
+class SleepingObjectI final : public MyObject
+{
+public:
+    string getName(const Ice::Current& current) final
+    {
+        auto p = current.ctx.find("sleep");
+        if (p != current.ctx.end())
+        {
+            this_thread::sleep_for(chrono::milliseconds(stoi(p->second)));
+        }
+        return "Foo";
+    }
+};
+
+void
+testConcurrencyLimit(Test::TestHelper* helper)
+{
+    cout << "testing adaptive concurrency limit... " << flush;
+
+    // Use a separate communicator with the Metrics admin facet, which reports the concurrency limits.
+    Ice::InitializationData initData;
+    initData.properties = helper->communicator()->getProperties()->clone();
+    initData.properties->setProperty("Ice.Admin.Enabled", "1");
+    initData.properties->setProperty("IceMX.Metrics.View.Map.ConcurrencyLimit.GroupBy", "id");
+    initData.properties->setProperty("Limiter.ThreadPool.Size", "4");
+    initData.properties->setProperty("Limiter.Dispatch.ConcurrencyLimit", "AIMD");
+    initData.properties->setProperty("Limiter.Dispatch.ConcurrencyLimit.Initial", "1");
+    initData.properties->setProperty("Limiter.Dispatch.ConcurrencyLimit.Max", "2");
+    initData.properties->setProperty("Limiter.Dispatch.ConcurrencyLimit.Latency", "100");
+    Ice::CommunicatorHolder communicator = Ice::initialize(initData);
+
+    Ice::ObjectAdapterPtr oa = communicator->createObjectAdapterWithEndpoints("Limiter", helper->getTestEndpoint(1));
+    auto servant = make_shared<SleepingObjectI>();
+    auto p =
+        Ice::uncheckedCast<MyObjectPrx>(oa->add(servant, Ice::Identity{"test", ""}))->ice_collocationOptimized(false);
+    oa->activate();
+
+    auto metrics = dynamic_pointer_cast<IceMX::MetricsAdmin>(communicator->findAdminFacet("Metrics"));
+    test(metrics);
+    auto getLimitMetrics = [&metrics]
+    {
+        int64_t timestamp;
+        IceMX::MetricsView view = metrics->getMetricsView("View", timestamp, Ice::Current{});
+        test(view["ConcurrencyLimit"].size() == 1);
+        auto m = dynamic_pointer_cast<IceMX::ConcurrencyLimitMetrics>(view["ConcurrencyLimit"][0]);
+        test(m && m->id == "Limiter");
+        return m;
+    };
+
+    // The initial limit is 1: a request received while another request is dispatched is rejected.
+    auto blocker = p->getNameAsync(Ice::Context{{"sleep", "500"}});
+    this_thread::sleep_for(chrono::milliseconds(100));
+    try
+    {
+        p->getName();
+        test(false);
+    }
+    catch (const Ice::UnknownLocalException& ex)
+    {
+        test(string{ex.what()}.find("::Ice::ConcurrencyLimitException") != string::npos);
+    }
+    blocker.get();
+
+    // The limit grows with the dispatches completed under the latency threshold, up to the maximum.
+    p->getName();
+    auto m = getLimitMetrics();
+    test(m->limit == 2 && m->rejected == 1 && m->total == 2 && m->current == 0);
+
+    blocker = p->getNameAsync(Ice::Context{{"sleep", "300"}});
+    this_thread::sleep_for(chrono::milliseconds(100));
+    p->getName();
+    m = getLimitMetrics();
+    test(m->limit == 2 && m->rejected == 1 && m->total == 4 && m->current == 1);
+
+    // And shrinks with the dispatches completed over the latency threshold.
+    blocker.get();
+    m = getLimitMetrics();
+    test(m->limit == 1 && m->rejected == 1 && m->total == 4 && m->current == 0);
+
+    oa->destroy();
+    cout << "ok" << endl;
+}
+
 void
 allTests(Test::TestHelper* helper)
 {
     Ice::CommunicatorPtr communicator = helper->communicator();
     testMiddlewareExecutionOrder(communicator);
+    testScheduler(helper);
+    testConcurrencyLimit(helper);
 }
@@ -171,6 +171,40 @@ batchOneways(const MyClassPrx& p)
         ic->destroy();
     }
 
+    if (batch->ice_getConnection())
+    {
+        // The batch requests are flushed once the oldest queued request reaches Ice.BatchAutoFlushDelay.
+        InitializationData initData;
+        initData.properties = p->ice_getCommunicator()->getProperties()->clone();
+        initData.properties->setProperty("Ice.BatchAutoFlushDelay", "100");
+        CommunicatorPtr ic = initialize(initData);
+
+        auto batch5 = MyClassPrx(ic, p->ice_toString())->ice_batchOneway();
+        p->opByteSOnewayCallCount(); // Reset the call count
+
+        batch5->opByteSOneway(bs1);
+        batch5->opByteSOneway(bs1);
+        batch5->opByteSOneway(bs1);
+
+        count = 0;
+        for (int j = 0; j < 200 && count < 3; ++j)
+        {
+            this_thread::sleep_for(chrono::milliseconds(10));
+            count += p->opByteSOnewayCallCount();
+        }
+        test(count == 3);
+
+        batch5->opByteSOneway(bs1);
+        for (int j = 0; j < 200 && count < 4; ++j)
+        {
+            this_thread::sleep_for(chrono::milliseconds(10));
+            count += p->opByteSOnewayCallCount();
+        }
+        test(count == 4);
+
+        ic->destroy();
+    }
+
     bool supportsCompress = true;
     try
     {
@@ -214,4 +248,38 @@ batchOneways(const MyClassPrx& p)
         batch1->opByteSOneway(bs1);
         batch1->ice_getConnection()->flushBatchRequests(CompressBatch::BasedOnProxy);
     }
+    {
+        // Batch requests from several threads, each thread marshals its requests concurrently with the others and
+        // the requests are auto-flushed.
+        const int threadCount = 4;
+        const int requestCount = 50;
+
+        batch->ice_flushBatchRequests();
+        p->opByteSOnewayCallCount(); // Reset the call count
+
+        vector<thread> threads;
+        for (int j = 0; j < threadCount; ++j)
+        {
+            threads.emplace_back(
+                [&batch, &bs1]
+                {
+                    for (int k = 0; k < requestCount; ++k)
+                    {
+                        batch->opByteSOneway(bs1);
+                    }
+                });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        batch->ice_flushBatchRequests();
+
+        count = 0;
+        while (count < threadCount * requestCount)
+        {
+            count += p->opByteSOnewayCallCount();
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+    }
 }
@@ -0,0 +1,32 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+from Util import ClientAMDServerTestCase, ClientServerTestCase, CollocatedTestCase, TestSuite
+
+# Also run the client and server with thread pools split into several reactors, and with thread pools waiting for
+# socket readiness with io_uring (on Linux, the thread pools fall back to epoll if io_uring is not supported).
+reactorProps = {"Ice.ThreadPool.Client.Reactors": 2, "Ice.ThreadPool.Server.Reactors": 2}
+ioUringProps = {"Ice.ThreadPool.Client.IoUring": 1, "Ice.ThreadPool.Server.IoUring": 1}
+
+# With a small shared read buffer, most messages are larger than the read buffer and are received as before, while with
+# a large read buffer, requests and replies are dispatched from views into read buffers holding several messages.
+smallReadBufferProps = {"Ice.Connection.ReadBufferSize": 64}
+largeReadBufferProps = {"Ice.Connection.ReadBufferSize": 1024 * 1024}
+
+TestSuite(
+    __file__,
+    [
+        ClientServerTestCase(),
+        ClientAMDServerTestCase(),
+        CollocatedTestCase(),
+        ClientServerTestCase(name="client/server with reactors", props=reactorProps),
+        ClientAMDServerTestCase(name="client/amd server with reactors", props=reactorProps),
+        ClientServerTestCase(name="client/server with io_uring", props=ioUringProps),
+        ClientAMDServerTestCase(name="client/amd server with io_uring", props=ioUringProps),
+        ClientServerTestCase(name="client/server with a small read buffer", props=smallReadBufferProps),
+        ClientAMDServerTestCase(name="client/amd server with a small read buffer", props=smallReadBufferProps),
+        ClientServerTestCase(name="client/server with a large read buffer", props=largeReadBufferProps),
+        ClientAMDServerTestCase(name="client/amd server with a large read buffer", props=largeReadBufferProps),
+    ],
+)
@@ -0,0 +1,333 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+using namespace Ice;
+using namespace Test;
+
+namespace
+{
+    using Clock = chrono::steady_clock;
+
+    double seconds(Clock::duration duration) { return chrono::duration<double>(duration).count(); }
+
+    double microseconds(Clock::duration duration) { return chrono::duration<double, micro>(duration).count(); }
+
+    // Writes the results of the benchmarks as a JSON object, each result is a JSON object with numeric members.
+    class Results
+    {
+    public:
+        void begin(const string& name)
+        {
+            _out << (_first ? "" : ",") << "\n    \"" << name << "\": {";
+            _first = false;
+            _firstValue = true;
+        }
+
+        void add(const string& name, int value)
+        {
+            _out << (_firstValue ? "" : ", ") << "\"" << name << "\": " << value;
+            _firstValue = false;
+        }
+
+        void add(const string& name, double value)
+        {
+            _out << (_firstValue ? "" : ", ") << "\"" << name << "\": " << fixed << setprecision(2) << value;
+            _firstValue = false;
+        }
+
+        void end() { _out << "}"; }
+
+        string str() const { return _out.str(); }
+
+    private:
+        ostringstream _out;
+        bool _first = true;
+        bool _firstValue = true;
+    };
+
+    NodePtr makeGraph(int depth, int& count)
+    {
+        if (depth == 0)
+        {
+            return nullptr;
+        }
+        auto node = make_shared<Node>(count++, nullptr, nullptr);
+        node->left = makeGraph(depth - 1, count);
+        node->right = makeGraph(depth - 1, count);
+        return node;
+    }
+
+    // Waits for the ping count of the server to stop increasing, datagrams and oneways sent over a connection other
+    // than the one used to get the count may still be in flight.
+    int32_t waitForPingCount(const PerfPrx& perf, int32_t expected)
+    {
+        int32_t count = perf->getPingCount();
+        for (int i = 0; i < 20 && count < expected; ++i)
+        {
+            this_thread::sleep_for(chrono::milliseconds(50));
+            int32_t current = perf->getPingCount();
+            if (current == count)
+            {
+                break;
+            }
+            count = current;
+        }
+        return count;
+    }
+
+    void onewayThroughput(Results& results, const string& name, const PerfPrx& perf, const PerfPrx& prx, int count)
+    {
+        bool batch = prx->ice_isBatchOneway() || prx->ice_isBatchDatagram();
+        perf->resetPingCount();
+        auto start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            prx->ping();
+            if (batch && (i + 1) % 100 == 0)
+            {
+                prx->ice_flushBatchRequests();
+            }
+        }
+        if (batch)
+        {
+            prx->ice_flushBatchRequests();
+        }
+        // Wait for the server to dispatch the oneway requests, or at least for its ping count to stop increasing.
+        int32_t received = waitForPingCount(perf, count);
+        auto elapsed = Clock::now() - start;
+
+        results.begin(name);
+        results.add("calls", count);
+        results.add("received", received);
+        results.add("seconds", seconds(elapsed));
+        results.add("callsPerSecond", count / seconds(elapsed));
+        results.end();
+    }
+}
+
+PerfPrx
+allTests(TestHelper* helper, bool collocated)
+{
+    CommunicatorPtr communicator = helper->communicator();
+    PropertiesPtr properties = communicator->getProperties();
+    PerfPrx perf(communicator, "perf:" + helper->getTestEndpoint());
+
+    // The benchmarks run quickly by default for the test suite, set Perf.Iterations to get meaningful numbers.
+    const int iterations = max(properties->getPropertyAsIntWithDefault("Perf.Iterations", 1000), 100);
+
+    Results results;
+
+    cout << "measuring twoway latency... " << flush;
+    {
+        for (int i = 0; i < iterations / 10; ++i)
+        {
+            perf->ping(); // Warm up
+        }
+
+        vector<Clock::duration> latencies;
+        latencies.reserve(static_cast<size_t>(iterations));
+        for (int i = 0; i < iterations; ++i)
+        {
+            auto start = Clock::now();
+            perf->ping();
+            latencies.push_back(Clock::now() - start);
+        }
+        sort(latencies.begin(), latencies.end());
+
+        Clock::duration total{0};
+        for (const auto& latency : latencies)
+        {
+            total += latency;
+        }
+        auto percentile = [&latencies](double p)
+        { return microseconds(latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))]); };
+
+        results.begin("twowayLatency");
+        results.add("calls", iterations);
+        results.add("meanUs", microseconds(total) / iterations);
+        results.add("p50Us", percentile(0.5));
+        results.add("p90Us", percentile(0.9));
+        results.add("p99Us", percentile(0.99));
+        results.add("p999Us", percentile(0.999));
+        results.add("maxUs", microseconds(latencies.back()));
+        results.end();
+    }
+    cout << "ok" << endl;
+
+    cout << "measuring oneway throughput... " << flush;
+    {
+        onewayThroughput(results, "onewayThroughput", perf, perf->ice_oneway(), iterations * 10);
+        onewayThroughput(results, "batchOnewayThroughput", perf, perf->ice_batchOneway(), iterations * 10);
+    }
+    cout << "ok" << endl;
+
+    if (!collocated)
+    {
+        cout << "measuring datagram throughput... " << flush;
+        {
+            PerfPrx udp(communicator, "perf:" + helper->getTestEndpoint(0, "udp"));
+            onewayThroughput(results, "datagramThroughput", perf, udp->ice_datagram(), iterations);
+            onewayThroughput(results, "batchDatagramThroughput", perf, udp->ice_batchDatagram(), iterations * 10);
+        }
+        cout << "ok" << endl;
+    }
+
+    cout << "measuring byte sequence bandwidth... " << flush;
+    {
+        const int size = 1024 * 1024;
+        const int count = max(iterations / 100, 10);
+        const double megabytes = static_cast<double>(size) * count / (1024 * 1024);
+
+        ByteSeq seq(static_cast<size_t>(size));
+        auto start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            perf->sendByteSeq(make_pair(seq.data(), seq.data() + seq.size()));
+        }
+        auto elapsed = Clock::now() - start;
+
+        results.begin("byteSeqSend");
+        results.add("calls", count);
+        results.add("bytes", size);
+        results.add("seconds", seconds(elapsed));
+        results.add("megabytesPerSecond", megabytes / seconds(elapsed));
+        results.end();
+
+        start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            test(perf->recvByteSeq(size).size() == static_cast<size_t>(size));
+        }
+        elapsed = Clock::now() - start;
+
+        results.begin("byteSeqReceive");
+        results.add("calls", count);
+        results.add("bytes", size);
+        results.add("seconds", seconds(elapsed));
+        results.add("megabytesPerSecond", megabytes / seconds(elapsed));
+        results.end();
+    }
+    cout << "ok" << endl;
+
+    cout << "measuring chunked payload transfer... " << flush;
+    {
+        // The payload is larger than Ice.MessageSizeMax (10MB), it can only be sent in chunks. The transfer itself is
+        // tested by Ice/chunkedSend.
+        const size_t size = 32 * 1024 * 1024;
+        ByteSeq payload(size);
+
+        auto sendChunk = [&perf](
+                             int64_t offset,
+                             pair<const byte*, const byte*> chunk,
+                             function<void()> response,
+                             function<void(exception_ptr)> exception)
+        { perf->writeChunkAsync(offset, chunk, std::move(response), std::move(exception)); };
+
+        auto start = Clock::now();
+        Ice::sendChunks(make_pair(payload.data(), payload.data() + payload.size()), sendChunk);
+        auto elapsed = Clock::now() - start;
+
+        results.begin("chunkedSend");
+        results.add("bytes", static_cast<int>(size));
+        results.add("seconds", seconds(elapsed));
+        results.add("megabytesPerSecond", static_cast<double>(size) / (1024 * 1024) / seconds(elapsed));
+        results.end();
+    }
+    cout << "ok" << endl;
+
+    cout << "measuring class graph marshaling... " << flush;
+    {
+        int nodes = 0;
+        NodePtr root = makeGraph(8, nodes);
+        const int count = max(iterations / 10, 10);
+
+        auto start = Clock::now();
+        for (int i = 0; i < count; ++i)
+        {
+            NodePtr result = perf->echoGraph(root);
+            test(result && result->value == 0 && result->left && result->right);
+        }
+        auto elapsed = Clock::now() - start;
+
+        results.begin("classGraph");
+        results.add("calls", count);
+        results.add("objects", nodes);
+        results.add("seconds", seconds(elapsed));
+        results.add("callsPerSecond", count / seconds(elapsed));
+        results.add("objectsPerSecond", static_cast<double>(count) * nodes / seconds(elapsed));
+        results.end();
+    }
+    cout << "ok" << endl;
+
+    cout << "measuring AMI fan-out... " << flush;
+    {
+        const int fanOut = 32;
+        const int rounds = max(iterations / fanOut, 10);
+
+        vector<future<void>> futures;
+        futures.reserve(fanOut);
+        auto start = Clock::now();
+        for (int i = 0; i < rounds; ++i)
+        {
+            for (int j = 0; j < fanOut; ++j)
+            {
+                futures.push_back(perf->pingAsync());
+            }
+            for (auto& f : futures)
+            {
+                f.get();
+            }
+            futures.clear();
+        }
+        auto elapsed = Clock::now() - start;
+
+        results.begin("amiFanOut");
+        results.add("calls", rounds * fanOut);
+        results.add("fanOut", fanOut);
+        results.add("seconds", seconds(elapsed));
+        results.add("callsPerSecond", rounds * fanOut / seconds(elapsed));
+        results.end();
+    }
+    cout << "ok" << endl;
+
+    // Set Perf.Output to write the results as JSON, to compare results between builds or releases. The results are
+    // written to the given file, or to the standard output with "-".
+    string output = properties->getProperty("Perf.Output");
+    if (!output.empty())
+    {
+        ostringstream os;
+        os << "{\n";
+        os << "  \"protocol\": \"" << helper->getTestProtocol() << "\",\n";
+        os << "  \"collocated\": " << (collocated ? "true" : "false") << ",\n";
+        os << "  \"iterations\": " << iterations << ",\n";
+        os << "  \"results\": {" << results.str() << "\n  }\n";
+        os << "}\n";
+
+        if (output == "-")
+        {
+            cout << os.str() << flush;
+        }
+        else
+        {
+            ofstream out(output);
+            test(out.good());
+            out << os.str();
+        }
+    }
+
+    return perf;
+}
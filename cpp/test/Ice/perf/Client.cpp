@@ -0,0 +1,31 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+using namespace std;
+
+class Client : public Test::TestHelper
+{
+public:
+    void run(int, char**);
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    // Perf.Iterations and Perf.Output can be set on the command line, e.g. --Perf.Output=results.json.
+    Ice::StringSeq args = properties->parseCommandLineOptions("Perf", Ice::argsToStringSeq(argc, argv));
+    Ice::stringSeqToArgs(args, argc, argv);
+    properties->setProperty("Ice.MessageSizeMax", "10240"); // 10MB
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    Test::PerfPrx allTests(Test::TestHelper*, bool);
+    Test::PerfPrx perf = allTests(this, false);
+    perf->shutdown();
+}
+
+DEFINE_TEST(Client)
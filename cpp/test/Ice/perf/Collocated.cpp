@@ -0,0 +1,37 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+#include "TestI.h"
+
+using namespace std;
+
+class Collocated : public Test::TestHelper
+{
+public:
+    void run(int, char**);
+};
+
+void
+Collocated::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    // Perf.Iterations and Perf.Output can be set on the command line, e.g. --Perf.Output=results.json.
+    Ice::StringSeq args = properties->parseCommandLineOptions("Perf", Ice::argsToStringSeq(argc, argv));
+    Ice::stringSeqToArgs(args, argc, argv);
+    properties->setProperty("Ice.MessageSizeMax", "10240"); // 10MB
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    Ice::ObjectPrx prx = adapter->add(std::make_shared<PerfI>(), Ice::stringToIdentity("perf"));
+    // adapter->activate(); // Don't activate OA to ensure collocation is used.
+
+    test(!prx->ice_getConnection());
+
+    Test::PerfPrx allTests(Test::TestHelper*, bool);
+    allTests(this, true);
+}
+
+DEFINE_TEST(Collocated)
@@ -0,0 +1,5 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+tests += $(test)
@@ -0,0 +1,34 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+#include "TestI.h"
+
+using namespace std;
+
+class Server : public Test::TestHelper
+{
+public:
+    void run(int, char**);
+};
+
+void
+Server::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    properties->setProperty("Ice.MessageSizeMax", "10240"); // 10MB
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    // The UDP endpoint is used for the datagram benchmarks, with any test protocol.
+    communicator->getProperties()->setProperty(
+        "TestAdapter.Endpoints",
+        getTestEndpoint() + ":" + getTestEndpoint(0, "udp"));
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(std::make_shared<PerfI>(), Ice::stringToIdentity("perf"));
+    adapter->activate();
+    serverReady();
+    communicator->waitForShutdown();
+}
+
+DEFINE_TEST(Server)
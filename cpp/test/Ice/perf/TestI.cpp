@@ -0,0 +1,54 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include "TestI.h"
+
+using namespace std;
+using namespace Test;
+
+void
+PerfI::ping(const Ice::Current&)
+{
+    ++_pingCount;
+}
+
+int32_t
+PerfI::getPingCount(const Ice::Current&)
+{
+    return _pingCount;
+}
+
+void
+PerfI::resetPingCount(const Ice::Current&)
+{
+    _pingCount = 0;
+}
+
+void
+PerfI::sendByteSeq(pair<const byte*, const byte*>, const Ice::Current&)
+{
+}
+
+ByteSeq
+PerfI::recvByteSeq(int32_t size, const Ice::Current&)
+{
+    return ByteSeq(static_cast<size_t>(size));
+}
+
+void
+PerfI::writeChunk(int64_t, pair<const byte*, const byte*>, const Ice::Current&)
+{
+}
+
+NodePtr
+PerfI::echoGraph(NodePtr root, const Ice::Current&)
+{
+    return root;
+}
+
+void
+PerfI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
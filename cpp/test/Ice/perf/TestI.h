@@ -0,0 +1,35 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+#include <atomic>
+
+class PerfI final : public Test::Perf
+{
+public:
+    void ping(const Ice::Current&) final;
+
+    std::int32_t getPingCount(const Ice::Current&) final;
+
+    void resetPingCount(const Ice::Current&) final;
+
+    void sendByteSeq(std::pair<const std::byte*, const std::byte*>, const Ice::Current&) final;
+
+    Test::ByteSeq recvByteSeq(std::int32_t, const Ice::Current&) final;
+
+    void writeChunk(std::int64_t, std::pair<const std::byte*, const std::byte*>, const Ice::Current&) final;
+
+    Test::NodePtr echoGraph(Test::NodePtr, const Ice::Current&) final;
+
+    void shutdown(const Ice::Current&) final;
+
+private:
+    std::atomic<std::int32_t> _pingCount{0};
+};
+
+#endif
@@ -507,6 +507,13 @@ allTests(TestHelper* helper)
     test(!b1->ice_isConnectionCached());
     prop->setProperty(property, "");
 
+    property = propertyPrefix + ".ConnectionPoolSize";
+    test(b1->ice_getConnectionPoolSize() == 1);
+    prop->setProperty(property, "4");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getConnectionPoolSize() == 4);
+    prop->setProperty(property, "");
+
     property = propertyPrefix + ".InvocationTimeout";
     test(b1->ice_getInvocationTimeout() == -1);
     prop->setProperty(property, "1000");
@@ -557,6 +564,7 @@ allTests(TestHelper* helper)
     b1 = b1->ice_endpointSelection(Ice::EndpointSelectionType::Ordered);
     b1 = b1->ice_locatorCacheTimeout(100);
     b1 = b1->ice_invocationTimeout(1234);
+    b1 = b1->ice_connectionPoolSize(4);
     Ice::EncodingVersion v = {1, 0};
     b1 = b1->ice_encodingVersion(v);
 
@@ -580,7 +588,7 @@ allTests(TestHelper* helper)
     b1 = b1->ice_locator(locator);
 
     Ice::PropertyDict proxyProps = communicator->proxyToProperty(b1, "Test");
-    test(proxyProps.size() == 21);
+    test(proxyProps.size() == 24);
 
     test(proxyProps["Test"] == "test -t -e 1.0");
     test(proxyProps["Test.CollocationOptimized"] == "1");
@@ -589,6 +597,7 @@ allTests(TestHelper* helper)
     test(proxyProps["Test.EndpointSelection"] == "Ordered");
     test(proxyProps["Test.LocatorCacheTimeout"] == "100");
     test(proxyProps["Test.InvocationTimeout"] == "1234");
+    test(proxyProps["Test.ConnectionPoolSize"] == "4");
 
     test(proxyProps["Test.Locator"] == "locator -t -e " + Ice::encodingVersionToString(Ice::currentEncoding));
     // Locator collocation optimization is always disabled.
@@ -598,6 +607,7 @@ allTests(TestHelper* helper)
     test(proxyProps["Test.Locator.EndpointSelection"] == "Random");
     test(proxyProps["Test.Locator.LocatorCacheTimeout"] == "300");
     test(proxyProps["Test.Locator.InvocationTimeout"] == "1500");
+    test(proxyProps["Test.Locator.ConnectionPoolSize"] == "1");
 
     test(proxyProps["Test.Locator.Router"] == "router -t -e " + Ice::encodingVersionToString(Ice::currentEncoding));
     test(proxyProps["Test.Locator.Router.CollocationOptimized"] == "0");
@@ -689,6 +699,16 @@ allTests(TestHelper* helper)
     {
     }
 
+    test(base->ice_connectionPoolSize(3)->ice_getConnectionPoolSize() == 3);
+    try
+    {
+        base->ice_connectionPoolSize(0);
+        test(false);
+    }
+    catch (const invalid_argument&)
+    {
+    }
+
     cout << "ok" << endl;
 
     cout << "testing proxy comparison... " << flush;
@@ -719,6 +739,11 @@ allTests(TestHelper* helper)
     test(compObj->ice_connectionCached(false) < compObj->ice_connectionCached(true));
     test(compObj->ice_connectionCached(true) >= compObj->ice_connectionCached(false));
 
+    test(compObj->ice_connectionPoolSize(2) == compObj->ice_connectionPoolSize(2));
+    test(compObj->ice_connectionPoolSize(1) != compObj->ice_connectionPoolSize(2));
+    test(compObj->ice_connectionPoolSize(1) < compObj->ice_connectionPoolSize(2));
+    test(compObj->ice_connectionPoolSize(2) >= compObj->ice_connectionPoolSize(1));
+
     test(
         compObj->ice_endpointSelection(Ice::EndpointSelectionType::Random) ==
         compObj->ice_endpointSelection(Ice::EndpointSelectionType::Random));
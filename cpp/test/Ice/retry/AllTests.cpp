@@ -64,7 +64,11 @@ public:
 using CallbackFailPtr = shared_ptr<CallbackFail>;
 
 RetryPrx
-allTests(const Ice::CommunicatorPtr& communicator, const Ice::CommunicatorPtr& communicator2, const string& ref)
+allTests(
+    const Ice::CommunicatorPtr& communicator,
+    const Ice::CommunicatorPtr& communicator2,
+    const Ice::CommunicatorPtr& communicator3,
+    const string& ref)
 {
     RetryPrx retry1(communicator, ref);
     RetryPrx retry2(communicator, ref);
@@ -254,5 +258,43 @@ allTests(const Ice::CommunicatorPtr& communicator, const Ice::CommunicatorPtr& c
         cout << "ok" << endl;
     }
 
+    {
+        cout << "testing hedged invocations... " << flush;
+        RetryPrx retry3(communicator3, ref);
+
+        // Record enough latencies to compute the hedging delay.
+        for (int i = 0; i < 32; ++i)
+        {
+            test(!retry3->opHedged(0));
+        }
+
+        // The first request sleeps and the reply of its duplicate completes the invocation.
+        test(!retry3->opHedged(2000));
+        test(!retry3->opHedgedAsync(2000).get());
+
+        Ice::EndpointSeq endpoints = retry3->ice_getEndpoints();
+        if (!endpoints.empty())
+        {
+            // The latencies are recorded for each target: the same operation on other endpoints isn't hedged until
+            // enough latencies are recorded for these endpoints.
+            test(!retry3->opHedged(0));
+            RetryPrx other = retry3->ice_endpoints({endpoints[0], endpoints[0]});
+            test(other->opHedged(200));
+
+            // The hedged invocations are limited by the hedging budget.
+            Ice::InitializationData initData;
+            initData.properties = communicator3->getProperties()->clone();
+            initData.properties->setProperty("Ice.Hedging.Budget", "0");
+            Ice::CommunicatorHolder ich(initData);
+            RetryPrx retry4(ich.communicator(), ref);
+            for (int i = 0; i < 32; ++i)
+            {
+                test(!retry4->opHedged(0));
+            }
+            test(retry4->opHedged(200));
+        }
+        cout << "ok" << endl;
+    }
+
     return retry1;
 }
@@ -45,10 +45,24 @@ Client::run(int argc, char** argv)
     initData.observer = getObserver();
     Ice::CommunicatorHolder ich2 = Ice::initialize(initData);
 
-    RetryPrx allTests(const Ice::CommunicatorPtr&, const Ice::CommunicatorPtr&, const string&);
+    //
+    // Configure a third communicator for the hedging test.
+    //
+    initData.properties = initData.properties->clone();
+    initData.properties->setProperty("Ice.Hedging.Percentile", "90");
+    initData.properties->setProperty("Ice.Hedging.MinDelay", "10");
+    initData.observer = nullptr;
+    Ice::CommunicatorHolder ich3 = Ice::initialize(initData);
+
+    RetryPrx allTests(
+        const Ice::CommunicatorPtr&,
+        const Ice::CommunicatorPtr&,
+        const Ice::CommunicatorPtr&,
+        const string&);
     RetryPrx retry = allTests(
         ich1.communicator(),
         ich2.communicator(),
+        ich3.communicator(),
         "retry:" + TestHelper::getTestEndpoint(ich1->getProperties()));
     retry->shutdown();
 }
@@ -55,11 +55,27 @@ Collocated::run(int argc, char** argv)
 
     Ice::CommunicatorHolder ich2 = Ice::initialize(initData);
 
+    //
+    // Configure a third communicator for the hedging test, the requests of hedged invocations are dispatched
+    // concurrently.
+    //
+    initData.properties = initData.properties->clone();
+    initData.properties->setProperty("Ice.Hedging.Percentile", "90");
+    initData.properties->setProperty("Ice.Hedging.MinDelay", "10");
+    initData.properties->setProperty("Ice.ThreadPool.Server.Size", "3");
+    initData.observer = nullptr;
+    Ice::CommunicatorHolder ich3 = Ice::initialize(initData);
+
     setupObjectAdapter(ich1.communicator());
     setupObjectAdapter(ich2.communicator());
+    setupObjectAdapter(ich3.communicator());
 
-    RetryPrx allTests(const Ice::CommunicatorPtr&, const Ice::CommunicatorPtr&, const string&);
-    RetryPrx retry = allTests(ich1.communicator(), ich2.communicator(), "retry");
+    RetryPrx allTests(
+        const Ice::CommunicatorPtr&,
+        const Ice::CommunicatorPtr&,
+        const Ice::CommunicatorPtr&,
+        const string&);
+    RetryPrx retry = allTests(ich1.communicator(), ich2.communicator(), ich3.communicator(), "retry");
     retry->shutdown();
 }
 
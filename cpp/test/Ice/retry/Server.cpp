@@ -21,6 +21,8 @@ Server::run(int argc, char** argv)
     properties->setProperty("Ice.Warn.Dispatch", "0");
     properties->setProperty("Ice.Warn.Connections", "0");
     properties->setProperty("Ice.PrintStackTraces", "0");
+    // The requests of hedged invocations are dispatched concurrently.
+    properties->setProperty("Ice.ThreadPool.Server.Size", "3");
     Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
 
     communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
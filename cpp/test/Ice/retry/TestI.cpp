@@ -9,7 +9,7 @@
 #include <thread>
 using namespace std;
 
-RetryI::RetryI() : _counter(0) {}
+RetryI::RetryI() : _counter(0), _hedgedCounter(0) {}
 
 void
 RetryI::op(bool kill, const Ice::Current& current)
@@ -58,6 +58,23 @@ RetryI::sleep(int delay, const Ice::Current&)
     this_thread::sleep_for(chrono::milliseconds(delay));
 }
 
+bool
+RetryI::opHedged(int delay, const Ice::Current&)
+{
+    // Every other request sleeps: the first request of a hedged invocation sleeps and its duplicate doesn't. A
+    // request without delay resets the count.
+    if (delay == 0)
+    {
+        _hedgedCounter = 0;
+    }
+    else if (++_hedgedCounter % 2 == 1)
+    {
+        this_thread::sleep_for(chrono::milliseconds(delay));
+        return true;
+    }
+    return false;
+}
+
 void
 RetryI::shutdown(const Ice::Current& current)
 {
@@ -7,6 +7,8 @@
 
 #include "Test.h"
 
+#include <atomic>
+
 class RetryI : public Test::Retry
 {
 public:
@@ -16,10 +18,12 @@ public:
     virtual int opIdempotent(int, const Ice::Current&);
     virtual void opNotIdempotent(const Ice::Current&);
     virtual void sleep(int, const Ice::Current&);
+    virtual bool opHedged(int, const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 
 private:
     int _counter;
+    std::atomic<int> _hedgedCounter;
 };
 
 #endif
@@ -6,6 +6,7 @@
 #    pragma warning(disable : 4244) // '=': conversion from 'int' to 'int16_t', possible loss of data
 #endif
 
+#include "../../../src/Ice/Endian.h"
 #include "Ice/Ice.h"
 #include "Test.h"
 #include "TestHelper.h"
@@ -611,6 +612,65 @@ allTests(Test::TestHelper* helper)
         in2.read(arr2S);
     }
 
+    {
+        test(!Ice::IsBitwiseStreamable<LargeStruct>::value);
+        test(!Ice::IsBitwiseStreamable<PaddedStruct>::value);
+        if constexpr (endian::native == endian::little)
+        {
+            test(Ice::IsBitwiseStreamable<Point>::value);
+            test(Ice::IsBitwiseStreamable<Tick>::value);
+        }
+
+        TickS arr;
+        for (int i = 0; i < 100; ++i)
+        {
+            arr.push_back(Tick{i * 1000, i, static_cast<float>(i) / 2, Point{static_cast<double>(i), -1.5 * i}});
+        }
+
+        // The sequence of ticks is preceded by 0 to 7 bytes to test aligned and unaligned in-place reads.
+        for (int offset = 0; offset < 8; ++offset)
+        {
+            Ice::OutputStream out(communicator);
+            for (int i = 0; i < offset; ++i)
+            {
+                out.write(static_cast<uint8_t>(i));
+            }
+            out.write(arr);
+            out.write(PointS());
+            out.finished(data);
+            test(data.size() == static_cast<size_t>(offset) + 1 + arr.size() * 32 + 1);
+
+            Ice::InputStream in(communicator, data);
+            in.skip(static_cast<size_t>(offset));
+            TickS arr2;
+            in.read(arr2);
+            test(arr2 == arr);
+
+            Ice::InputStream in2(communicator, data);
+            in2.skip(static_cast<size_t>(offset));
+            pair<const Tick*, const Tick*> arr3;
+            in2.read(arr3);
+            test(TickS(arr3.first, arr3.second) == arr);
+            pair<const Point*, const Point*> arr4;
+            in2.read(arr4);
+            test(arr4.first == nullptr && arr4.second == nullptr);
+        }
+
+        PaddedStructS arr5;
+        for (int i = 0; i < 10; ++i)
+        {
+            arr5.push_back(PaddedStruct{static_cast<uint8_t>(i), i * 10});
+        }
+        Ice::OutputStream out(communicator);
+        out.write(arr5);
+        out.finished(data);
+        test(data.size() == 1 + arr5.size() * 5);
+        Ice::InputStream in(communicator, data);
+        PaddedStructS arr6;
+        in.read(arr6);
+        test(arr6 == arr5);
+    }
+
     {
         MyClassS arr;
         for (int i = 0; i < 4; ++i)
@@ -199,11 +199,6 @@ main(int argc, char* argv[])
             test(ws.length() == 3);
         }
 
-        // The Unicode string converter implementation allocates an initial buffer
-        // of size max(2 * (sourceEnd - sourceStart), 4).
-        // With UTF-16 encoding, that's 8 and the first 2 euros will use the first 6
-        // bytes of the initial buffer.
-
         string ns = wstringToString(ws);
 
         const string good = "\xE2\x82\xAC\xE2\x82\xAC\xF0\x90\x90\xB7";
@@ -235,6 +230,26 @@ main(int argc, char* argv[])
         test(nu8 == u8);
 
         cout << "ok" << endl;
+
+        cout << "testing long strings with ASCII and non-ASCII characters... ";
+
+        // Place the non-ASCII characters at every offset of the 16 and 32 byte blocks scanned for ASCII characters.
+        for (size_t prefix = 0; prefix < 70; ++prefix)
+        {
+            string s = string(prefix, 'a') + good + string(prefix % 37, 'b') + good + string(prefix, 'c');
+            wstring w = stringToWstring(s);
+            test(w.size() == 2 * prefix + prefix % 37 + 2 * ws.size());
+            test(w.substr(prefix, ws.size()) == ws);
+            test(wstringToString(w) == s);
+
+            vector<uint8_t> v(
+                reinterpret_cast<const uint8_t*>(s.data()),
+                reinterpret_cast<const uint8_t*>(s.data() + s.size()));
+            test(IceInternal::toUTF16(v).size() == 2 * prefix + prefix % 37 + 8);
+            test(IceInternal::fromUTF32(IceInternal::toUTF32(v)) == v);
+        }
+
+        cout << "ok" << endl;
     }
 
     {
@@ -252,6 +267,12 @@ main(int argc, char* argv[])
             "\xf0\x28\x8c\x28",
             "\xf8\xa1\xa1\xa1\xa1",
             "\xfc\xa1\xa1\xa1\xa1\xa1",
+            "\xc0\xaf",         // overlong encoding of '/'
+            "\xe0\x80\xaf",     // overlong encoding of '/'
+            "\xf0\x82\x82\xac", // overlong encoding of the euro sign
+            "\xed\xa0\x80",     // encoded surrogate U+D800
+            "\xf4\x90\x80\x80", // U+110000
+            "abcdefghijklmnopqrstuvwxyz0123456789\xe2\x82", // truncated sequence after ASCII characters
             ""};
 
         for (size_t i = 0; badUTF8[i] != ""; ++i)
@@ -267,25 +288,37 @@ main(int argc, char* argv[])
             }
         }
 
-        // TODO: need test for bad UTF-32 strings
-#ifdef _WIN32
-
-        // Note: for an unknown reason, the conversion works without
-        // the extra letter (x below) when using codecvt_utf8_utf16.
-        wstring badWstring[] = {wstring(1, wchar_t(0xD800)) + L"x", wstring(2, wchar_t(0xDB7F)), L""};
+        vector<wstring> badWstring = {wstring(1, wchar_t(0xD800)) + L"x", wstring(2, wchar_t(0xDB7F))};
+        if (sizeof(wchar_t) == 2)
+        {
+            badWstring.push_back(L"x" + wstring(1, wchar_t(0xDC37))); // low surrogate without high surrogate
+        }
+        else
+        {
+            badWstring.push_back(wstring(1, static_cast<wchar_t>(0x110000)));
+        }
 
-        for (size_t i = 0; badWstring[i] != L""; ++i)
+        for (const auto& w : badWstring)
         {
             try
             {
-                string s = wstringToString(badWstring[i]);
+                string s = wstringToString(w);
                 test(false);
             }
             catch (const Ice::IllegalConversionException&)
             {
             }
         }
-#endif
+
+        vector<unsigned int> badUTF32 = {0x41, 0xD800, 0x41};
+        try
+        {
+            IceInternal::fromUTF32(badUTF32);
+            test(false);
+        }
+        catch (const Ice::IllegalConversionException&)
+        {
+        }
 
         cout << "ok" << endl;
     }
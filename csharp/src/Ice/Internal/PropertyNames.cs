@@ -14,14 +14,27 @@ public sealed class PropertyNames
          new(@"Ice.Admin.AdapterId", false, "", false),
          new(@"Ice.Admin.Connection.CloseTimeout", false, "10", false),
          new(@"Ice.Admin.Connection.ConnectTimeout", false, "10", false),
+         new(@"Ice.Admin.Connection.CorkDelay", false, "100", false),
+         new(@"Ice.Admin.Connection.CorkSize", false, "0", false),
          new(@"Ice.Admin.Connection.EnableIdleCheck", false, "1", false),
          new(@"Ice.Admin.Connection.IdleTimeout", false, "60", false),
          new(@"Ice.Admin.Connection.InactivityTimeout", false, "300", false),
          new(@"Ice.Admin.Connection.MaxDispatches", false, "100", false),
+         new(@"Ice.Admin.Connection.ReadBufferSize", false, "0", false),
          new(@"Ice.Admin.Connection", false, "", false),
+         new(@"Ice.Admin.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"Ice.Admin.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"Ice.Admin.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"Ice.Admin.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"Ice.Admin.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"Ice.Admin.Dispatch.Deadline", false, "0", false),
+         new(@"Ice.Admin.Dispatch.Executor", false, "", false),
+         new(@"Ice.Admin.Dispatch.MaxDispatches", false, "0", false),
+         new(@"Ice.Admin.Dispatch.Size", false, "0", false),
          new(@"Ice.Admin.Endpoints", false, "", false),
          new(@"Ice.Admin.Locator.EndpointSelection", false, "", false),
          new(@"Ice.Admin.Locator.ConnectionCached", false, "", false),
+         new(@"Ice.Admin.Locator.ConnectionPoolSize", false, "", false),
          new(@"Ice.Admin.Locator.PreferSecure", false, "", false),
          new(@"Ice.Admin.Locator.LocatorCacheTimeout", false, "", false),
          new(@"Ice.Admin.Locator.InvocationTimeout", false, "", false),
@@ -34,6 +47,7 @@ public sealed class PropertyNames
          new(@"Ice.Admin.ReplicaGroupId", false, "", false),
          new(@"Ice.Admin.Router.EndpointSelection", false, "", false),
          new(@"Ice.Admin.Router.ConnectionCached", false, "", false),
+         new(@"Ice.Admin.Router.ConnectionPoolSize", false, "", false),
          new(@"Ice.Admin.Router.PreferSecure", false, "", false),
          new(@"Ice.Admin.Router.LocatorCacheTimeout", false, "", false),
          new(@"Ice.Admin.Router.InvocationTimeout", false, "", false),
@@ -50,6 +64,8 @@ public sealed class PropertyNames
          new(@"Ice.Admin.ThreadPool.Serialize", false, "0", false),
          new(@"Ice.Admin.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"Ice.Admin.ThreadPool.ThreadPriority", false, "", false),
+         new(@"Ice.Admin.ThreadPool.Reactors", false, "1", false),
+         new(@"Ice.Admin.ThreadPool.IoUring", false, "0", false),
          new(@"Ice.Admin.MessageSizeMax", false, "", false),
          new(@"Ice.Admin.DelayCreation", false, "0", false),
          new(@"Ice.Admin.Enabled", false, "", false),
@@ -61,25 +77,32 @@ public sealed class PropertyNames
          new(@"Ice.Admin.ServerId", false, "", false),
          new(@"Ice.BackgroundLocatorCacheUpdates", false, "0", false),
          new(@"Ice.BatchAutoFlush", false, "", true),
+         new(@"Ice.BatchAutoFlushDelay", false, "0", false),
          new(@"Ice.BatchAutoFlushSize", false, "1024", false),
          new(@"Ice.ChangeUser", false, "", false),
          new(@"Ice.ClassGraphDepthMax", false, "10", false),
+         new(@"Ice.Compression.Codecs", false, "zstd lz4 bzip2", false),
          new(@"Ice.Compression.Level", false, "1", false),
          new(@"Ice.Config", false, "", false),
          new(@"Ice.Connection.CloseTimeout", false, "10", false),
          new(@"Ice.Connection.ConnectTimeout", false, "10", false),
+         new(@"Ice.Connection.CorkDelay", false, "100", false),
+         new(@"Ice.Connection.CorkSize", false, "0", false),
          new(@"Ice.Connection.EnableIdleCheck", false, "1", false),
          new(@"Ice.Connection.IdleTimeout", false, "60", false),
          new(@"Ice.Connection.InactivityTimeout", false, "300", false),
          new(@"Ice.Connection.MaxDispatches", false, "100", false),
+         new(@"Ice.Connection.ReadBufferSize", false, "0", false),
          new(@"Ice.Connection", false, "", false),
          new(@"Ice.ConsoleListener", false, "1", false),
          new(@"Ice.Default.CollocationOptimized", false, "1", false),
+         new(@"Ice.Default.ConnectionPoolSize", false, "1", false),
          new(@"Ice.Default.EncodingVersion", false, "1.1", false),
          new(@"Ice.Default.EndpointSelection", false, "Random", false),
          new(@"Ice.Default.Host", false, "", false),
          new(@"Ice.Default.Locator.EndpointSelection", false, "", false),
          new(@"Ice.Default.Locator.ConnectionCached", false, "", false),
+         new(@"Ice.Default.Locator.ConnectionPoolSize", false, "", false),
          new(@"Ice.Default.Locator.PreferSecure", false, "", false),
          new(@"Ice.Default.Locator.LocatorCacheTimeout", false, "", false),
          new(@"Ice.Default.Locator.InvocationTimeout", false, "", false),
@@ -95,6 +118,7 @@ public sealed class PropertyNames
          new(@"Ice.Default.Protocol", false, "tcp", false),
          new(@"Ice.Default.Router.EndpointSelection", false, "", false),
          new(@"Ice.Default.Router.ConnectionCached", false, "", false),
+         new(@"Ice.Default.Router.ConnectionPoolSize", false, "", false),
          new(@"Ice.Default.Router.PreferSecure", false, "", false),
          new(@"Ice.Default.Router.LocatorCacheTimeout", false, "", false),
          new(@"Ice.Default.Router.InvocationTimeout", false, "", false),
@@ -108,6 +132,9 @@ public sealed class PropertyNames
          new(@"Ice.Default.Timeout", false, "60000", false),
          new(@"Ice.EventLog.Source", false, "", false),
          new(@"Ice.FactoryAssemblies", false, "", false),
+         new(@"Ice.Hedging.Budget", false, "10", false),
+         new(@"Ice.Hedging.MinDelay", false, "1", false),
+         new(@"Ice.Hedging.Percentile", false, "0", false),
          new(@"Ice.HTTPProxyHost", false, "", false),
          new(@"Ice.HTTPProxyPort", false, "1080", false),
          new(@"Ice.ImplicitContext", false, "None", false),
@@ -133,6 +160,7 @@ public sealed class PropertyNames
          new(@"Ice.PrintProcessId", false, "", false),
          new(@"Ice.PrintStackTraces", false, "0", false),
          new(@"Ice.ProgramName", false, "", false),
+         new(@"Ice.PropagateDeadline", false, "0", false),
          new(@"Ice.RetryIntervals", false, "0", false),
          new(@"Ice.ServerIdleTime", false, "0", false),
          new(@"Ice.SOCKSProxyHost", false, "", false),
@@ -147,6 +175,8 @@ public sealed class PropertyNames
          new(@"Ice.ThreadPool.Client.Serialize", false, "0", false),
          new(@"Ice.ThreadPool.Client.ThreadIdleTime", false, "60", false),
          new(@"Ice.ThreadPool.Client.ThreadPriority", false, "", false),
+         new(@"Ice.ThreadPool.Client.Reactors", false, "1", false),
+         new(@"Ice.ThreadPool.Client.IoUring", false, "0", false),
          new(@"Ice.ThreadPool.Server.Size", false, "1", false),
          new(@"Ice.ThreadPool.Server.SizeMax", false, "", false),
          new(@"Ice.ThreadPool.Server.SizeWarn", false, "0", false),
@@ -154,6 +184,8 @@ public sealed class PropertyNames
          new(@"Ice.ThreadPool.Server.Serialize", false, "0", false),
          new(@"Ice.ThreadPool.Server.ThreadIdleTime", false, "60", false),
          new(@"Ice.ThreadPool.Server.ThreadPriority", false, "", false),
+         new(@"Ice.ThreadPool.Server.Reactors", false, "1", false),
+         new(@"Ice.ThreadPool.Server.IoUring", false, "0", false),
          new(@"Ice.ThreadPriority", false, "", false),
          new(@"Ice.ToStringMode", false, "Unicode", false),
          new(@"Ice.Trace.Admin.Properties", false, "0", false),
@@ -189,6 +221,8 @@ public sealed class PropertyNames
          new(@"^IceMX\.Metrics\.[^\s]+\.GroupBy$", true, "", false),
          new(@"^IceMX\.Metrics\.[^\s]+\.Map$", true, "", false),
          new(@"^IceMX\.Metrics\.[^\s]+\.RetainDetached$", true, "10", false),
+         new(@"^IceMX\.Metrics\.[^\s]+\.Histogram\.Min$", true, "1", false),
+         new(@"^IceMX\.Metrics\.[^\s]+\.Histogram\.Max$", true, "1073741824", false),
          new(@"^IceMX\.Metrics\.[^\s]+\.Accept$", true, "", false),
          new(@"^IceMX\.Metrics\.[^\s]+\.Reject$", true, "", false),
          new(@"^IceMX\.Metrics\.[^\s]+$", true, "", false),
@@ -199,14 +233,27 @@ public sealed class PropertyNames
          new(@"IceDiscovery.Multicast.AdapterId", false, "", false),
          new(@"IceDiscovery.Multicast.Connection.CloseTimeout", false, "10", false),
          new(@"IceDiscovery.Multicast.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceDiscovery.Multicast.Connection.CorkDelay", false, "100", false),
+         new(@"IceDiscovery.Multicast.Connection.CorkSize", false, "0", false),
          new(@"IceDiscovery.Multicast.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceDiscovery.Multicast.Connection.IdleTimeout", false, "60", false),
          new(@"IceDiscovery.Multicast.Connection.InactivityTimeout", false, "300", false),
          new(@"IceDiscovery.Multicast.Connection.MaxDispatches", false, "100", false),
+         new(@"IceDiscovery.Multicast.Connection.ReadBufferSize", false, "0", false),
          new(@"IceDiscovery.Multicast.Connection", false, "", false),
+         new(@"IceDiscovery.Multicast.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceDiscovery.Multicast.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceDiscovery.Multicast.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceDiscovery.Multicast.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceDiscovery.Multicast.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceDiscovery.Multicast.Dispatch.Deadline", false, "0", false),
+         new(@"IceDiscovery.Multicast.Dispatch.Executor", false, "", false),
+         new(@"IceDiscovery.Multicast.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceDiscovery.Multicast.Dispatch.Size", false, "0", false),
          new(@"IceDiscovery.Multicast.Endpoints", false, "", false),
          new(@"IceDiscovery.Multicast.Locator.EndpointSelection", false, "", false),
          new(@"IceDiscovery.Multicast.Locator.ConnectionCached", false, "", false),
+         new(@"IceDiscovery.Multicast.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceDiscovery.Multicast.Locator.PreferSecure", false, "", false),
          new(@"IceDiscovery.Multicast.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceDiscovery.Multicast.Locator.InvocationTimeout", false, "", false),
@@ -219,6 +266,7 @@ public sealed class PropertyNames
          new(@"IceDiscovery.Multicast.ReplicaGroupId", false, "", false),
          new(@"IceDiscovery.Multicast.Router.EndpointSelection", false, "", false),
          new(@"IceDiscovery.Multicast.Router.ConnectionCached", false, "", false),
+         new(@"IceDiscovery.Multicast.Router.ConnectionPoolSize", false, "", false),
          new(@"IceDiscovery.Multicast.Router.PreferSecure", false, "", false),
          new(@"IceDiscovery.Multicast.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceDiscovery.Multicast.Router.InvocationTimeout", false, "", false),
@@ -235,18 +283,33 @@ public sealed class PropertyNames
          new(@"IceDiscovery.Multicast.ThreadPool.Serialize", false, "0", false),
          new(@"IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceDiscovery.Multicast.ThreadPool.Reactors", false, "1", false),
+         new(@"IceDiscovery.Multicast.ThreadPool.IoUring", false, "0", false),
          new(@"IceDiscovery.Multicast.MessageSizeMax", false, "", false),
          new(@"IceDiscovery.Reply.AdapterId", false, "", false),
          new(@"IceDiscovery.Reply.Connection.CloseTimeout", false, "10", false),
          new(@"IceDiscovery.Reply.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceDiscovery.Reply.Connection.CorkDelay", false, "100", false),
+         new(@"IceDiscovery.Reply.Connection.CorkSize", false, "0", false),
          new(@"IceDiscovery.Reply.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceDiscovery.Reply.Connection.IdleTimeout", false, "60", false),
          new(@"IceDiscovery.Reply.Connection.InactivityTimeout", false, "300", false),
          new(@"IceDiscovery.Reply.Connection.MaxDispatches", false, "100", false),
+         new(@"IceDiscovery.Reply.Connection.ReadBufferSize", false, "0", false),
          new(@"IceDiscovery.Reply.Connection", false, "", false),
+         new(@"IceDiscovery.Reply.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceDiscovery.Reply.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceDiscovery.Reply.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceDiscovery.Reply.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceDiscovery.Reply.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceDiscovery.Reply.Dispatch.Deadline", false, "0", false),
+         new(@"IceDiscovery.Reply.Dispatch.Executor", false, "", false),
+         new(@"IceDiscovery.Reply.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceDiscovery.Reply.Dispatch.Size", false, "0", false),
          new(@"IceDiscovery.Reply.Endpoints", false, "", false),
          new(@"IceDiscovery.Reply.Locator.EndpointSelection", false, "", false),
          new(@"IceDiscovery.Reply.Locator.ConnectionCached", false, "", false),
+         new(@"IceDiscovery.Reply.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceDiscovery.Reply.Locator.PreferSecure", false, "", false),
          new(@"IceDiscovery.Reply.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceDiscovery.Reply.Locator.InvocationTimeout", false, "", false),
@@ -259,6 +322,7 @@ public sealed class PropertyNames
          new(@"IceDiscovery.Reply.ReplicaGroupId", false, "", false),
          new(@"IceDiscovery.Reply.Router.EndpointSelection", false, "", false),
          new(@"IceDiscovery.Reply.Router.ConnectionCached", false, "", false),
+         new(@"IceDiscovery.Reply.Router.ConnectionPoolSize", false, "", false),
          new(@"IceDiscovery.Reply.Router.PreferSecure", false, "", false),
          new(@"IceDiscovery.Reply.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceDiscovery.Reply.Router.InvocationTimeout", false, "", false),
@@ -275,18 +339,33 @@ public sealed class PropertyNames
          new(@"IceDiscovery.Reply.ThreadPool.Serialize", false, "0", false),
          new(@"IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceDiscovery.Reply.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceDiscovery.Reply.ThreadPool.Reactors", false, "1", false),
+         new(@"IceDiscovery.Reply.ThreadPool.IoUring", false, "0", false),
          new(@"IceDiscovery.Reply.MessageSizeMax", false, "", false),
          new(@"IceDiscovery.Locator.AdapterId", false, "", false),
          new(@"IceDiscovery.Locator.Connection.CloseTimeout", false, "10", false),
          new(@"IceDiscovery.Locator.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceDiscovery.Locator.Connection.CorkDelay", false, "100", false),
+         new(@"IceDiscovery.Locator.Connection.CorkSize", false, "0", false),
          new(@"IceDiscovery.Locator.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceDiscovery.Locator.Connection.IdleTimeout", false, "60", false),
          new(@"IceDiscovery.Locator.Connection.InactivityTimeout", false, "300", false),
          new(@"IceDiscovery.Locator.Connection.MaxDispatches", false, "100", false),
+         new(@"IceDiscovery.Locator.Connection.ReadBufferSize", false, "0", false),
          new(@"IceDiscovery.Locator.Connection", false, "", false),
+         new(@"IceDiscovery.Locator.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceDiscovery.Locator.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceDiscovery.Locator.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceDiscovery.Locator.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceDiscovery.Locator.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceDiscovery.Locator.Dispatch.Deadline", false, "0", false),
+         new(@"IceDiscovery.Locator.Dispatch.Executor", false, "", false),
+         new(@"IceDiscovery.Locator.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceDiscovery.Locator.Dispatch.Size", false, "0", false),
          new(@"IceDiscovery.Locator.Endpoints", false, "", false),
          new(@"IceDiscovery.Locator.Locator.EndpointSelection", false, "", false),
          new(@"IceDiscovery.Locator.Locator.ConnectionCached", false, "", false),
+         new(@"IceDiscovery.Locator.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceDiscovery.Locator.Locator.PreferSecure", false, "", false),
          new(@"IceDiscovery.Locator.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceDiscovery.Locator.Locator.InvocationTimeout", false, "", false),
@@ -299,6 +378,7 @@ public sealed class PropertyNames
          new(@"IceDiscovery.Locator.ReplicaGroupId", false, "", false),
          new(@"IceDiscovery.Locator.Router.EndpointSelection", false, "", false),
          new(@"IceDiscovery.Locator.Router.ConnectionCached", false, "", false),
+         new(@"IceDiscovery.Locator.Router.ConnectionPoolSize", false, "", false),
          new(@"IceDiscovery.Locator.Router.PreferSecure", false, "", false),
          new(@"IceDiscovery.Locator.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceDiscovery.Locator.Router.InvocationTimeout", false, "", false),
@@ -315,6 +395,8 @@ public sealed class PropertyNames
          new(@"IceDiscovery.Locator.ThreadPool.Serialize", false, "0", false),
          new(@"IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceDiscovery.Locator.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceDiscovery.Locator.ThreadPool.Reactors", false, "1", false),
+         new(@"IceDiscovery.Locator.ThreadPool.IoUring", false, "0", false),
          new(@"IceDiscovery.Locator.MessageSizeMax", false, "", false),
          new(@"IceDiscovery.Lookup", false, "", false),
          new(@"IceDiscovery.Timeout", false, "300", false),
@@ -331,14 +413,27 @@ public sealed class PropertyNames
          new(@"IceLocatorDiscovery.Reply.AdapterId", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Connection.CloseTimeout", false, "10", false),
          new(@"IceLocatorDiscovery.Reply.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceLocatorDiscovery.Reply.Connection.CorkDelay", false, "100", false),
+         new(@"IceLocatorDiscovery.Reply.Connection.CorkSize", false, "0", false),
          new(@"IceLocatorDiscovery.Reply.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceLocatorDiscovery.Reply.Connection.IdleTimeout", false, "60", false),
          new(@"IceLocatorDiscovery.Reply.Connection.InactivityTimeout", false, "300", false),
          new(@"IceLocatorDiscovery.Reply.Connection.MaxDispatches", false, "100", false),
+         new(@"IceLocatorDiscovery.Reply.Connection.ReadBufferSize", false, "0", false),
          new(@"IceLocatorDiscovery.Reply.Connection", false, "", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.Deadline", false, "0", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.Executor", false, "", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceLocatorDiscovery.Reply.Dispatch.Size", false, "0", false),
          new(@"IceLocatorDiscovery.Reply.Endpoints", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Locator.EndpointSelection", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Locator.ConnectionCached", false, "", false),
+         new(@"IceLocatorDiscovery.Reply.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Locator.PreferSecure", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Locator.InvocationTimeout", false, "", false),
@@ -351,6 +446,7 @@ public sealed class PropertyNames
          new(@"IceLocatorDiscovery.Reply.ReplicaGroupId", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Router.EndpointSelection", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Router.ConnectionCached", false, "", false),
+         new(@"IceLocatorDiscovery.Reply.Router.ConnectionPoolSize", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Router.PreferSecure", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceLocatorDiscovery.Reply.Router.InvocationTimeout", false, "", false),
@@ -367,18 +463,33 @@ public sealed class PropertyNames
          new(@"IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, "0", false),
          new(@"IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceLocatorDiscovery.Reply.ThreadPool.Reactors", false, "1", false),
+         new(@"IceLocatorDiscovery.Reply.ThreadPool.IoUring", false, "0", false),
          new(@"IceLocatorDiscovery.Reply.MessageSizeMax", false, "", false),
          new(@"IceLocatorDiscovery.Locator.AdapterId", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Connection.CloseTimeout", false, "10", false),
          new(@"IceLocatorDiscovery.Locator.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceLocatorDiscovery.Locator.Connection.CorkDelay", false, "100", false),
+         new(@"IceLocatorDiscovery.Locator.Connection.CorkSize", false, "0", false),
          new(@"IceLocatorDiscovery.Locator.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceLocatorDiscovery.Locator.Connection.IdleTimeout", false, "60", false),
          new(@"IceLocatorDiscovery.Locator.Connection.InactivityTimeout", false, "300", false),
          new(@"IceLocatorDiscovery.Locator.Connection.MaxDispatches", false, "100", false),
+         new(@"IceLocatorDiscovery.Locator.Connection.ReadBufferSize", false, "0", false),
          new(@"IceLocatorDiscovery.Locator.Connection", false, "", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.Deadline", false, "0", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.Executor", false, "", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceLocatorDiscovery.Locator.Dispatch.Size", false, "0", false),
          new(@"IceLocatorDiscovery.Locator.Endpoints", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Locator.EndpointSelection", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Locator.ConnectionCached", false, "", false),
+         new(@"IceLocatorDiscovery.Locator.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Locator.PreferSecure", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Locator.InvocationTimeout", false, "", false),
@@ -391,6 +502,7 @@ public sealed class PropertyNames
          new(@"IceLocatorDiscovery.Locator.ReplicaGroupId", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Router.EndpointSelection", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Router.ConnectionCached", false, "", false),
+         new(@"IceLocatorDiscovery.Locator.Router.ConnectionPoolSize", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Router.PreferSecure", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceLocatorDiscovery.Locator.Router.InvocationTimeout", false, "", false),
@@ -407,6 +519,8 @@ public sealed class PropertyNames
          new(@"IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, "0", false),
          new(@"IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceLocatorDiscovery.Locator.ThreadPool.Reactors", false, "1", false),
+         new(@"IceLocatorDiscovery.Locator.ThreadPool.IoUring", false, "0", false),
          new(@"IceLocatorDiscovery.Locator.MessageSizeMax", false, "", false),
          new(@"IceLocatorDiscovery.Lookup", false, "", false),
          new(@"IceLocatorDiscovery.Timeout", false, "", false),
@@ -444,6 +558,7 @@ public sealed class PropertyNames
     {
          new(@"IceBoxAdmin.ServiceManager.Proxy.EndpointSelection", false, "", false),
          new(@"IceBoxAdmin.ServiceManager.Proxy.ConnectionCached", false, "", false),
+         new(@"IceBoxAdmin.ServiceManager.Proxy.ConnectionPoolSize", false, "", false),
          new(@"IceBoxAdmin.ServiceManager.Proxy.PreferSecure", false, "", false),
          new(@"IceBoxAdmin.ServiceManager.Proxy.LocatorCacheTimeout", false, "", false),
          new(@"IceBoxAdmin.ServiceManager.Proxy.InvocationTimeout", false, "", false),
@@ -459,14 +574,27 @@ public sealed class PropertyNames
          new(@"IceBridge.Source.AdapterId", false, "", false),
          new(@"IceBridge.Source.Connection.CloseTimeout", false, "10", false),
          new(@"IceBridge.Source.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceBridge.Source.Connection.CorkDelay", false, "100", false),
+         new(@"IceBridge.Source.Connection.CorkSize", false, "0", false),
          new(@"IceBridge.Source.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceBridge.Source.Connection.IdleTimeout", false, "60", false),
          new(@"IceBridge.Source.Connection.InactivityTimeout", false, "300", false),
          new(@"IceBridge.Source.Connection.MaxDispatches", false, "100", false),
+         new(@"IceBridge.Source.Connection.ReadBufferSize", false, "0", false),
          new(@"IceBridge.Source.Connection", false, "", false),
+         new(@"IceBridge.Source.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceBridge.Source.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceBridge.Source.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceBridge.Source.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceBridge.Source.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceBridge.Source.Dispatch.Deadline", false, "0", false),
+         new(@"IceBridge.Source.Dispatch.Executor", false, "", false),
+         new(@"IceBridge.Source.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceBridge.Source.Dispatch.Size", false, "0", false),
          new(@"IceBridge.Source.Endpoints", false, "", false),
          new(@"IceBridge.Source.Locator.EndpointSelection", false, "", false),
          new(@"IceBridge.Source.Locator.ConnectionCached", false, "", false),
+         new(@"IceBridge.Source.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceBridge.Source.Locator.PreferSecure", false, "", false),
          new(@"IceBridge.Source.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceBridge.Source.Locator.InvocationTimeout", false, "", false),
@@ -479,6 +607,7 @@ public sealed class PropertyNames
          new(@"IceBridge.Source.ReplicaGroupId", false, "", false),
          new(@"IceBridge.Source.Router.EndpointSelection", false, "", false),
          new(@"IceBridge.Source.Router.ConnectionCached", false, "", false),
+         new(@"IceBridge.Source.Router.ConnectionPoolSize", false, "", false),
          new(@"IceBridge.Source.Router.PreferSecure", false, "", false),
          new(@"IceBridge.Source.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceBridge.Source.Router.InvocationTimeout", false, "", false),
@@ -495,6 +624,8 @@ public sealed class PropertyNames
          new(@"IceBridge.Source.ThreadPool.Serialize", false, "0", false),
          new(@"IceBridge.Source.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceBridge.Source.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceBridge.Source.ThreadPool.Reactors", false, "1", false),
+         new(@"IceBridge.Source.ThreadPool.IoUring", false, "0", false),
          new(@"IceBridge.Source.MessageSizeMax", false, "", false),
          new(@"IceBridge.Target.Endpoints", false, "", false),
          new(@"IceBridge.InstanceName", false, "IceBridge", false),
@@ -513,14 +644,27 @@ public sealed class PropertyNames
          new(@"IceGridAdmin.Server.AdapterId", false, "", false),
          new(@"IceGridAdmin.Server.Connection.CloseTimeout", false, "10", false),
          new(@"IceGridAdmin.Server.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGridAdmin.Server.Connection.CorkDelay", false, "100", false),
+         new(@"IceGridAdmin.Server.Connection.CorkSize", false, "0", false),
          new(@"IceGridAdmin.Server.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGridAdmin.Server.Connection.IdleTimeout", false, "60", false),
          new(@"IceGridAdmin.Server.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGridAdmin.Server.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGridAdmin.Server.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGridAdmin.Server.Connection", false, "", false),
+         new(@"IceGridAdmin.Server.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGridAdmin.Server.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGridAdmin.Server.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGridAdmin.Server.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGridAdmin.Server.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGridAdmin.Server.Dispatch.Deadline", false, "0", false),
+         new(@"IceGridAdmin.Server.Dispatch.Executor", false, "", false),
+         new(@"IceGridAdmin.Server.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGridAdmin.Server.Dispatch.Size", false, "0", false),
          new(@"IceGridAdmin.Server.Endpoints", false, "", false),
          new(@"IceGridAdmin.Server.Locator.EndpointSelection", false, "", false),
          new(@"IceGridAdmin.Server.Locator.ConnectionCached", false, "", false),
+         new(@"IceGridAdmin.Server.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGridAdmin.Server.Locator.PreferSecure", false, "", false),
          new(@"IceGridAdmin.Server.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGridAdmin.Server.Locator.InvocationTimeout", false, "", false),
@@ -533,6 +677,7 @@ public sealed class PropertyNames
          new(@"IceGridAdmin.Server.ReplicaGroupId", false, "", false),
          new(@"IceGridAdmin.Server.Router.EndpointSelection", false, "", false),
          new(@"IceGridAdmin.Server.Router.ConnectionCached", false, "", false),
+         new(@"IceGridAdmin.Server.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGridAdmin.Server.Router.PreferSecure", false, "", false),
          new(@"IceGridAdmin.Server.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGridAdmin.Server.Router.InvocationTimeout", false, "", false),
@@ -549,6 +694,8 @@ public sealed class PropertyNames
          new(@"IceGridAdmin.Server.ThreadPool.Serialize", false, "0", false),
          new(@"IceGridAdmin.Server.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGridAdmin.Server.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGridAdmin.Server.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGridAdmin.Server.ThreadPool.IoUring", false, "0", false),
          new(@"IceGridAdmin.Server.MessageSizeMax", false, "", false),
          new(@"IceGridAdmin.Discovery.Address", false, "", false),
          new(@"IceGridAdmin.Discovery.Interface", false, "", false),
@@ -556,14 +703,27 @@ public sealed class PropertyNames
          new(@"IceGridAdmin.Discovery.Reply.AdapterId", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Connection.CloseTimeout", false, "10", false),
          new(@"IceGridAdmin.Discovery.Reply.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGridAdmin.Discovery.Reply.Connection.CorkDelay", false, "100", false),
+         new(@"IceGridAdmin.Discovery.Reply.Connection.CorkSize", false, "0", false),
          new(@"IceGridAdmin.Discovery.Reply.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGridAdmin.Discovery.Reply.Connection.IdleTimeout", false, "60", false),
          new(@"IceGridAdmin.Discovery.Reply.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGridAdmin.Discovery.Reply.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGridAdmin.Discovery.Reply.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGridAdmin.Discovery.Reply.Connection", false, "", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.Deadline", false, "0", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.Executor", false, "", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGridAdmin.Discovery.Reply.Dispatch.Size", false, "0", false),
          new(@"IceGridAdmin.Discovery.Reply.Endpoints", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Locator.EndpointSelection", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Locator.ConnectionCached", false, "", false),
+         new(@"IceGridAdmin.Discovery.Reply.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Locator.InvocationTimeout", false, "", false),
@@ -576,6 +736,7 @@ public sealed class PropertyNames
          new(@"IceGridAdmin.Discovery.Reply.ReplicaGroupId", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Router.EndpointSelection", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Router.ConnectionCached", false, "", false),
+         new(@"IceGridAdmin.Discovery.Reply.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Router.PreferSecure", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGridAdmin.Discovery.Reply.Router.InvocationTimeout", false, "", false),
@@ -592,18 +753,33 @@ public sealed class PropertyNames
          new(@"IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, "0", false),
          new(@"IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGridAdmin.Discovery.Reply.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGridAdmin.Discovery.Reply.ThreadPool.IoUring", false, "0", false),
          new(@"IceGridAdmin.Discovery.Reply.MessageSizeMax", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.AdapterId", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Connection.CloseTimeout", false, "10", false),
          new(@"IceGridAdmin.Discovery.Locator.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGridAdmin.Discovery.Locator.Connection.CorkDelay", false, "100", false),
+         new(@"IceGridAdmin.Discovery.Locator.Connection.CorkSize", false, "0", false),
          new(@"IceGridAdmin.Discovery.Locator.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGridAdmin.Discovery.Locator.Connection.IdleTimeout", false, "60", false),
          new(@"IceGridAdmin.Discovery.Locator.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGridAdmin.Discovery.Locator.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGridAdmin.Discovery.Locator.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGridAdmin.Discovery.Locator.Connection", false, "", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.Deadline", false, "0", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.Executor", false, "", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGridAdmin.Discovery.Locator.Dispatch.Size", false, "0", false),
          new(@"IceGridAdmin.Discovery.Locator.Endpoints", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Locator.EndpointSelection", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Locator.ConnectionCached", false, "", false),
+         new(@"IceGridAdmin.Discovery.Locator.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Locator.PreferSecure", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Locator.InvocationTimeout", false, "", false),
@@ -616,6 +792,7 @@ public sealed class PropertyNames
          new(@"IceGridAdmin.Discovery.Locator.ReplicaGroupId", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Router.EndpointSelection", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Router.ConnectionCached", false, "", false),
+         new(@"IceGridAdmin.Discovery.Locator.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Router.PreferSecure", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGridAdmin.Discovery.Locator.Router.InvocationTimeout", false, "", false),
@@ -632,6 +809,8 @@ public sealed class PropertyNames
          new(@"IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, "0", false),
          new(@"IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGridAdmin.Discovery.Locator.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGridAdmin.Discovery.Locator.ThreadPool.IoUring", false, "0", false),
          new(@"IceGridAdmin.Discovery.Locator.MessageSizeMax", false, "", false),
          new(@"IceGridAdmin.Trace.Observers", false, "", false),
          new(@"IceGridAdmin.Trace.SaveToRegistry", false, "", false),
@@ -642,14 +821,27 @@ public sealed class PropertyNames
          new(@"IceGrid.AdminRouter.AdapterId", false, "", false),
          new(@"IceGrid.AdminRouter.Connection.CloseTimeout", false, "10", false),
          new(@"IceGrid.AdminRouter.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGrid.AdminRouter.Connection.CorkDelay", false, "100", false),
+         new(@"IceGrid.AdminRouter.Connection.CorkSize", false, "0", false),
          new(@"IceGrid.AdminRouter.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGrid.AdminRouter.Connection.IdleTimeout", false, "60", false),
          new(@"IceGrid.AdminRouter.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGrid.AdminRouter.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGrid.AdminRouter.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGrid.AdminRouter.Connection", false, "", false),
+         new(@"IceGrid.AdminRouter.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGrid.AdminRouter.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGrid.AdminRouter.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGrid.AdminRouter.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGrid.AdminRouter.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGrid.AdminRouter.Dispatch.Deadline", false, "0", false),
+         new(@"IceGrid.AdminRouter.Dispatch.Executor", false, "", false),
+         new(@"IceGrid.AdminRouter.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGrid.AdminRouter.Dispatch.Size", false, "0", false),
          new(@"IceGrid.AdminRouter.Endpoints", false, "", false),
          new(@"IceGrid.AdminRouter.Locator.EndpointSelection", false, "", false),
          new(@"IceGrid.AdminRouter.Locator.ConnectionCached", false, "", false),
+         new(@"IceGrid.AdminRouter.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.AdminRouter.Locator.PreferSecure", false, "", false),
          new(@"IceGrid.AdminRouter.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.AdminRouter.Locator.InvocationTimeout", false, "", false),
@@ -662,6 +854,7 @@ public sealed class PropertyNames
          new(@"IceGrid.AdminRouter.ReplicaGroupId", false, "", false),
          new(@"IceGrid.AdminRouter.Router.EndpointSelection", false, "", false),
          new(@"IceGrid.AdminRouter.Router.ConnectionCached", false, "", false),
+         new(@"IceGrid.AdminRouter.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.AdminRouter.Router.PreferSecure", false, "", false),
          new(@"IceGrid.AdminRouter.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.AdminRouter.Router.InvocationTimeout", false, "", false),
@@ -678,19 +871,34 @@ public sealed class PropertyNames
          new(@"IceGrid.AdminRouter.ThreadPool.Serialize", false, "0", false),
          new(@"IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGrid.AdminRouter.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGrid.AdminRouter.ThreadPool.IoUring", false, "0", false),
          new(@"IceGrid.AdminRouter.MessageSizeMax", false, "", false),
          new(@"IceGrid.InstanceName", false, "IceGrid", false),
          new(@"IceGrid.Node.AdapterId", false, "", false),
          new(@"IceGrid.Node.Connection.CloseTimeout", false, "10", false),
          new(@"IceGrid.Node.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGrid.Node.Connection.CorkDelay", false, "100", false),
+         new(@"IceGrid.Node.Connection.CorkSize", false, "0", false),
          new(@"IceGrid.Node.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGrid.Node.Connection.IdleTimeout", false, "60", false),
          new(@"IceGrid.Node.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGrid.Node.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGrid.Node.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGrid.Node.Connection", false, "", false),
+         new(@"IceGrid.Node.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGrid.Node.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGrid.Node.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGrid.Node.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGrid.Node.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGrid.Node.Dispatch.Deadline", false, "0", false),
+         new(@"IceGrid.Node.Dispatch.Executor", false, "", false),
+         new(@"IceGrid.Node.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGrid.Node.Dispatch.Size", false, "0", false),
          new(@"IceGrid.Node.Endpoints", false, "", false),
          new(@"IceGrid.Node.Locator.EndpointSelection", false, "", false),
          new(@"IceGrid.Node.Locator.ConnectionCached", false, "", false),
+         new(@"IceGrid.Node.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Node.Locator.PreferSecure", false, "", false),
          new(@"IceGrid.Node.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Node.Locator.InvocationTimeout", false, "", false),
@@ -703,6 +911,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Node.ReplicaGroupId", false, "", false),
          new(@"IceGrid.Node.Router.EndpointSelection", false, "", false),
          new(@"IceGrid.Node.Router.ConnectionCached", false, "", false),
+         new(@"IceGrid.Node.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Node.Router.PreferSecure", false, "", false),
          new(@"IceGrid.Node.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Node.Router.InvocationTimeout", false, "", false),
@@ -719,6 +928,8 @@ public sealed class PropertyNames
          new(@"IceGrid.Node.ThreadPool.Serialize", false, "0", false),
          new(@"IceGrid.Node.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGrid.Node.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGrid.Node.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGrid.Node.ThreadPool.IoUring", false, "0", false),
          new(@"IceGrid.Node.MessageSizeMax", false, "", false),
          new(@"IceGrid.Node.AllowRunningServersAsRoot", false, "", false),
          new(@"IceGrid.Node.AllowEndpointsOverride", false, "0", false),
@@ -740,6 +951,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Node.UserAccounts", false, "", false),
          new(@"IceGrid.Node.UserAccountMapper.EndpointSelection", false, "", false),
          new(@"IceGrid.Node.UserAccountMapper.ConnectionCached", false, "", false),
+         new(@"IceGrid.Node.UserAccountMapper.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Node.UserAccountMapper.PreferSecure", false, "", false),
          new(@"IceGrid.Node.UserAccountMapper.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Node.UserAccountMapper.InvocationTimeout", false, "", false),
@@ -752,6 +964,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.AdminCryptPasswords", false, "", false),
          new(@"IceGrid.Registry.AdminPermissionsVerifier.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.AdminPermissionsVerifier.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.AdminPermissionsVerifier.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.AdminPermissionsVerifier.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.AdminPermissionsVerifier.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.AdminPermissionsVerifier.InvocationTimeout", false, "", false),
@@ -764,14 +977,27 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.AdminSessionManager.AdapterId", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Connection.CloseTimeout", false, "10", false),
          new(@"IceGrid.Registry.AdminSessionManager.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Connection.CorkDelay", false, "100", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Connection.CorkSize", false, "0", false),
          new(@"IceGrid.Registry.AdminSessionManager.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGrid.Registry.AdminSessionManager.Connection.IdleTimeout", false, "60", false),
          new(@"IceGrid.Registry.AdminSessionManager.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGrid.Registry.AdminSessionManager.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGrid.Registry.AdminSessionManager.Connection", false, "", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.Deadline", false, "0", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.Executor", false, "", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Dispatch.Size", false, "0", false),
          new(@"IceGrid.Registry.AdminSessionManager.Endpoints", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Locator.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Locator.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Locator.InvocationTimeout", false, "", false),
@@ -784,6 +1010,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.AdminSessionManager.ReplicaGroupId", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Router.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Router.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.AdminSessionManager.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Router.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.AdminSessionManager.Router.InvocationTimeout", false, "", false),
@@ -800,9 +1027,12 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, "0", false),
          new(@"IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGrid.Registry.AdminSessionManager.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGrid.Registry.AdminSessionManager.ThreadPool.IoUring", false, "0", false),
          new(@"IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, "", false),
          new(@"IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.AdminSSLPermissionsVerifier.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.AdminSSLPermissionsVerifier.InvocationTimeout", false, "", false),
@@ -814,14 +1044,27 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Client.AdapterId", false, "", false),
          new(@"IceGrid.Registry.Client.Connection.CloseTimeout", false, "10", false),
          new(@"IceGrid.Registry.Client.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGrid.Registry.Client.Connection.CorkDelay", false, "100", false),
+         new(@"IceGrid.Registry.Client.Connection.CorkSize", false, "0", false),
          new(@"IceGrid.Registry.Client.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGrid.Registry.Client.Connection.IdleTimeout", false, "60", false),
          new(@"IceGrid.Registry.Client.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGrid.Registry.Client.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGrid.Registry.Client.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGrid.Registry.Client.Connection", false, "", false),
+         new(@"IceGrid.Registry.Client.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGrid.Registry.Client.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGrid.Registry.Client.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGrid.Registry.Client.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGrid.Registry.Client.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGrid.Registry.Client.Dispatch.Deadline", false, "0", false),
+         new(@"IceGrid.Registry.Client.Dispatch.Executor", false, "", false),
+         new(@"IceGrid.Registry.Client.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGrid.Registry.Client.Dispatch.Size", false, "0", false),
          new(@"IceGrid.Registry.Client.Endpoints", false, "", false),
          new(@"IceGrid.Registry.Client.Locator.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.Client.Locator.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.Client.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.Client.Locator.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.Client.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.Client.Locator.InvocationTimeout", false, "", false),
@@ -834,6 +1077,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Client.ReplicaGroupId", false, "", false),
          new(@"IceGrid.Registry.Client.Router.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.Client.Router.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.Client.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.Client.Router.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.Client.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.Client.Router.InvocationTimeout", false, "", false),
@@ -850,20 +1094,35 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Client.ThreadPool.Serialize", false, "0", false),
          new(@"IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGrid.Registry.Client.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGrid.Registry.Client.ThreadPool.IoUring", false, "0", false),
          new(@"IceGrid.Registry.Client.MessageSizeMax", false, "", false),
          new(@"IceGrid.Registry.CryptPasswords", false, "", false),
          new(@"IceGrid.Registry.DefaultTemplates", false, "", false),
          new(@"IceGrid.Registry.Discovery.AdapterId", false, "", false),
          new(@"IceGrid.Registry.Discovery.Connection.CloseTimeout", false, "10", false),
          new(@"IceGrid.Registry.Discovery.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGrid.Registry.Discovery.Connection.CorkDelay", false, "100", false),
+         new(@"IceGrid.Registry.Discovery.Connection.CorkSize", false, "0", false),
          new(@"IceGrid.Registry.Discovery.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGrid.Registry.Discovery.Connection.IdleTimeout", false, "60", false),
          new(@"IceGrid.Registry.Discovery.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGrid.Registry.Discovery.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGrid.Registry.Discovery.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGrid.Registry.Discovery.Connection", false, "", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.Deadline", false, "0", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.Executor", false, "", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGrid.Registry.Discovery.Dispatch.Size", false, "0", false),
          new(@"IceGrid.Registry.Discovery.Endpoints", false, "", false),
          new(@"IceGrid.Registry.Discovery.Locator.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.Discovery.Locator.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.Discovery.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.Discovery.Locator.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.Discovery.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.Discovery.Locator.InvocationTimeout", false, "", false),
@@ -876,6 +1135,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Discovery.ReplicaGroupId", false, "", false),
          new(@"IceGrid.Registry.Discovery.Router.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.Discovery.Router.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.Discovery.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.Discovery.Router.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.Discovery.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.Discovery.Router.InvocationTimeout", false, "", false),
@@ -892,6 +1152,8 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Discovery.ThreadPool.Serialize", false, "0", false),
          new(@"IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGrid.Registry.Discovery.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGrid.Registry.Discovery.ThreadPool.IoUring", false, "0", false),
          new(@"IceGrid.Registry.Discovery.MessageSizeMax", false, "", false),
          new(@"IceGrid.Registry.Discovery.Enabled", false, "1", false),
          new(@"IceGrid.Registry.Discovery.Address", false, "", false),
@@ -901,14 +1163,27 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Internal.AdapterId", false, "", false),
          new(@"IceGrid.Registry.Internal.Connection.CloseTimeout", false, "10", false),
          new(@"IceGrid.Registry.Internal.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGrid.Registry.Internal.Connection.CorkDelay", false, "100", false),
+         new(@"IceGrid.Registry.Internal.Connection.CorkSize", false, "0", false),
          new(@"IceGrid.Registry.Internal.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGrid.Registry.Internal.Connection.IdleTimeout", false, "60", false),
          new(@"IceGrid.Registry.Internal.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGrid.Registry.Internal.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGrid.Registry.Internal.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGrid.Registry.Internal.Connection", false, "", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.Deadline", false, "0", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.Executor", false, "", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGrid.Registry.Internal.Dispatch.Size", false, "0", false),
          new(@"IceGrid.Registry.Internal.Endpoints", false, "", false),
          new(@"IceGrid.Registry.Internal.Locator.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.Internal.Locator.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.Internal.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.Internal.Locator.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.Internal.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.Internal.Locator.InvocationTimeout", false, "", false),
@@ -921,6 +1196,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Internal.ReplicaGroupId", false, "", false),
          new(@"IceGrid.Registry.Internal.Router.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.Internal.Router.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.Internal.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.Internal.Router.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.Internal.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.Internal.Router.InvocationTimeout", false, "", false),
@@ -937,11 +1213,14 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Internal.ThreadPool.Serialize", false, "0", false),
          new(@"IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGrid.Registry.Internal.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGrid.Registry.Internal.ThreadPool.IoUring", false, "0", false),
          new(@"IceGrid.Registry.Internal.MessageSizeMax", false, "", false),
          new(@"IceGrid.Registry.LMDB.MapSize", false, "", false),
          new(@"IceGrid.Registry.LMDB.Path", false, "", false),
          new(@"IceGrid.Registry.PermissionsVerifier.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.PermissionsVerifier.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.PermissionsVerifier.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.PermissionsVerifier.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.PermissionsVerifier.InvocationTimeout", false, "", false),
@@ -954,14 +1233,27 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Server.AdapterId", false, "", false),
          new(@"IceGrid.Registry.Server.Connection.CloseTimeout", false, "10", false),
          new(@"IceGrid.Registry.Server.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGrid.Registry.Server.Connection.CorkDelay", false, "100", false),
+         new(@"IceGrid.Registry.Server.Connection.CorkSize", false, "0", false),
          new(@"IceGrid.Registry.Server.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGrid.Registry.Server.Connection.IdleTimeout", false, "60", false),
          new(@"IceGrid.Registry.Server.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGrid.Registry.Server.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGrid.Registry.Server.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGrid.Registry.Server.Connection", false, "", false),
+         new(@"IceGrid.Registry.Server.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGrid.Registry.Server.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGrid.Registry.Server.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGrid.Registry.Server.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGrid.Registry.Server.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGrid.Registry.Server.Dispatch.Deadline", false, "0", false),
+         new(@"IceGrid.Registry.Server.Dispatch.Executor", false, "", false),
+         new(@"IceGrid.Registry.Server.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGrid.Registry.Server.Dispatch.Size", false, "0", false),
          new(@"IceGrid.Registry.Server.Endpoints", false, "", false),
          new(@"IceGrid.Registry.Server.Locator.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.Server.Locator.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.Server.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.Server.Locator.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.Server.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.Server.Locator.InvocationTimeout", false, "", false),
@@ -974,6 +1266,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Server.ReplicaGroupId", false, "", false),
          new(@"IceGrid.Registry.Server.Router.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.Server.Router.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.Server.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.Server.Router.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.Server.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.Server.Router.InvocationTimeout", false, "", false),
@@ -990,19 +1283,34 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.Server.ThreadPool.Serialize", false, "0", false),
          new(@"IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGrid.Registry.Server.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGrid.Registry.Server.ThreadPool.IoUring", false, "0", false),
          new(@"IceGrid.Registry.Server.MessageSizeMax", false, "", false),
          new(@"IceGrid.Registry.SessionFilters", false, "0", false),
          new(@"IceGrid.Registry.SessionManager.AdapterId", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Connection.CloseTimeout", false, "10", false),
          new(@"IceGrid.Registry.SessionManager.Connection.ConnectTimeout", false, "10", false),
+         new(@"IceGrid.Registry.SessionManager.Connection.CorkDelay", false, "100", false),
+         new(@"IceGrid.Registry.SessionManager.Connection.CorkSize", false, "0", false),
          new(@"IceGrid.Registry.SessionManager.Connection.EnableIdleCheck", false, "1", false),
          new(@"IceGrid.Registry.SessionManager.Connection.IdleTimeout", false, "60", false),
          new(@"IceGrid.Registry.SessionManager.Connection.InactivityTimeout", false, "300", false),
          new(@"IceGrid.Registry.SessionManager.Connection.MaxDispatches", false, "100", false),
+         new(@"IceGrid.Registry.SessionManager.Connection.ReadBufferSize", false, "0", false),
          new(@"IceGrid.Registry.SessionManager.Connection", false, "", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.Deadline", false, "0", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.Executor", false, "", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.MaxDispatches", false, "0", false),
+         new(@"IceGrid.Registry.SessionManager.Dispatch.Size", false, "0", false),
          new(@"IceGrid.Registry.SessionManager.Endpoints", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Locator.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Locator.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.SessionManager.Locator.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Locator.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Locator.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Locator.InvocationTimeout", false, "", false),
@@ -1015,6 +1323,7 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.SessionManager.ReplicaGroupId", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Router.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Router.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.SessionManager.Router.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Router.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Router.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.SessionManager.Router.InvocationTimeout", false, "", false),
@@ -1031,9 +1340,12 @@ public sealed class PropertyNames
          new(@"IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, "0", false),
          new(@"IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, "", false),
+         new(@"IceGrid.Registry.SessionManager.ThreadPool.Reactors", false, "1", false),
+         new(@"IceGrid.Registry.SessionManager.ThreadPool.IoUring", false, "0", false),
          new(@"IceGrid.Registry.SessionManager.MessageSizeMax", false, "", false),
          new(@"IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, "", false),
          new(@"IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, "", false),
+         new(@"IceGrid.Registry.SSLPermissionsVerifier.ConnectionPoolSize", false, "", false),
          new(@"IceGrid.Registry.SSLPermissionsVerifier.PreferSecure", false, "", false),
          new(@"IceGrid.Registry.SSLPermissionsVerifier.LocatorCacheTimeout", false, "", false),
          new(@"IceGrid.Registry.SSLPermissionsVerifier.InvocationTimeout", false, "", false),
@@ -1111,14 +1423,27 @@ public sealed class PropertyNames
          new(@"Glacier2.Client.AdapterId", false, "", false),
          new(@"Glacier2.Client.Connection.CloseTimeout", false, "10", false),
          new(@"Glacier2.Client.Connection.ConnectTimeout", false, "10", false),
+         new(@"Glacier2.Client.Connection.CorkDelay", false, "100", false),
+         new(@"Glacier2.Client.Connection.CorkSize", false, "0", false),
          new(@"Glacier2.Client.Connection.EnableIdleCheck", false, "1", false),
          new(@"Glacier2.Client.Connection.IdleTimeout", false, "60", false),
          new(@"Glacier2.Client.Connection.InactivityTimeout", false, "300", false),
          new(@"Glacier2.Client.Connection.MaxDispatches", false, "100", false),
+         new(@"Glacier2.Client.Connection.ReadBufferSize", false, "0", false),
          new(@"Glacier2.Client.Connection", false, "", false),
+         new(@"Glacier2.Client.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"Glacier2.Client.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"Glacier2.Client.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"Glacier2.Client.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"Glacier2.Client.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"Glacier2.Client.Dispatch.Deadline", false, "0", false),
+         new(@"Glacier2.Client.Dispatch.Executor", false, "", false),
+         new(@"Glacier2.Client.Dispatch.MaxDispatches", false, "0", false),
+         new(@"Glacier2.Client.Dispatch.Size", false, "0", false),
          new(@"Glacier2.Client.Endpoints", false, "", false),
          new(@"Glacier2.Client.Locator.EndpointSelection", false, "", false),
          new(@"Glacier2.Client.Locator.ConnectionCached", false, "", false),
+         new(@"Glacier2.Client.Locator.ConnectionPoolSize", false, "", false),
          new(@"Glacier2.Client.Locator.PreferSecure", false, "", false),
          new(@"Glacier2.Client.Locator.LocatorCacheTimeout", false, "", false),
          new(@"Glacier2.Client.Locator.InvocationTimeout", false, "", false),
@@ -1131,6 +1456,7 @@ public sealed class PropertyNames
          new(@"Glacier2.Client.ReplicaGroupId", false, "", false),
          new(@"Glacier2.Client.Router.EndpointSelection", false, "", false),
          new(@"Glacier2.Client.Router.ConnectionCached", false, "", false),
+         new(@"Glacier2.Client.Router.ConnectionPoolSize", false, "", false),
          new(@"Glacier2.Client.Router.PreferSecure", false, "", false),
          new(@"Glacier2.Client.Router.LocatorCacheTimeout", false, "", false),
          new(@"Glacier2.Client.Router.InvocationTimeout", false, "", false),
@@ -1147,6 +1473,8 @@ public sealed class PropertyNames
          new(@"Glacier2.Client.ThreadPool.Serialize", false, "0", false),
          new(@"Glacier2.Client.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"Glacier2.Client.ThreadPool.ThreadPriority", false, "", false),
+         new(@"Glacier2.Client.ThreadPool.Reactors", false, "1", false),
+         new(@"Glacier2.Client.ThreadPool.IoUring", false, "0", false),
          new(@"Glacier2.Client.MessageSizeMax", false, "", false),
          new(@"Glacier2.Client.Buffered", false, "1", false),
          new(@"Glacier2.Client.ForwardContext", false, "0", false),
@@ -1165,6 +1493,7 @@ public sealed class PropertyNames
          new(@"Glacier2.InstanceName", false, "Glacier2", false),
          new(@"Glacier2.PermissionsVerifier.EndpointSelection", false, "", false),
          new(@"Glacier2.PermissionsVerifier.ConnectionCached", false, "", false),
+         new(@"Glacier2.PermissionsVerifier.ConnectionPoolSize", false, "", false),
          new(@"Glacier2.PermissionsVerifier.PreferSecure", false, "", false),
          new(@"Glacier2.PermissionsVerifier.LocatorCacheTimeout", false, "", false),
          new(@"Glacier2.PermissionsVerifier.InvocationTimeout", false, "", false),
@@ -1176,6 +1505,7 @@ public sealed class PropertyNames
          new(@"Glacier2.ReturnClientProxy", false, "", false),
          new(@"Glacier2.SSLPermissionsVerifier.EndpointSelection", false, "", false),
          new(@"Glacier2.SSLPermissionsVerifier.ConnectionCached", false, "", false),
+         new(@"Glacier2.SSLPermissionsVerifier.ConnectionPoolSize", false, "", false),
          new(@"Glacier2.SSLPermissionsVerifier.PreferSecure", false, "", false),
          new(@"Glacier2.SSLPermissionsVerifier.LocatorCacheTimeout", false, "", false),
          new(@"Glacier2.SSLPermissionsVerifier.InvocationTimeout", false, "", false),
@@ -1188,14 +1518,27 @@ public sealed class PropertyNames
          new(@"Glacier2.Server.AdapterId", false, "", false),
          new(@"Glacier2.Server.Connection.CloseTimeout", false, "10", false),
          new(@"Glacier2.Server.Connection.ConnectTimeout", false, "10", false),
+         new(@"Glacier2.Server.Connection.CorkDelay", false, "100", false),
+         new(@"Glacier2.Server.Connection.CorkSize", false, "0", false),
          new(@"Glacier2.Server.Connection.EnableIdleCheck", false, "1", false),
          new(@"Glacier2.Server.Connection.IdleTimeout", false, "60", false),
          new(@"Glacier2.Server.Connection.InactivityTimeout", false, "300", false),
          new(@"Glacier2.Server.Connection.MaxDispatches", false, "100", false),
+         new(@"Glacier2.Server.Connection.ReadBufferSize", false, "0", false),
          new(@"Glacier2.Server.Connection", false, "", false),
+         new(@"Glacier2.Server.Dispatch.ConcurrencyLimit", false, "", false),
+         new(@"Glacier2.Server.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+         new(@"Glacier2.Server.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+         new(@"Glacier2.Server.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+         new(@"Glacier2.Server.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+         new(@"Glacier2.Server.Dispatch.Deadline", false, "0", false),
+         new(@"Glacier2.Server.Dispatch.Executor", false, "", false),
+         new(@"Glacier2.Server.Dispatch.MaxDispatches", false, "0", false),
+         new(@"Glacier2.Server.Dispatch.Size", false, "0", false),
          new(@"Glacier2.Server.Endpoints", false, "", false),
          new(@"Glacier2.Server.Locator.EndpointSelection", false, "", false),
          new(@"Glacier2.Server.Locator.ConnectionCached", false, "", false),
+         new(@"Glacier2.Server.Locator.ConnectionPoolSize", false, "", false),
          new(@"Glacier2.Server.Locator.PreferSecure", false, "", false),
          new(@"Glacier2.Server.Locator.LocatorCacheTimeout", false, "", false),
          new(@"Glacier2.Server.Locator.InvocationTimeout", false, "", false),
@@ -1208,6 +1551,7 @@ public sealed class PropertyNames
          new(@"Glacier2.Server.ReplicaGroupId", false, "", false),
          new(@"Glacier2.Server.Router.EndpointSelection", false, "", false),
          new(@"Glacier2.Server.Router.ConnectionCached", false, "", false),
+         new(@"Glacier2.Server.Router.ConnectionPoolSize", false, "", false),
          new(@"Glacier2.Server.Router.PreferSecure", false, "", false),
          new(@"Glacier2.Server.Router.LocatorCacheTimeout", false, "", false),
          new(@"Glacier2.Server.Router.InvocationTimeout", false, "", false),
@@ -1224,6 +1568,8 @@ public sealed class PropertyNames
          new(@"Glacier2.Server.ThreadPool.Serialize", false, "0", false),
          new(@"Glacier2.Server.ThreadPool.ThreadIdleTime", false, "60", false),
          new(@"Glacier2.Server.ThreadPool.ThreadPriority", false, "", false),
+         new(@"Glacier2.Server.ThreadPool.Reactors", false, "1", false),
+         new(@"Glacier2.Server.ThreadPool.IoUring", false, "0", false),
          new(@"Glacier2.Server.MessageSizeMax", false, "", false),
          new(@"Glacier2.Server.Buffered", false, "1", false),
          new(@"Glacier2.Server.ForwardContext", false, "0", false),
@@ -1232,6 +1578,7 @@ public sealed class PropertyNames
          new(@"Glacier2.Server.Trace.Request", false, "0", false),
          new(@"Glacier2.SessionManager.EndpointSelection", false, "", false),
          new(@"Glacier2.SessionManager.ConnectionCached", false, "", false),
+         new(@"Glacier2.SessionManager.ConnectionPoolSize", false, "", false),
          new(@"Glacier2.SessionManager.PreferSecure", false, "", false),
          new(@"Glacier2.SessionManager.LocatorCacheTimeout", false, "", false),
          new(@"Glacier2.SessionManager.InvocationTimeout", false, "", false),
@@ -1242,6 +1589,7 @@ public sealed class PropertyNames
          new(@"Glacier2.SessionManager", false, "", false),
          new(@"Glacier2.SSLSessionManager.EndpointSelection", false, "", false),
          new(@"Glacier2.SSLSessionManager.ConnectionCached", false, "", false),
+         new(@"Glacier2.SSLSessionManager.ConnectionPoolSize", false, "", false),
          new(@"Glacier2.SSLSessionManager.PreferSecure", false, "", false),
          new(@"Glacier2.SSLSessionManager.LocatorCacheTimeout", false, "", false),
          new(@"Glacier2.SSLSessionManager.InvocationTimeout", false, "", false),
@@ -12,14 +12,27 @@ public final class PropertyNames {
     new Property("Ice.Admin.AdapterId", false, "", false),
     new Property("Ice.Admin.Connection.CloseTimeout", false, "10", false),
     new Property("Ice.Admin.Connection.ConnectTimeout", false, "10", false),
+    new Property("Ice.Admin.Connection.CorkDelay", false, "100", false),
+    new Property("Ice.Admin.Connection.CorkSize", false, "0", false),
     new Property("Ice.Admin.Connection.EnableIdleCheck", false, "1", false),
     new Property("Ice.Admin.Connection.IdleTimeout", false, "60", false),
     new Property("Ice.Admin.Connection.InactivityTimeout", false, "300", false),
     new Property("Ice.Admin.Connection.MaxDispatches", false, "100", false),
+    new Property("Ice.Admin.Connection.ReadBufferSize", false, "0", false),
     new Property("Ice.Admin.Connection", false, "", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("Ice.Admin.Dispatch.Deadline", false, "0", false),
+    new Property("Ice.Admin.Dispatch.Executor", false, "", false),
+    new Property("Ice.Admin.Dispatch.MaxDispatches", false, "0", false),
+    new Property("Ice.Admin.Dispatch.Size", false, "0", false),
     new Property("Ice.Admin.Endpoints", false, "", false),
     new Property("Ice.Admin.Locator.EndpointSelection", false, "", false),
     new Property("Ice.Admin.Locator.ConnectionCached", false, "", false),
+    new Property("Ice.Admin.Locator.ConnectionPoolSize", false, "", false),
     new Property("Ice.Admin.Locator.PreferSecure", false, "", false),
     new Property("Ice.Admin.Locator.LocatorCacheTimeout", false, "", false),
     new Property("Ice.Admin.Locator.InvocationTimeout", false, "", false),
@@ -32,6 +45,7 @@ public final class PropertyNames {
     new Property("Ice.Admin.ReplicaGroupId", false, "", false),
     new Property("Ice.Admin.Router.EndpointSelection", false, "", false),
     new Property("Ice.Admin.Router.ConnectionCached", false, "", false),
+    new Property("Ice.Admin.Router.ConnectionPoolSize", false, "", false),
     new Property("Ice.Admin.Router.PreferSecure", false, "", false),
     new Property("Ice.Admin.Router.LocatorCacheTimeout", false, "", false),
     new Property("Ice.Admin.Router.InvocationTimeout", false, "", false),
@@ -48,6 +62,8 @@ public final class PropertyNames {
     new Property("Ice.Admin.ThreadPool.Serialize", false, "0", false),
     new Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("Ice.Admin.ThreadPool.ThreadPriority", false, "", false),
+    new Property("Ice.Admin.ThreadPool.Reactors", false, "1", false),
+    new Property("Ice.Admin.ThreadPool.IoUring", false, "0", false),
     new Property("Ice.Admin.MessageSizeMax", false, "", false),
     new Property("Ice.Admin.DelayCreation", false, "0", false),
     new Property("Ice.Admin.Enabled", false, "", false),
@@ -59,25 +75,32 @@ public final class PropertyNames {
     new Property("Ice.Admin.ServerId", false, "", false),
     new Property("Ice.BackgroundLocatorCacheUpdates", false, "0", false),
     new Property("Ice.BatchAutoFlush", false, "", true),
+    new Property("Ice.BatchAutoFlushDelay", false, "0", false),
     new Property("Ice.BatchAutoFlushSize", false, "1024", false),
     new Property("Ice.ChangeUser", false, "", false),
     new Property("Ice.ClassGraphDepthMax", false, "10", false),
+    new Property("Ice.Compression.Codecs", false, "zstd lz4 bzip2", false),
     new Property("Ice.Compression.Level", false, "1", false),
     new Property("Ice.Config", false, "", false),
     new Property("Ice.Connection.CloseTimeout", false, "10", false),
     new Property("Ice.Connection.ConnectTimeout", false, "10", false),
+    new Property("Ice.Connection.CorkDelay", false, "100", false),
+    new Property("Ice.Connection.CorkSize", false, "0", false),
     new Property("Ice.Connection.EnableIdleCheck", false, "1", false),
     new Property("Ice.Connection.IdleTimeout", false, "60", false),
     new Property("Ice.Connection.InactivityTimeout", false, "300", false),
     new Property("Ice.Connection.MaxDispatches", false, "100", false),
+    new Property("Ice.Connection.ReadBufferSize", false, "0", false),
     new Property("Ice.Connection", false, "", false),
     new Property("Ice.ConsoleListener", false, "1", false),
     new Property("Ice.Default.CollocationOptimized", false, "1", false),
+    new Property("Ice.Default.ConnectionPoolSize", false, "1", false),
     new Property("Ice.Default.EncodingVersion", false, "1.1", false),
     new Property("Ice.Default.EndpointSelection", false, "Random", false),
     new Property("Ice.Default.Host", false, "", false),
     new Property("Ice.Default.Locator.EndpointSelection", false, "", false),
     new Property("Ice.Default.Locator.ConnectionCached", false, "", false),
+    new Property("Ice.Default.Locator.ConnectionPoolSize", false, "", false),
     new Property("Ice.Default.Locator.PreferSecure", false, "", false),
     new Property("Ice.Default.Locator.LocatorCacheTimeout", false, "", false),
     new Property("Ice.Default.Locator.InvocationTimeout", false, "", false),
@@ -93,6 +116,7 @@ public final class PropertyNames {
     new Property("Ice.Default.Protocol", false, "tcp", false),
     new Property("Ice.Default.Router.EndpointSelection", false, "", false),
     new Property("Ice.Default.Router.ConnectionCached", false, "", false),
+    new Property("Ice.Default.Router.ConnectionPoolSize", false, "", false),
     new Property("Ice.Default.Router.PreferSecure", false, "", false),
     new Property("Ice.Default.Router.LocatorCacheTimeout", false, "", false),
     new Property("Ice.Default.Router.InvocationTimeout", false, "", false),
@@ -106,6 +130,9 @@ public final class PropertyNames {
     new Property("Ice.Default.Timeout", false, "60000", false),
     new Property("Ice.EventLog.Source", false, "", false),
     new Property("Ice.FactoryAssemblies", false, "", false),
+    new Property("Ice.Hedging.Budget", false, "10", false),
+    new Property("Ice.Hedging.MinDelay", false, "1", false),
+    new Property("Ice.Hedging.Percentile", false, "0", false),
     new Property("Ice.HTTPProxyHost", false, "", false),
     new Property("Ice.HTTPProxyPort", false, "1080", false),
     new Property("Ice.ImplicitContext", false, "None", false),
@@ -131,6 +158,7 @@ public final class PropertyNames {
     new Property("Ice.PrintProcessId", false, "", false),
     new Property("Ice.PrintStackTraces", false, "0", false),
     new Property("Ice.ProgramName", false, "", false),
+    new Property("Ice.PropagateDeadline", false, "0", false),
     new Property("Ice.RetryIntervals", false, "0", false),
     new Property("Ice.ServerIdleTime", false, "0", false),
     new Property("Ice.SOCKSProxyHost", false, "", false),
@@ -145,6 +173,8 @@ public final class PropertyNames {
     new Property("Ice.ThreadPool.Client.Serialize", false, "0", false),
     new Property("Ice.ThreadPool.Client.ThreadIdleTime", false, "60", false),
     new Property("Ice.ThreadPool.Client.ThreadPriority", false, "", false),
+    new Property("Ice.ThreadPool.Client.Reactors", false, "1", false),
+    new Property("Ice.ThreadPool.Client.IoUring", false, "0", false),
     new Property("Ice.ThreadPool.Server.Size", false, "1", false),
     new Property("Ice.ThreadPool.Server.SizeMax", false, "", false),
     new Property("Ice.ThreadPool.Server.SizeWarn", false, "0", false),
@@ -152,6 +182,8 @@ public final class PropertyNames {
     new Property("Ice.ThreadPool.Server.Serialize", false, "0", false),
     new Property("Ice.ThreadPool.Server.ThreadIdleTime", false, "60", false),
     new Property("Ice.ThreadPool.Server.ThreadPriority", false, "", false),
+    new Property("Ice.ThreadPool.Server.Reactors", false, "1", false),
+    new Property("Ice.ThreadPool.Server.IoUring", false, "0", false),
     new Property("Ice.ThreadPriority", false, "", false),
     new Property("Ice.ToStringMode", false, "Unicode", false),
     new Property("Ice.Trace.Admin.Properties", false, "0", false),
@@ -187,6 +219,8 @@ public final class PropertyNames {
     new Property("IceMX\\.Metrics\\.[^\\s]+\\.GroupBy", true, "", false),
     new Property("IceMX\\.Metrics\\.[^\\s]+\\.Map", true, "", false),
     new Property("IceMX\\.Metrics\\.[^\\s]+\\.RetainDetached", true, "10", false),
+    new Property("IceMX\\.Metrics\\.[^\\s]+\\.Histogram\\.Min", true, "1", false),
+    new Property("IceMX\\.Metrics\\.[^\\s]+\\.Histogram\\.Max", true, "1073741824", false),
     new Property("IceMX\\.Metrics\\.[^\\s]+\\.Accept", true, "", false),
     new Property("IceMX\\.Metrics\\.[^\\s]+\\.Reject", true, "", false),
     new Property("IceMX\\.Metrics\\.[^\\s]+", true, "", false),
@@ -197,14 +231,27 @@ public final class PropertyNames {
     new Property("IceDiscovery.Multicast.AdapterId", false, "", false),
     new Property("IceDiscovery.Multicast.Connection.CloseTimeout", false, "10", false),
     new Property("IceDiscovery.Multicast.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceDiscovery.Multicast.Connection.CorkDelay", false, "100", false),
+    new Property("IceDiscovery.Multicast.Connection.CorkSize", false, "0", false),
     new Property("IceDiscovery.Multicast.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceDiscovery.Multicast.Connection.IdleTimeout", false, "60", false),
     new Property("IceDiscovery.Multicast.Connection.InactivityTimeout", false, "300", false),
     new Property("IceDiscovery.Multicast.Connection.MaxDispatches", false, "100", false),
+    new Property("IceDiscovery.Multicast.Connection.ReadBufferSize", false, "0", false),
     new Property("IceDiscovery.Multicast.Connection", false, "", false),
+    new Property("IceDiscovery.Multicast.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceDiscovery.Multicast.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceDiscovery.Multicast.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceDiscovery.Multicast.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceDiscovery.Multicast.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceDiscovery.Multicast.Dispatch.Deadline", false, "0", false),
+    new Property("IceDiscovery.Multicast.Dispatch.Executor", false, "", false),
+    new Property("IceDiscovery.Multicast.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceDiscovery.Multicast.Dispatch.Size", false, "0", false),
     new Property("IceDiscovery.Multicast.Endpoints", false, "", false),
     new Property("IceDiscovery.Multicast.Locator.EndpointSelection", false, "", false),
     new Property("IceDiscovery.Multicast.Locator.ConnectionCached", false, "", false),
+    new Property("IceDiscovery.Multicast.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceDiscovery.Multicast.Locator.PreferSecure", false, "", false),
     new Property("IceDiscovery.Multicast.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceDiscovery.Multicast.Locator.InvocationTimeout", false, "", false),
@@ -217,6 +264,7 @@ public final class PropertyNames {
     new Property("IceDiscovery.Multicast.ReplicaGroupId", false, "", false),
     new Property("IceDiscovery.Multicast.Router.EndpointSelection", false, "", false),
     new Property("IceDiscovery.Multicast.Router.ConnectionCached", false, "", false),
+    new Property("IceDiscovery.Multicast.Router.ConnectionPoolSize", false, "", false),
     new Property("IceDiscovery.Multicast.Router.PreferSecure", false, "", false),
     new Property("IceDiscovery.Multicast.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceDiscovery.Multicast.Router.InvocationTimeout", false, "", false),
@@ -233,18 +281,33 @@ public final class PropertyNames {
     new Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, "0", false),
     new Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceDiscovery.Multicast.ThreadPool.Reactors", false, "1", false),
+    new Property("IceDiscovery.Multicast.ThreadPool.IoUring", false, "0", false),
     new Property("IceDiscovery.Multicast.MessageSizeMax", false, "", false),
     new Property("IceDiscovery.Reply.AdapterId", false, "", false),
     new Property("IceDiscovery.Reply.Connection.CloseTimeout", false, "10", false),
     new Property("IceDiscovery.Reply.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceDiscovery.Reply.Connection.CorkDelay", false, "100", false),
+    new Property("IceDiscovery.Reply.Connection.CorkSize", false, "0", false),
     new Property("IceDiscovery.Reply.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceDiscovery.Reply.Connection.IdleTimeout", false, "60", false),
     new Property("IceDiscovery.Reply.Connection.InactivityTimeout", false, "300", false),
     new Property("IceDiscovery.Reply.Connection.MaxDispatches", false, "100", false),
+    new Property("IceDiscovery.Reply.Connection.ReadBufferSize", false, "0", false),
     new Property("IceDiscovery.Reply.Connection", false, "", false),
+    new Property("IceDiscovery.Reply.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceDiscovery.Reply.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceDiscovery.Reply.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceDiscovery.Reply.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceDiscovery.Reply.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceDiscovery.Reply.Dispatch.Deadline", false, "0", false),
+    new Property("IceDiscovery.Reply.Dispatch.Executor", false, "", false),
+    new Property("IceDiscovery.Reply.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceDiscovery.Reply.Dispatch.Size", false, "0", false),
     new Property("IceDiscovery.Reply.Endpoints", false, "", false),
     new Property("IceDiscovery.Reply.Locator.EndpointSelection", false, "", false),
     new Property("IceDiscovery.Reply.Locator.ConnectionCached", false, "", false),
+    new Property("IceDiscovery.Reply.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceDiscovery.Reply.Locator.PreferSecure", false, "", false),
     new Property("IceDiscovery.Reply.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceDiscovery.Reply.Locator.InvocationTimeout", false, "", false),
@@ -257,6 +320,7 @@ public final class PropertyNames {
     new Property("IceDiscovery.Reply.ReplicaGroupId", false, "", false),
     new Property("IceDiscovery.Reply.Router.EndpointSelection", false, "", false),
     new Property("IceDiscovery.Reply.Router.ConnectionCached", false, "", false),
+    new Property("IceDiscovery.Reply.Router.ConnectionPoolSize", false, "", false),
     new Property("IceDiscovery.Reply.Router.PreferSecure", false, "", false),
     new Property("IceDiscovery.Reply.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceDiscovery.Reply.Router.InvocationTimeout", false, "", false),
@@ -273,18 +337,33 @@ public final class PropertyNames {
     new Property("IceDiscovery.Reply.ThreadPool.Serialize", false, "0", false),
     new Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceDiscovery.Reply.ThreadPool.Reactors", false, "1", false),
+    new Property("IceDiscovery.Reply.ThreadPool.IoUring", false, "0", false),
     new Property("IceDiscovery.Reply.MessageSizeMax", false, "", false),
     new Property("IceDiscovery.Locator.AdapterId", false, "", false),
     new Property("IceDiscovery.Locator.Connection.CloseTimeout", false, "10", false),
     new Property("IceDiscovery.Locator.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceDiscovery.Locator.Connection.CorkDelay", false, "100", false),
+    new Property("IceDiscovery.Locator.Connection.CorkSize", false, "0", false),
     new Property("IceDiscovery.Locator.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceDiscovery.Locator.Connection.IdleTimeout", false, "60", false),
     new Property("IceDiscovery.Locator.Connection.InactivityTimeout", false, "300", false),
     new Property("IceDiscovery.Locator.Connection.MaxDispatches", false, "100", false),
+    new Property("IceDiscovery.Locator.Connection.ReadBufferSize", false, "0", false),
     new Property("IceDiscovery.Locator.Connection", false, "", false),
+    new Property("IceDiscovery.Locator.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceDiscovery.Locator.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceDiscovery.Locator.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceDiscovery.Locator.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceDiscovery.Locator.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceDiscovery.Locator.Dispatch.Deadline", false, "0", false),
+    new Property("IceDiscovery.Locator.Dispatch.Executor", false, "", false),
+    new Property("IceDiscovery.Locator.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceDiscovery.Locator.Dispatch.Size", false, "0", false),
     new Property("IceDiscovery.Locator.Endpoints", false, "", false),
     new Property("IceDiscovery.Locator.Locator.EndpointSelection", false, "", false),
     new Property("IceDiscovery.Locator.Locator.ConnectionCached", false, "", false),
+    new Property("IceDiscovery.Locator.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceDiscovery.Locator.Locator.PreferSecure", false, "", false),
     new Property("IceDiscovery.Locator.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceDiscovery.Locator.Locator.InvocationTimeout", false, "", false),
@@ -297,6 +376,7 @@ public final class PropertyNames {
     new Property("IceDiscovery.Locator.ReplicaGroupId", false, "", false),
     new Property("IceDiscovery.Locator.Router.EndpointSelection", false, "", false),
     new Property("IceDiscovery.Locator.Router.ConnectionCached", false, "", false),
+    new Property("IceDiscovery.Locator.Router.ConnectionPoolSize", false, "", false),
     new Property("IceDiscovery.Locator.Router.PreferSecure", false, "", false),
     new Property("IceDiscovery.Locator.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceDiscovery.Locator.Router.InvocationTimeout", false, "", false),
@@ -313,6 +393,8 @@ public final class PropertyNames {
     new Property("IceDiscovery.Locator.ThreadPool.Serialize", false, "0", false),
     new Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceDiscovery.Locator.ThreadPool.Reactors", false, "1", false),
+    new Property("IceDiscovery.Locator.ThreadPool.IoUring", false, "0", false),
     new Property("IceDiscovery.Locator.MessageSizeMax", false, "", false),
     new Property("IceDiscovery.Lookup", false, "", false),
     new Property("IceDiscovery.Timeout", false, "300", false),
@@ -329,14 +411,28 @@ public final class PropertyNames {
     new Property("IceLocatorDiscovery.Reply.AdapterId", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Connection.CloseTimeout", false, "10", false),
     new Property("IceLocatorDiscovery.Reply.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceLocatorDiscovery.Reply.Connection.CorkDelay", false, "100", false),
+    new Property("IceLocatorDiscovery.Reply.Connection.CorkSize", false, "0", false),
     new Property("IceLocatorDiscovery.Reply.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceLocatorDiscovery.Reply.Connection.IdleTimeout", false, "60", false),
     new Property("IceLocatorDiscovery.Reply.Connection.InactivityTimeout", false, "300", false),
     new Property("IceLocatorDiscovery.Reply.Connection.MaxDispatches", false, "100", false),
+    new Property("IceLocatorDiscovery.Reply.Connection.ReadBufferSize", false, "0", false),
     new Property("IceLocatorDiscovery.Reply.Connection", false, "", false),
+    new Property("IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property(
+        "IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceLocatorDiscovery.Reply.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceLocatorDiscovery.Reply.Dispatch.Deadline", false, "0", false),
+    new Property("IceLocatorDiscovery.Reply.Dispatch.Executor", false, "", false),
+    new Property("IceLocatorDiscovery.Reply.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceLocatorDiscovery.Reply.Dispatch.Size", false, "0", false),
     new Property("IceLocatorDiscovery.Reply.Endpoints", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Locator.EndpointSelection", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Locator.ConnectionCached", false, "", false),
+    new Property("IceLocatorDiscovery.Reply.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Locator.PreferSecure", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Locator.InvocationTimeout", false, "", false),
@@ -349,6 +445,7 @@ public final class PropertyNames {
     new Property("IceLocatorDiscovery.Reply.ReplicaGroupId", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Router.EndpointSelection", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Router.ConnectionCached", false, "", false),
+    new Property("IceLocatorDiscovery.Reply.Router.ConnectionPoolSize", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Router.PreferSecure", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceLocatorDiscovery.Reply.Router.InvocationTimeout", false, "", false),
@@ -365,18 +462,35 @@ public final class PropertyNames {
     new Property("IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, "0", false),
     new Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceLocatorDiscovery.Reply.ThreadPool.Reactors", false, "1", false),
+    new Property("IceLocatorDiscovery.Reply.ThreadPool.IoUring", false, "0", false),
     new Property("IceLocatorDiscovery.Reply.MessageSizeMax", false, "", false),
     new Property("IceLocatorDiscovery.Locator.AdapterId", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Connection.CloseTimeout", false, "10", false),
     new Property("IceLocatorDiscovery.Locator.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceLocatorDiscovery.Locator.Connection.CorkDelay", false, "100", false),
+    new Property("IceLocatorDiscovery.Locator.Connection.CorkSize", false, "0", false),
     new Property("IceLocatorDiscovery.Locator.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceLocatorDiscovery.Locator.Connection.IdleTimeout", false, "60", false),
     new Property("IceLocatorDiscovery.Locator.Connection.InactivityTimeout", false, "300", false),
     new Property("IceLocatorDiscovery.Locator.Connection.MaxDispatches", false, "100", false),
+    new Property("IceLocatorDiscovery.Locator.Connection.ReadBufferSize", false, "0", false),
     new Property("IceLocatorDiscovery.Locator.Connection", false, "", false),
+    new Property("IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property(
+        "IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property(
+        "IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceLocatorDiscovery.Locator.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceLocatorDiscovery.Locator.Dispatch.Deadline", false, "0", false),
+    new Property("IceLocatorDiscovery.Locator.Dispatch.Executor", false, "", false),
+    new Property("IceLocatorDiscovery.Locator.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceLocatorDiscovery.Locator.Dispatch.Size", false, "0", false),
     new Property("IceLocatorDiscovery.Locator.Endpoints", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Locator.EndpointSelection", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Locator.ConnectionCached", false, "", false),
+    new Property("IceLocatorDiscovery.Locator.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Locator.PreferSecure", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Locator.InvocationTimeout", false, "", false),
@@ -389,6 +503,7 @@ public final class PropertyNames {
     new Property("IceLocatorDiscovery.Locator.ReplicaGroupId", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Router.EndpointSelection", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Router.ConnectionCached", false, "", false),
+    new Property("IceLocatorDiscovery.Locator.Router.ConnectionPoolSize", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Router.PreferSecure", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceLocatorDiscovery.Locator.Router.InvocationTimeout", false, "", false),
@@ -405,6 +520,8 @@ public final class PropertyNames {
     new Property("IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, "0", false),
     new Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceLocatorDiscovery.Locator.ThreadPool.Reactors", false, "1", false),
+    new Property("IceLocatorDiscovery.Locator.ThreadPool.IoUring", false, "0", false),
     new Property("IceLocatorDiscovery.Locator.MessageSizeMax", false, "", false),
     new Property("IceLocatorDiscovery.Lookup", false, "", false),
     new Property("IceLocatorDiscovery.Timeout", false, "", false),
@@ -442,6 +559,7 @@ public final class PropertyNames {
   public static final Property IceBoxAdminProps[] = {
     new Property("IceBoxAdmin.ServiceManager.Proxy.EndpointSelection", false, "", false),
     new Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionCached", false, "", false),
+    new Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionPoolSize", false, "", false),
     new Property("IceBoxAdmin.ServiceManager.Proxy.PreferSecure", false, "", false),
     new Property("IceBoxAdmin.ServiceManager.Proxy.LocatorCacheTimeout", false, "", false),
     new Property("IceBoxAdmin.ServiceManager.Proxy.InvocationTimeout", false, "", false),
@@ -457,14 +575,27 @@ public final class PropertyNames {
     new Property("IceBridge.Source.AdapterId", false, "", false),
     new Property("IceBridge.Source.Connection.CloseTimeout", false, "10", false),
     new Property("IceBridge.Source.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceBridge.Source.Connection.CorkDelay", false, "100", false),
+    new Property("IceBridge.Source.Connection.CorkSize", false, "0", false),
     new Property("IceBridge.Source.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceBridge.Source.Connection.IdleTimeout", false, "60", false),
     new Property("IceBridge.Source.Connection.InactivityTimeout", false, "300", false),
     new Property("IceBridge.Source.Connection.MaxDispatches", false, "100", false),
+    new Property("IceBridge.Source.Connection.ReadBufferSize", false, "0", false),
     new Property("IceBridge.Source.Connection", false, "", false),
+    new Property("IceBridge.Source.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceBridge.Source.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceBridge.Source.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceBridge.Source.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceBridge.Source.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceBridge.Source.Dispatch.Deadline", false, "0", false),
+    new Property("IceBridge.Source.Dispatch.Executor", false, "", false),
+    new Property("IceBridge.Source.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceBridge.Source.Dispatch.Size", false, "0", false),
     new Property("IceBridge.Source.Endpoints", false, "", false),
     new Property("IceBridge.Source.Locator.EndpointSelection", false, "", false),
     new Property("IceBridge.Source.Locator.ConnectionCached", false, "", false),
+    new Property("IceBridge.Source.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceBridge.Source.Locator.PreferSecure", false, "", false),
     new Property("IceBridge.Source.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceBridge.Source.Locator.InvocationTimeout", false, "", false),
@@ -477,6 +608,7 @@ public final class PropertyNames {
     new Property("IceBridge.Source.ReplicaGroupId", false, "", false),
     new Property("IceBridge.Source.Router.EndpointSelection", false, "", false),
     new Property("IceBridge.Source.Router.ConnectionCached", false, "", false),
+    new Property("IceBridge.Source.Router.ConnectionPoolSize", false, "", false),
     new Property("IceBridge.Source.Router.PreferSecure", false, "", false),
     new Property("IceBridge.Source.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceBridge.Source.Router.InvocationTimeout", false, "", false),
@@ -493,6 +625,8 @@ public final class PropertyNames {
     new Property("IceBridge.Source.ThreadPool.Serialize", false, "0", false),
     new Property("IceBridge.Source.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceBridge.Source.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceBridge.Source.ThreadPool.Reactors", false, "1", false),
+    new Property("IceBridge.Source.ThreadPool.IoUring", false, "0", false),
     new Property("IceBridge.Source.MessageSizeMax", false, "", false),
     new Property("IceBridge.Target.Endpoints", false, "", false),
     new Property("IceBridge.InstanceName", false, "IceBridge", false),
@@ -511,14 +645,27 @@ public final class PropertyNames {
     new Property("IceGridAdmin.Server.AdapterId", false, "", false),
     new Property("IceGridAdmin.Server.Connection.CloseTimeout", false, "10", false),
     new Property("IceGridAdmin.Server.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGridAdmin.Server.Connection.CorkDelay", false, "100", false),
+    new Property("IceGridAdmin.Server.Connection.CorkSize", false, "0", false),
     new Property("IceGridAdmin.Server.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGridAdmin.Server.Connection.IdleTimeout", false, "60", false),
     new Property("IceGridAdmin.Server.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGridAdmin.Server.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGridAdmin.Server.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGridAdmin.Server.Connection", false, "", false),
+    new Property("IceGridAdmin.Server.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceGridAdmin.Server.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceGridAdmin.Server.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceGridAdmin.Server.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGridAdmin.Server.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGridAdmin.Server.Dispatch.Deadline", false, "0", false),
+    new Property("IceGridAdmin.Server.Dispatch.Executor", false, "", false),
+    new Property("IceGridAdmin.Server.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGridAdmin.Server.Dispatch.Size", false, "0", false),
     new Property("IceGridAdmin.Server.Endpoints", false, "", false),
     new Property("IceGridAdmin.Server.Locator.EndpointSelection", false, "", false),
     new Property("IceGridAdmin.Server.Locator.ConnectionCached", false, "", false),
+    new Property("IceGridAdmin.Server.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGridAdmin.Server.Locator.PreferSecure", false, "", false),
     new Property("IceGridAdmin.Server.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGridAdmin.Server.Locator.InvocationTimeout", false, "", false),
@@ -531,6 +678,7 @@ public final class PropertyNames {
     new Property("IceGridAdmin.Server.ReplicaGroupId", false, "", false),
     new Property("IceGridAdmin.Server.Router.EndpointSelection", false, "", false),
     new Property("IceGridAdmin.Server.Router.ConnectionCached", false, "", false),
+    new Property("IceGridAdmin.Server.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGridAdmin.Server.Router.PreferSecure", false, "", false),
     new Property("IceGridAdmin.Server.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGridAdmin.Server.Router.InvocationTimeout", false, "", false),
@@ -547,6 +695,8 @@ public final class PropertyNames {
     new Property("IceGridAdmin.Server.ThreadPool.Serialize", false, "0", false),
     new Property("IceGridAdmin.Server.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGridAdmin.Server.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGridAdmin.Server.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGridAdmin.Server.ThreadPool.IoUring", false, "0", false),
     new Property("IceGridAdmin.Server.MessageSizeMax", false, "", false),
     new Property("IceGridAdmin.Discovery.Address", false, "", false),
     new Property("IceGridAdmin.Discovery.Interface", false, "", false),
@@ -554,14 +704,30 @@ public final class PropertyNames {
     new Property("IceGridAdmin.Discovery.Reply.AdapterId", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Connection.CloseTimeout", false, "10", false),
     new Property("IceGridAdmin.Discovery.Reply.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGridAdmin.Discovery.Reply.Connection.CorkDelay", false, "100", false),
+    new Property("IceGridAdmin.Discovery.Reply.Connection.CorkSize", false, "0", false),
     new Property("IceGridAdmin.Discovery.Reply.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGridAdmin.Discovery.Reply.Connection.IdleTimeout", false, "60", false),
     new Property("IceGridAdmin.Discovery.Reply.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGridAdmin.Discovery.Reply.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGridAdmin.Discovery.Reply.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGridAdmin.Discovery.Reply.Connection", false, "", false),
+    new Property("IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property(
+        "IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property(
+        "IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property(
+        "IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGridAdmin.Discovery.Reply.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGridAdmin.Discovery.Reply.Dispatch.Deadline", false, "0", false),
+    new Property("IceGridAdmin.Discovery.Reply.Dispatch.Executor", false, "", false),
+    new Property("IceGridAdmin.Discovery.Reply.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGridAdmin.Discovery.Reply.Dispatch.Size", false, "0", false),
     new Property("IceGridAdmin.Discovery.Reply.Endpoints", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Locator.EndpointSelection", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionCached", false, "", false),
+    new Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Locator.InvocationTimeout", false, "", false),
@@ -574,6 +740,7 @@ public final class PropertyNames {
     new Property("IceGridAdmin.Discovery.Reply.ReplicaGroupId", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Router.EndpointSelection", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Router.ConnectionCached", false, "", false),
+    new Property("IceGridAdmin.Discovery.Reply.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Router.PreferSecure", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGridAdmin.Discovery.Reply.Router.InvocationTimeout", false, "", false),
@@ -590,19 +757,37 @@ public final class PropertyNames {
     new Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, "0", false),
     new Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGridAdmin.Discovery.Reply.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGridAdmin.Discovery.Reply.ThreadPool.IoUring", false, "0", false),
     new Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.AdapterId", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Connection.CloseTimeout", false, "10", false),
     new Property("IceGridAdmin.Discovery.Locator.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGridAdmin.Discovery.Locator.Connection.CorkDelay", false, "100", false),
+    new Property("IceGridAdmin.Discovery.Locator.Connection.CorkSize", false, "0", false),
     new Property("IceGridAdmin.Discovery.Locator.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGridAdmin.Discovery.Locator.Connection.IdleTimeout", false, "60", false),
     new Property(
         "IceGridAdmin.Discovery.Locator.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGridAdmin.Discovery.Locator.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGridAdmin.Discovery.Locator.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGridAdmin.Discovery.Locator.Connection", false, "", false),
+    new Property("IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property(
+        "IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property(
+        "IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property(
+        "IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGridAdmin.Discovery.Locator.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGridAdmin.Discovery.Locator.Dispatch.Deadline", false, "0", false),
+    new Property("IceGridAdmin.Discovery.Locator.Dispatch.Executor", false, "", false),
+    new Property("IceGridAdmin.Discovery.Locator.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGridAdmin.Discovery.Locator.Dispatch.Size", false, "0", false),
     new Property("IceGridAdmin.Discovery.Locator.Endpoints", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Locator.EndpointSelection", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Locator.ConnectionCached", false, "", false),
+    new Property("IceGridAdmin.Discovery.Locator.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Locator.PreferSecure", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Locator.InvocationTimeout", false, "", false),
@@ -616,6 +801,7 @@ public final class PropertyNames {
     new Property("IceGridAdmin.Discovery.Locator.ReplicaGroupId", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Router.EndpointSelection", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Router.ConnectionCached", false, "", false),
+    new Property("IceGridAdmin.Discovery.Locator.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Router.PreferSecure", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGridAdmin.Discovery.Locator.Router.InvocationTimeout", false, "", false),
@@ -633,6 +819,8 @@ public final class PropertyNames {
     new Property("IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, "0", false),
     new Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGridAdmin.Discovery.Locator.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGridAdmin.Discovery.Locator.ThreadPool.IoUring", false, "0", false),
     new Property("IceGridAdmin.Discovery.Locator.MessageSizeMax", false, "", false),
     new Property("IceGridAdmin.Trace.Observers", false, "", false),
     new Property("IceGridAdmin.Trace.SaveToRegistry", false, "", false),
@@ -643,14 +831,27 @@ public final class PropertyNames {
     new Property("IceGrid.AdminRouter.AdapterId", false, "", false),
     new Property("IceGrid.AdminRouter.Connection.CloseTimeout", false, "10", false),
     new Property("IceGrid.AdminRouter.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGrid.AdminRouter.Connection.CorkDelay", false, "100", false),
+    new Property("IceGrid.AdminRouter.Connection.CorkSize", false, "0", false),
     new Property("IceGrid.AdminRouter.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGrid.AdminRouter.Connection.IdleTimeout", false, "60", false),
     new Property("IceGrid.AdminRouter.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGrid.AdminRouter.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGrid.AdminRouter.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGrid.AdminRouter.Connection", false, "", false),
+    new Property("IceGrid.AdminRouter.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceGrid.AdminRouter.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceGrid.AdminRouter.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceGrid.AdminRouter.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGrid.AdminRouter.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGrid.AdminRouter.Dispatch.Deadline", false, "0", false),
+    new Property("IceGrid.AdminRouter.Dispatch.Executor", false, "", false),
+    new Property("IceGrid.AdminRouter.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGrid.AdminRouter.Dispatch.Size", false, "0", false),
     new Property("IceGrid.AdminRouter.Endpoints", false, "", false),
     new Property("IceGrid.AdminRouter.Locator.EndpointSelection", false, "", false),
     new Property("IceGrid.AdminRouter.Locator.ConnectionCached", false, "", false),
+    new Property("IceGrid.AdminRouter.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.AdminRouter.Locator.PreferSecure", false, "", false),
     new Property("IceGrid.AdminRouter.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.AdminRouter.Locator.InvocationTimeout", false, "", false),
@@ -663,6 +864,7 @@ public final class PropertyNames {
     new Property("IceGrid.AdminRouter.ReplicaGroupId", false, "", false),
     new Property("IceGrid.AdminRouter.Router.EndpointSelection", false, "", false),
     new Property("IceGrid.AdminRouter.Router.ConnectionCached", false, "", false),
+    new Property("IceGrid.AdminRouter.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.AdminRouter.Router.PreferSecure", false, "", false),
     new Property("IceGrid.AdminRouter.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.AdminRouter.Router.InvocationTimeout", false, "", false),
@@ -679,19 +881,34 @@ public final class PropertyNames {
     new Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, "0", false),
     new Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGrid.AdminRouter.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGrid.AdminRouter.ThreadPool.IoUring", false, "0", false),
     new Property("IceGrid.AdminRouter.MessageSizeMax", false, "", false),
     new Property("IceGrid.InstanceName", false, "IceGrid", false),
     new Property("IceGrid.Node.AdapterId", false, "", false),
     new Property("IceGrid.Node.Connection.CloseTimeout", false, "10", false),
     new Property("IceGrid.Node.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGrid.Node.Connection.CorkDelay", false, "100", false),
+    new Property("IceGrid.Node.Connection.CorkSize", false, "0", false),
     new Property("IceGrid.Node.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGrid.Node.Connection.IdleTimeout", false, "60", false),
     new Property("IceGrid.Node.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGrid.Node.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGrid.Node.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGrid.Node.Connection", false, "", false),
+    new Property("IceGrid.Node.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceGrid.Node.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceGrid.Node.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceGrid.Node.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGrid.Node.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGrid.Node.Dispatch.Deadline", false, "0", false),
+    new Property("IceGrid.Node.Dispatch.Executor", false, "", false),
+    new Property("IceGrid.Node.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGrid.Node.Dispatch.Size", false, "0", false),
     new Property("IceGrid.Node.Endpoints", false, "", false),
     new Property("IceGrid.Node.Locator.EndpointSelection", false, "", false),
     new Property("IceGrid.Node.Locator.ConnectionCached", false, "", false),
+    new Property("IceGrid.Node.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Node.Locator.PreferSecure", false, "", false),
     new Property("IceGrid.Node.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Node.Locator.InvocationTimeout", false, "", false),
@@ -704,6 +921,7 @@ public final class PropertyNames {
     new Property("IceGrid.Node.ReplicaGroupId", false, "", false),
     new Property("IceGrid.Node.Router.EndpointSelection", false, "", false),
     new Property("IceGrid.Node.Router.ConnectionCached", false, "", false),
+    new Property("IceGrid.Node.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Node.Router.PreferSecure", false, "", false),
     new Property("IceGrid.Node.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Node.Router.InvocationTimeout", false, "", false),
@@ -720,6 +938,8 @@ public final class PropertyNames {
     new Property("IceGrid.Node.ThreadPool.Serialize", false, "0", false),
     new Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGrid.Node.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGrid.Node.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGrid.Node.ThreadPool.IoUring", false, "0", false),
     new Property("IceGrid.Node.MessageSizeMax", false, "", false),
     new Property("IceGrid.Node.AllowRunningServersAsRoot", false, "", false),
     new Property("IceGrid.Node.AllowEndpointsOverride", false, "0", false),
@@ -741,6 +961,7 @@ public final class PropertyNames {
     new Property("IceGrid.Node.UserAccounts", false, "", false),
     new Property("IceGrid.Node.UserAccountMapper.EndpointSelection", false, "", false),
     new Property("IceGrid.Node.UserAccountMapper.ConnectionCached", false, "", false),
+    new Property("IceGrid.Node.UserAccountMapper.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Node.UserAccountMapper.PreferSecure", false, "", false),
     new Property("IceGrid.Node.UserAccountMapper.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Node.UserAccountMapper.InvocationTimeout", false, "", false),
@@ -753,6 +974,7 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.AdminCryptPasswords", false, "", false),
     new Property("IceGrid.Registry.AdminPermissionsVerifier.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.AdminPermissionsVerifier.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.AdminPermissionsVerifier.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.AdminPermissionsVerifier.InvocationTimeout", false, "", false),
@@ -769,6 +991,8 @@ public final class PropertyNames {
         "IceGrid.Registry.AdminSessionManager.Connection.CloseTimeout", false, "10", false),
     new Property(
         "IceGrid.Registry.AdminSessionManager.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGrid.Registry.AdminSessionManager.Connection.CorkDelay", false, "100", false),
+    new Property("IceGrid.Registry.AdminSessionManager.Connection.CorkSize", false, "0", false),
     new Property(
         "IceGrid.Registry.AdminSessionManager.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGrid.Registry.AdminSessionManager.Connection.IdleTimeout", false, "60", false),
@@ -776,11 +1000,35 @@ public final class PropertyNames {
         "IceGrid.Registry.AdminSessionManager.Connection.InactivityTimeout", false, "300", false),
     new Property(
         "IceGrid.Registry.AdminSessionManager.Connection.MaxDispatches", false, "100", false),
+    new Property(
+        "IceGrid.Registry.AdminSessionManager.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGrid.Registry.AdminSessionManager.Connection", false, "", false),
+    new Property(
+        "IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property(
+        "IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit.Initial",
+        false,
+        "20",
+        false),
+    new Property(
+        "IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit.Latency",
+        false,
+        "100",
+        false),
+    new Property(
+        "IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property(
+        "IceGrid.Registry.AdminSessionManager.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGrid.Registry.AdminSessionManager.Dispatch.Deadline", false, "0", false),
+    new Property("IceGrid.Registry.AdminSessionManager.Dispatch.Executor", false, "", false),
+    new Property("IceGrid.Registry.AdminSessionManager.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGrid.Registry.AdminSessionManager.Dispatch.Size", false, "0", false),
     new Property("IceGrid.Registry.AdminSessionManager.Endpoints", false, "", false),
     new Property(
         "IceGrid.Registry.AdminSessionManager.Locator.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionCached", false, "", false),
+    new Property(
+        "IceGrid.Registry.AdminSessionManager.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, "", false),
     new Property(
         "IceGrid.Registry.AdminSessionManager.Locator.LocatorCacheTimeout", false, "", false),
@@ -797,6 +1045,8 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.AdminSessionManager.ReplicaGroupId", false, "", false),
     new Property("IceGrid.Registry.AdminSessionManager.Router.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionCached", false, "", false),
+    new Property(
+        "IceGrid.Registry.AdminSessionManager.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.AdminSessionManager.Router.PreferSecure", false, "", false),
     new Property(
         "IceGrid.Registry.AdminSessionManager.Router.LocatorCacheTimeout", false, "", false),
@@ -818,10 +1068,14 @@ public final class PropertyNames {
         "IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property(
         "IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGrid.Registry.AdminSessionManager.ThreadPool.IoUring", false, "0", false),
     new Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, "", false),
     new Property(
         "IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, "", false),
+    new Property(
+        "IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, "", false),
     new Property(
         "IceGrid.Registry.AdminSSLPermissionsVerifier.LocatorCacheTimeout", false, "", false),
@@ -837,14 +1091,27 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Client.AdapterId", false, "", false),
     new Property("IceGrid.Registry.Client.Connection.CloseTimeout", false, "10", false),
     new Property("IceGrid.Registry.Client.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGrid.Registry.Client.Connection.CorkDelay", false, "100", false),
+    new Property("IceGrid.Registry.Client.Connection.CorkSize", false, "0", false),
     new Property("IceGrid.Registry.Client.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGrid.Registry.Client.Connection.IdleTimeout", false, "60", false),
     new Property("IceGrid.Registry.Client.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGrid.Registry.Client.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGrid.Registry.Client.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGrid.Registry.Client.Connection", false, "", false),
+    new Property("IceGrid.Registry.Client.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceGrid.Registry.Client.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceGrid.Registry.Client.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceGrid.Registry.Client.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGrid.Registry.Client.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGrid.Registry.Client.Dispatch.Deadline", false, "0", false),
+    new Property("IceGrid.Registry.Client.Dispatch.Executor", false, "", false),
+    new Property("IceGrid.Registry.Client.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGrid.Registry.Client.Dispatch.Size", false, "0", false),
     new Property("IceGrid.Registry.Client.Endpoints", false, "", false),
     new Property("IceGrid.Registry.Client.Locator.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.Client.Locator.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.Client.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.Client.Locator.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.Client.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.Client.Locator.InvocationTimeout", false, "", false),
@@ -857,6 +1124,7 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Client.ReplicaGroupId", false, "", false),
     new Property("IceGrid.Registry.Client.Router.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.Client.Router.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.Client.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.Client.Router.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.Client.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.Client.Router.InvocationTimeout", false, "", false),
@@ -873,20 +1141,37 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, "0", false),
     new Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGrid.Registry.Client.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGrid.Registry.Client.ThreadPool.IoUring", false, "0", false),
     new Property("IceGrid.Registry.Client.MessageSizeMax", false, "", false),
     new Property("IceGrid.Registry.CryptPasswords", false, "", false),
     new Property("IceGrid.Registry.DefaultTemplates", false, "", false),
     new Property("IceGrid.Registry.Discovery.AdapterId", false, "", false),
     new Property("IceGrid.Registry.Discovery.Connection.CloseTimeout", false, "10", false),
     new Property("IceGrid.Registry.Discovery.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGrid.Registry.Discovery.Connection.CorkDelay", false, "100", false),
+    new Property("IceGrid.Registry.Discovery.Connection.CorkSize", false, "0", false),
     new Property("IceGrid.Registry.Discovery.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGrid.Registry.Discovery.Connection.IdleTimeout", false, "60", false),
     new Property("IceGrid.Registry.Discovery.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGrid.Registry.Discovery.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGrid.Registry.Discovery.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGrid.Registry.Discovery.Connection", false, "", false),
+    new Property("IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property(
+        "IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property(
+        "IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGrid.Registry.Discovery.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGrid.Registry.Discovery.Dispatch.Deadline", false, "0", false),
+    new Property("IceGrid.Registry.Discovery.Dispatch.Executor", false, "", false),
+    new Property("IceGrid.Registry.Discovery.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGrid.Registry.Discovery.Dispatch.Size", false, "0", false),
     new Property("IceGrid.Registry.Discovery.Endpoints", false, "", false),
     new Property("IceGrid.Registry.Discovery.Locator.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.Discovery.Locator.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.Discovery.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.Discovery.Locator.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.Discovery.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.Discovery.Locator.InvocationTimeout", false, "", false),
@@ -899,6 +1184,7 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Discovery.ReplicaGroupId", false, "", false),
     new Property("IceGrid.Registry.Discovery.Router.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.Discovery.Router.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.Discovery.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.Discovery.Router.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.Discovery.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.Discovery.Router.InvocationTimeout", false, "", false),
@@ -915,6 +1201,8 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, "0", false),
     new Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGrid.Registry.Discovery.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGrid.Registry.Discovery.ThreadPool.IoUring", false, "0", false),
     new Property("IceGrid.Registry.Discovery.MessageSizeMax", false, "", false),
     new Property("IceGrid.Registry.Discovery.Enabled", false, "1", false),
     new Property("IceGrid.Registry.Discovery.Address", false, "", false),
@@ -924,14 +1212,28 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Internal.AdapterId", false, "", false),
     new Property("IceGrid.Registry.Internal.Connection.CloseTimeout", false, "10", false),
     new Property("IceGrid.Registry.Internal.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGrid.Registry.Internal.Connection.CorkDelay", false, "100", false),
+    new Property("IceGrid.Registry.Internal.Connection.CorkSize", false, "0", false),
     new Property("IceGrid.Registry.Internal.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGrid.Registry.Internal.Connection.IdleTimeout", false, "60", false),
     new Property("IceGrid.Registry.Internal.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGrid.Registry.Internal.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGrid.Registry.Internal.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGrid.Registry.Internal.Connection", false, "", false),
+    new Property("IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property(
+        "IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGrid.Registry.Internal.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGrid.Registry.Internal.Dispatch.Deadline", false, "0", false),
+    new Property("IceGrid.Registry.Internal.Dispatch.Executor", false, "", false),
+    new Property("IceGrid.Registry.Internal.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGrid.Registry.Internal.Dispatch.Size", false, "0", false),
     new Property("IceGrid.Registry.Internal.Endpoints", false, "", false),
     new Property("IceGrid.Registry.Internal.Locator.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.Internal.Locator.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.Internal.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.Internal.Locator.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.Internal.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.Internal.Locator.InvocationTimeout", false, "", false),
@@ -944,6 +1246,7 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Internal.ReplicaGroupId", false, "", false),
     new Property("IceGrid.Registry.Internal.Router.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.Internal.Router.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.Internal.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.Internal.Router.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.Internal.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.Internal.Router.InvocationTimeout", false, "", false),
@@ -960,11 +1263,14 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, "0", false),
     new Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGrid.Registry.Internal.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGrid.Registry.Internal.ThreadPool.IoUring", false, "0", false),
     new Property("IceGrid.Registry.Internal.MessageSizeMax", false, "", false),
     new Property("IceGrid.Registry.LMDB.MapSize", false, "", false),
     new Property("IceGrid.Registry.LMDB.Path", false, "", false),
     new Property("IceGrid.Registry.PermissionsVerifier.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.PermissionsVerifier.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.PermissionsVerifier.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.PermissionsVerifier.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.PermissionsVerifier.InvocationTimeout", false, "", false),
@@ -977,14 +1283,27 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Server.AdapterId", false, "", false),
     new Property("IceGrid.Registry.Server.Connection.CloseTimeout", false, "10", false),
     new Property("IceGrid.Registry.Server.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGrid.Registry.Server.Connection.CorkDelay", false, "100", false),
+    new Property("IceGrid.Registry.Server.Connection.CorkSize", false, "0", false),
     new Property("IceGrid.Registry.Server.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGrid.Registry.Server.Connection.IdleTimeout", false, "60", false),
     new Property("IceGrid.Registry.Server.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGrid.Registry.Server.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGrid.Registry.Server.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGrid.Registry.Server.Connection", false, "", false),
+    new Property("IceGrid.Registry.Server.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("IceGrid.Registry.Server.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("IceGrid.Registry.Server.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("IceGrid.Registry.Server.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("IceGrid.Registry.Server.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGrid.Registry.Server.Dispatch.Deadline", false, "0", false),
+    new Property("IceGrid.Registry.Server.Dispatch.Executor", false, "", false),
+    new Property("IceGrid.Registry.Server.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGrid.Registry.Server.Dispatch.Size", false, "0", false),
     new Property("IceGrid.Registry.Server.Endpoints", false, "", false),
     new Property("IceGrid.Registry.Server.Locator.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.Server.Locator.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.Server.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.Server.Locator.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.Server.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.Server.Locator.InvocationTimeout", false, "", false),
@@ -997,6 +1316,7 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Server.ReplicaGroupId", false, "", false),
     new Property("IceGrid.Registry.Server.Router.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.Server.Router.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.Server.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.Server.Router.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.Server.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.Server.Router.InvocationTimeout", false, "", false),
@@ -1013,20 +1333,39 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, "0", false),
     new Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGrid.Registry.Server.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGrid.Registry.Server.ThreadPool.IoUring", false, "0", false),
     new Property("IceGrid.Registry.Server.MessageSizeMax", false, "", false),
     new Property("IceGrid.Registry.SessionFilters", false, "0", false),
     new Property("IceGrid.Registry.SessionManager.AdapterId", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Connection.CloseTimeout", false, "10", false),
     new Property("IceGrid.Registry.SessionManager.Connection.ConnectTimeout", false, "10", false),
+    new Property("IceGrid.Registry.SessionManager.Connection.CorkDelay", false, "100", false),
+    new Property("IceGrid.Registry.SessionManager.Connection.CorkSize", false, "0", false),
     new Property("IceGrid.Registry.SessionManager.Connection.EnableIdleCheck", false, "1", false),
     new Property("IceGrid.Registry.SessionManager.Connection.IdleTimeout", false, "60", false),
     new Property(
         "IceGrid.Registry.SessionManager.Connection.InactivityTimeout", false, "300", false),
     new Property("IceGrid.Registry.SessionManager.Connection.MaxDispatches", false, "100", false),
+    new Property("IceGrid.Registry.SessionManager.Connection.ReadBufferSize", false, "0", false),
     new Property("IceGrid.Registry.SessionManager.Connection", false, "", false),
+    new Property("IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property(
+        "IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property(
+        "IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property(
+        "IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property(
+        "IceGrid.Registry.SessionManager.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("IceGrid.Registry.SessionManager.Dispatch.Deadline", false, "0", false),
+    new Property("IceGrid.Registry.SessionManager.Dispatch.Executor", false, "", false),
+    new Property("IceGrid.Registry.SessionManager.Dispatch.MaxDispatches", false, "0", false),
+    new Property("IceGrid.Registry.SessionManager.Dispatch.Size", false, "0", false),
     new Property("IceGrid.Registry.SessionManager.Endpoints", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Locator.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Locator.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.SessionManager.Locator.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Locator.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Locator.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Locator.InvocationTimeout", false, "", false),
@@ -1040,6 +1379,7 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.SessionManager.ReplicaGroupId", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Router.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Router.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.SessionManager.Router.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Router.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Router.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.SessionManager.Router.InvocationTimeout", false, "", false),
@@ -1057,9 +1397,12 @@ public final class PropertyNames {
     new Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, "0", false),
     new Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, "", false),
+    new Property("IceGrid.Registry.SessionManager.ThreadPool.Reactors", false, "1", false),
+    new Property("IceGrid.Registry.SessionManager.ThreadPool.IoUring", false, "0", false),
     new Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, "", false),
     new Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, "", false),
     new Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, "", false),
+    new Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionPoolSize", false, "", false),
     new Property("IceGrid.Registry.SSLPermissionsVerifier.PreferSecure", false, "", false),
     new Property("IceGrid.Registry.SSLPermissionsVerifier.LocatorCacheTimeout", false, "", false),
     new Property("IceGrid.Registry.SSLPermissionsVerifier.InvocationTimeout", false, "", false),
@@ -1138,14 +1481,27 @@ public final class PropertyNames {
     new Property("Glacier2.Client.AdapterId", false, "", false),
     new Property("Glacier2.Client.Connection.CloseTimeout", false, "10", false),
     new Property("Glacier2.Client.Connection.ConnectTimeout", false, "10", false),
+    new Property("Glacier2.Client.Connection.CorkDelay", false, "100", false),
+    new Property("Glacier2.Client.Connection.CorkSize", false, "0", false),
     new Property("Glacier2.Client.Connection.EnableIdleCheck", false, "1", false),
     new Property("Glacier2.Client.Connection.IdleTimeout", false, "60", false),
     new Property("Glacier2.Client.Connection.InactivityTimeout", false, "300", false),
     new Property("Glacier2.Client.Connection.MaxDispatches", false, "100", false),
+    new Property("Glacier2.Client.Connection.ReadBufferSize", false, "0", false),
     new Property("Glacier2.Client.Connection", false, "", false),
+    new Property("Glacier2.Client.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("Glacier2.Client.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("Glacier2.Client.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("Glacier2.Client.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("Glacier2.Client.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("Glacier2.Client.Dispatch.Deadline", false, "0", false),
+    new Property("Glacier2.Client.Dispatch.Executor", false, "", false),
+    new Property("Glacier2.Client.Dispatch.MaxDispatches", false, "0", false),
+    new Property("Glacier2.Client.Dispatch.Size", false, "0", false),
     new Property("Glacier2.Client.Endpoints", false, "", false),
     new Property("Glacier2.Client.Locator.EndpointSelection", false, "", false),
     new Property("Glacier2.Client.Locator.ConnectionCached", false, "", false),
+    new Property("Glacier2.Client.Locator.ConnectionPoolSize", false, "", false),
     new Property("Glacier2.Client.Locator.PreferSecure", false, "", false),
     new Property("Glacier2.Client.Locator.LocatorCacheTimeout", false, "", false),
     new Property("Glacier2.Client.Locator.InvocationTimeout", false, "", false),
@@ -1158,6 +1514,7 @@ public final class PropertyNames {
     new Property("Glacier2.Client.ReplicaGroupId", false, "", false),
     new Property("Glacier2.Client.Router.EndpointSelection", false, "", false),
     new Property("Glacier2.Client.Router.ConnectionCached", false, "", false),
+    new Property("Glacier2.Client.Router.ConnectionPoolSize", false, "", false),
     new Property("Glacier2.Client.Router.PreferSecure", false, "", false),
     new Property("Glacier2.Client.Router.LocatorCacheTimeout", false, "", false),
     new Property("Glacier2.Client.Router.InvocationTimeout", false, "", false),
@@ -1174,6 +1531,8 @@ public final class PropertyNames {
     new Property("Glacier2.Client.ThreadPool.Serialize", false, "0", false),
     new Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("Glacier2.Client.ThreadPool.ThreadPriority", false, "", false),
+    new Property("Glacier2.Client.ThreadPool.Reactors", false, "1", false),
+    new Property("Glacier2.Client.ThreadPool.IoUring", false, "0", false),
     new Property("Glacier2.Client.MessageSizeMax", false, "", false),
     new Property("Glacier2.Client.Buffered", false, "1", false),
     new Property("Glacier2.Client.ForwardContext", false, "0", false),
@@ -1192,6 +1551,7 @@ public final class PropertyNames {
     new Property("Glacier2.InstanceName", false, "Glacier2", false),
     new Property("Glacier2.PermissionsVerifier.EndpointSelection", false, "", false),
     new Property("Glacier2.PermissionsVerifier.ConnectionCached", false, "", false),
+    new Property("Glacier2.PermissionsVerifier.ConnectionPoolSize", false, "", false),
     new Property("Glacier2.PermissionsVerifier.PreferSecure", false, "", false),
     new Property("Glacier2.PermissionsVerifier.LocatorCacheTimeout", false, "", false),
     new Property("Glacier2.PermissionsVerifier.InvocationTimeout", false, "", false),
@@ -1203,6 +1563,7 @@ public final class PropertyNames {
     new Property("Glacier2.ReturnClientProxy", false, "", false),
     new Property("Glacier2.SSLPermissionsVerifier.EndpointSelection", false, "", false),
     new Property("Glacier2.SSLPermissionsVerifier.ConnectionCached", false, "", false),
+    new Property("Glacier2.SSLPermissionsVerifier.ConnectionPoolSize", false, "", false),
     new Property("Glacier2.SSLPermissionsVerifier.PreferSecure", false, "", false),
     new Property("Glacier2.SSLPermissionsVerifier.LocatorCacheTimeout", false, "", false),
     new Property("Glacier2.SSLPermissionsVerifier.InvocationTimeout", false, "", false),
@@ -1215,14 +1576,27 @@ public final class PropertyNames {
     new Property("Glacier2.Server.AdapterId", false, "", false),
     new Property("Glacier2.Server.Connection.CloseTimeout", false, "10", false),
     new Property("Glacier2.Server.Connection.ConnectTimeout", false, "10", false),
+    new Property("Glacier2.Server.Connection.CorkDelay", false, "100", false),
+    new Property("Glacier2.Server.Connection.CorkSize", false, "0", false),
     new Property("Glacier2.Server.Connection.EnableIdleCheck", false, "1", false),
     new Property("Glacier2.Server.Connection.IdleTimeout", false, "60", false),
     new Property("Glacier2.Server.Connection.InactivityTimeout", false, "300", false),
     new Property("Glacier2.Server.Connection.MaxDispatches", false, "100", false),
+    new Property("Glacier2.Server.Connection.ReadBufferSize", false, "0", false),
     new Property("Glacier2.Server.Connection", false, "", false),
+    new Property("Glacier2.Server.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("Glacier2.Server.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("Glacier2.Server.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("Glacier2.Server.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("Glacier2.Server.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("Glacier2.Server.Dispatch.Deadline", false, "0", false),
+    new Property("Glacier2.Server.Dispatch.Executor", false, "", false),
+    new Property("Glacier2.Server.Dispatch.MaxDispatches", false, "0", false),
+    new Property("Glacier2.Server.Dispatch.Size", false, "0", false),
     new Property("Glacier2.Server.Endpoints", false, "", false),
     new Property("Glacier2.Server.Locator.EndpointSelection", false, "", false),
     new Property("Glacier2.Server.Locator.ConnectionCached", false, "", false),
+    new Property("Glacier2.Server.Locator.ConnectionPoolSize", false, "", false),
     new Property("Glacier2.Server.Locator.PreferSecure", false, "", false),
     new Property("Glacier2.Server.Locator.LocatorCacheTimeout", false, "", false),
     new Property("Glacier2.Server.Locator.InvocationTimeout", false, "", false),
@@ -1235,6 +1609,7 @@ public final class PropertyNames {
     new Property("Glacier2.Server.ReplicaGroupId", false, "", false),
     new Property("Glacier2.Server.Router.EndpointSelection", false, "", false),
     new Property("Glacier2.Server.Router.ConnectionCached", false, "", false),
+    new Property("Glacier2.Server.Router.ConnectionPoolSize", false, "", false),
     new Property("Glacier2.Server.Router.PreferSecure", false, "", false),
     new Property("Glacier2.Server.Router.LocatorCacheTimeout", false, "", false),
     new Property("Glacier2.Server.Router.InvocationTimeout", false, "", false),
@@ -1251,6 +1626,8 @@ public final class PropertyNames {
     new Property("Glacier2.Server.ThreadPool.Serialize", false, "0", false),
     new Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("Glacier2.Server.ThreadPool.ThreadPriority", false, "", false),
+    new Property("Glacier2.Server.ThreadPool.Reactors", false, "1", false),
+    new Property("Glacier2.Server.ThreadPool.IoUring", false, "0", false),
     new Property("Glacier2.Server.MessageSizeMax", false, "", false),
     new Property("Glacier2.Server.Buffered", false, "1", false),
     new Property("Glacier2.Server.ForwardContext", false, "0", false),
@@ -1259,6 +1636,7 @@ public final class PropertyNames {
     new Property("Glacier2.Server.Trace.Request", false, "0", false),
     new Property("Glacier2.SessionManager.EndpointSelection", false, "", false),
     new Property("Glacier2.SessionManager.ConnectionCached", false, "", false),
+    new Property("Glacier2.SessionManager.ConnectionPoolSize", false, "", false),
     new Property("Glacier2.SessionManager.PreferSecure", false, "", false),
     new Property("Glacier2.SessionManager.LocatorCacheTimeout", false, "", false),
     new Property("Glacier2.SessionManager.InvocationTimeout", false, "", false),
@@ -1269,6 +1647,7 @@ public final class PropertyNames {
     new Property("Glacier2.SessionManager", false, "", false),
     new Property("Glacier2.SSLSessionManager.EndpointSelection", false, "", false),
     new Property("Glacier2.SSLSessionManager.ConnectionCached", false, "", false),
+    new Property("Glacier2.SSLSessionManager.ConnectionPoolSize", false, "", false),
     new Property("Glacier2.SSLSessionManager.PreferSecure", false, "", false),
     new Property("Glacier2.SSLSessionManager.LocatorCacheTimeout", false, "", false),
     new Property("Glacier2.SSLSessionManager.InvocationTimeout", false, "", false),
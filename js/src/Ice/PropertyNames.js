@@ -15,14 +15,27 @@ const IceProps = [
     new Property("Ice.Admin.AdapterId", false, "", false),
     new Property("Ice.Admin.Connection.CloseTimeout", false, "10", false),
     new Property("Ice.Admin.Connection.ConnectTimeout", false, "10", false),
+    new Property("Ice.Admin.Connection.CorkDelay", false, "100", false),
+    new Property("Ice.Admin.Connection.CorkSize", false, "0", false),
     new Property("Ice.Admin.Connection.EnableIdleCheck", false, "1", false),
     new Property("Ice.Admin.Connection.IdleTimeout", false, "60", false),
     new Property("Ice.Admin.Connection.InactivityTimeout", false, "300", false),
     new Property("Ice.Admin.Connection.MaxDispatches", false, "100", false),
+    new Property("Ice.Admin.Connection.ReadBufferSize", false, "0", false),
     new Property("Ice.Admin.Connection", false, "", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit", false, "", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit.Initial", false, "20", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit.Latency", false, "100", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit.Max", false, "1000", false),
+    new Property("Ice.Admin.Dispatch.ConcurrencyLimit.Min", false, "1", false),
+    new Property("Ice.Admin.Dispatch.Deadline", false, "0", false),
+    new Property("Ice.Admin.Dispatch.Executor", false, "", false),
+    new Property("Ice.Admin.Dispatch.MaxDispatches", false, "0", false),
+    new Property("Ice.Admin.Dispatch.Size", false, "0", false),
     new Property("Ice.Admin.Endpoints", false, "", false),
     new Property("Ice.Admin.Locator.EndpointSelection", false, "", false),
     new Property("Ice.Admin.Locator.ConnectionCached", false, "", false),
+    new Property("Ice.Admin.Locator.ConnectionPoolSize", false, "", false),
     new Property("Ice.Admin.Locator.PreferSecure", false, "", false),
     new Property("Ice.Admin.Locator.LocatorCacheTimeout", false, "", false),
     new Property("Ice.Admin.Locator.InvocationTimeout", false, "", false),
@@ -35,6 +48,7 @@ const IceProps = [
     new Property("Ice.Admin.ReplicaGroupId", false, "", false),
     new Property("Ice.Admin.Router.EndpointSelection", false, "", false),
     new Property("Ice.Admin.Router.ConnectionCached", false, "", false),
+    new Property("Ice.Admin.Router.ConnectionPoolSize", false, "", false),
     new Property("Ice.Admin.Router.PreferSecure", false, "", false),
     new Property("Ice.Admin.Router.LocatorCacheTimeout", false, "", false),
     new Property("Ice.Admin.Router.InvocationTimeout", false, "", false),
@@ -51,6 +65,8 @@ const IceProps = [
     new Property("Ice.Admin.ThreadPool.Serialize", false, "0", false),
     new Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, "60", false),
     new Property("Ice.Admin.ThreadPool.ThreadPriority", false, "", false),
+    new Property("Ice.Admin.ThreadPool.Reactors", false, "1", false),
+    new Property("Ice.Admin.ThreadPool.IoUring", false, "0", false),
     new Property("Ice.Admin.MessageSizeMax", false, "", false),
     new Property("Ice.Admin.DelayCreation", false, "0", false),
     new Property("Ice.Admin.Enabled", false, "", false),
@@ -62,25 +78,32 @@ const IceProps = [
     new Property("Ice.Admin.ServerId", false, "", false),
     new Property("Ice.BackgroundLocatorCacheUpdates", false, "0", false),
     new Property("Ice.BatchAutoFlush", false, "", true),
+    new Property("Ice.BatchAutoFlushDelay", false, "0", false),
     new Property("Ice.BatchAutoFlushSize", false, "1024", false),
     new Property("Ice.ChangeUser", false, "", false),
     new Property("Ice.ClassGraphDepthMax", false, "10", false),
+    new Property("Ice.Compression.Codecs", false, "zstd lz4 bzip2", false),
     new Property("Ice.Compression.Level", false, "1", false),
     new Property("Ice.Config", false, "", false),
     new Property("Ice.Connection.CloseTimeout", false, "10", false),
     new Property("Ice.Connection.ConnectTimeout", false, "10", false),
+    new Property("Ice.Connection.CorkDelay", false, "100", false),
+    new Property("Ice.Connection.CorkSize", false, "0", false),
     new Property("Ice.Connection.EnableIdleCheck", false, "1", false),
     new Property("Ice.Connection.IdleTimeout", false, "60", false),
     new Property("Ice.Connection.InactivityTimeout", false, "300", false),
     new Property("Ice.Connection.MaxDispatches", false, "100", false),
+    new Property("Ice.Connection.ReadBufferSize", false, "0", false),
     new Property("Ice.Connection", false, "", false),
     new Property("Ice.ConsoleListener", false, "1", false),
     new Property("Ice.Default.CollocationOptimized", false, "1", false),
+    new Property("Ice.Default.ConnectionPoolSize", false, "1", false),
     new Property("Ice.Default.EncodingVersion", false, "1.1", false),
     new Property("Ice.Default.EndpointSelection", false, "Random", false),
     new Property("Ice.Default.Host", false, "", false),
     new Property("Ice.Default.Locator.EndpointSelection", false, "", false),
     new Property("Ice.Default.Locator.ConnectionCached", false, "", false),
+    new Property("Ice.Default.Locator.ConnectionPoolSize", false, "", false),
     new Property("Ice.Default.Locator.PreferSecure", false, "", false),
     new Property("Ice.Default.Locator.LocatorCacheTimeout", false, "", false),
     new Property("Ice.Default.Locator.InvocationTimeout", false, "", false),
@@ -96,6 +119,7 @@ const IceProps = [
     new Property("Ice.Default.Protocol", false, "tcp", false),
     new Property("Ice.Default.Router.EndpointSelection", false, "", false),
     new Property("Ice.Default.Router.ConnectionCached", false, "", false),
+    new Property("Ice.Default.Router.ConnectionPoolSize", false, "", false),
     new Property("Ice.Default.Router.PreferSecure", false, "", false),
     new Property("Ice.Default.Router.LocatorCacheTimeout", false, "", false),
     new Property("Ice.Default.Router.InvocationTimeout", false, "", false),
@@ -109,6 +133,9 @@ const IceProps = [
     new Property("Ice.Default.Timeout", false, "60000", false),
     new Property("Ice.EventLog.Source", false, "", false),
     new Property("Ice.FactoryAssemblies", false, "", false),
+    new Property("Ice.Hedging.Budget", false, "10", false),
+    new Property("Ice.Hedging.MinDelay", false, "1", false),
+    new Property("Ice.Hedging.Percentile", false, "0", false),
     new Property("Ice.HTTPProxyHost", false, "", false),
     new Property("Ice.HTTPProxyPort", false, "1080", false),
     new Property("Ice.ImplicitContext", false, "None", false),
@@ -134,6 +161,7 @@ const IceProps = [
     new Property("Ice.PrintProcessId", false, "", false),
     new Property("Ice.PrintStackTraces", false, "0", false),
     new Property("Ice.ProgramName", false, "", false),
+    new Property("Ice.PropagateDeadline", false, "0", false),
     new Property("Ice.RetryIntervals", false, "0", false),
     new Property("Ice.ServerIdleTime", false, "0", false),
     new Property("Ice.SOCKSProxyHost", false, "", false),
@@ -148,6 +176,8 @@ const IceProps = [
     new Property("Ice.ThreadPool.Client.Serialize", false, "0", false),
     new Property("Ice.ThreadPool.Client.ThreadIdleTime", false, "60", false),
     new Property("Ice.ThreadPool.Client.ThreadPriority", false, "", false),
+    new Property("Ice.ThreadPool.Client.Reactors", false, "1", false),
+    new Property("Ice.ThreadPool.Client.IoUring", false, "0", false),
     new Property("Ice.ThreadPool.Server.Size", false, "1", false),
     new Property("Ice.ThreadPool.Server.SizeMax", false, "", false),
     new Property("Ice.ThreadPool.Server.SizeWarn", false, "0", false),
@@ -155,6 +185,8 @@ const IceProps = [
     new Property("Ice.ThreadPool.Server.Serialize", false, "0", false),
     new Property("Ice.ThreadPool.Server.ThreadIdleTime", false, "60", false),
     new Property("Ice.ThreadPool.Server.ThreadPriority", false, "", false),
+    new Property("Ice.ThreadPool.Server.Reactors", false, "1", false),
+    new Property("Ice.ThreadPool.Server.IoUring", false, "0", false),
     new Property("Ice.ThreadPriority", false, "", false),
     new Property("Ice.ToStringMode", false, "Unicode", false),
     new Property("Ice.Trace.Admin.Properties", false, "0", false),